@@ -4,36 +4,42 @@
  * compile: $ gcc -std=c99 -o declass declass.c
  *          $ ./declass yourFile.c 
  *     (OR) $ ./declass -l yourFile.c // optional '-l' shows class details 
+ *  library: $ gcc -std=c99 -DDECLASS_LIBRARY -c declass.c // see "declass.h"
  */
+#define _POSIX_C_SOURCE 200809L // POSIX file mapping fcns under "-std=c99"
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <pthread.h>
 #include <string.h>
 #include <sys/stat.h>
-// scrape file's contents, put contents into file, & add new filename extension
-#define FSCRAPE(BUFF,FNAME)({\
-  BUFF[0]='\0';FILE*fptr;if((fptr=fopen(FNAME,"r"))==NULL){exit(EXIT_FAILURE);}\
-  while(fgets(&BUFF[strlen(BUFF)],500,fptr)!=NULL);fclose(fptr);\
-})
-#define FPUT(BUFF,FNAME)\
-  ({FILE*fptr;if((fptr=fopen(FNAME,"w"))==NULL){exit(EXIT_FAILURE);}fprintf(fptr,"%s",BUFF);fclose(fptr);})
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <limits.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "declass.h"
+// put contents into file, & add new filename extension
+#define FPUT(BUFF,LEN,FNAME)\
+  ({FILE*fptr;char FPUT_PATH[PATH_MAX];if((fptr=fopen(resolve_path(FNAME,FPUT_PATH),"w"))==NULL){declass_exit(EXIT_FAILURE);}\
+    fwrite(BUFF,1,LEN,fptr);fclose(fptr);})
 #define NEW_EXTENSION(FNAME,EXT) ({char*p=&FNAME[strlen(FNAME)];while(*(--p)!='.');strcpy(p,EXT);})
 // checks if char is whitespace, or alphanumeric/underscore
 #define IS_WHITESPACE(c) (c == ' ' || c == '\t' || c == '\n')
 #define VARCHAR(CH) (((CH)>='A' && (CH)<='Z') || ((CH)>='a' && (CH)<='z') || (((CH)>='0' && (CH)<='9')) || (CH) == '_')
-// append string to NEW_FILE buffer when splicing in large-scale changes
-#define APPEND_STR_TO_NEW_FILE(appending) \
-  for(int m_i = 0, len = strlen(appending); m_i < len; ++m_i, *j += 1) NEW_FILE[*j] = appending[m_i];
 // initialize array with zero's (wipes garbage memory)
 #define FLOOD_ZEROS(arr, len) ({for(int arr_i = 0; arr_i < len; ++arr_i) arr[arr_i] = 0;})
 // file, class, & object limitations => all self imposed for memory's sake, increment as needed
-#define MAX_FILESIZE 1000001 // 1 megabyte + '\0'
-#define MAX_OBJECTS 1000
-#define MAX_CLASSES 1000
+#define FILE_BUFFER_PADDING 8 // zero'd bytes kept past a scraped file's end
 #define MAX_MEMBERS_PER_CLASS 100
 #define MAX_METHODS_PER_CLASS 100
-#define MAX_MEMBER_BYTES_PER_CLASS 10001
-#define MAX_METHOD_BYTES_PER_CLASS 10001
 #define MAX_WORDS_PER_METHOD 1000
 #define MAX_DEFAULT_VALUE_LENGTH 251
 // max length any single label can have in the parsed file (name of fcn, variable, class, method, arg, etc)
@@ -42,10 +48,6 @@
 #define MAX_DECLASS_HEADER_FILES 300
 
 // -:- COLA.C MACROS -:-
-#define MAX_TOTAL_NUMBER_OF_FUNCTIONS_AND_MACROS_IN_PROGRAM 5000   // max # of macros & fcns parsed file can have
-#define MAX_UNIQUE_OVERLOADS_PER_OVERLOADED_FCN_MACRO_INSTANCE 100 // max # of COLA's per overloaded fcn/macro name
-#define MAX_LENGTH_PER_ARG 1001    // max # of characters per fcn arg list parsed file can have
-#define MAX_ARGS_PER_FCN 251       // max # args per fcn arg list parsed file can have
 #define BAD_CODE_BUFFER_LENGTH 251 // portion of code shown to user at error
 /*****************************************************************************
  ||^\\ //=\\ //=\ /| |\ /\\  //\ /|==\ /\\ ||==== //^\\ ==== ==== //=\\ /\\ ||
@@ -171,7 +173,7 @@
  *   (2) IMMORTAL OBJECTS CAN ONLY BE DTOR'D IF EXPLICITLY BY THE USER, IE: *
  *       (*) immortal object "oName" only destroyed if "~oName();" invoked  *
  *****************************************************************************
- *                    -:- DECLASS.C 4 CMD LINE FLAGS -:-                    *
+ *                    -:- DECLASS.C 13 CMD LINE FLAGS -:-                   *
  *   (0) SHOW CLASS-OBJECT & COLA-OVERLOADING DATA:                         *
  *         (*) "-l": $ ./declass -l yourFile.c                              *
  *   (1) SAVE TEMP FILE MADE PRIOR TO PASSING CONVERTED FILE TO COLA.C:     *
@@ -181,9 +183,45 @@
  *   (3) MAKE FATAL ERRORS ASK USER WHETHER TO QUIT (RATHER THAN AUTOMATIC) *
  *         (*) DISCOURAGED last-resort way 2 debug, but errors 4 a reason!  *
  *         (*) "-mortal-errors": $ ./declass -mortal-errors yourFile.c      *
- *   ->> Combine any of the above, so long as "yourFile.c" is the last arg  *
- *         (*) VALID:   $ ./declass -no-compile -l -save-temps yourFile.c   *
- *         (*) INVALID: $ ./declass -no-compile -l yourFile.c -save-temps   *
+ *   (4) BATCH-DECLASSIFY MANY FILES OVER "N" THREADS, REPORTING IN ORDER:  *
+ *         (*) "-j N": $ ./declass -j 8 a.c b.c src_*.c                     *
+ *         (*) batched files never prompt the user (IE "-mortal-errors")    *
+ *   (5) REUSE CACHED DECLASSIFICATIONS OF UNCHANGED FILES & HEADERS:       *
+ *         (*) "--cache-dir DIR": $ ./declass --cache-dir ci_cache a.c      *
+ *         (*) "--cache": dflt dir "$XDG_CACHE_HOME/declass" (~/.cache)     *
+ *   (6) WRITE A MAKE DEPENDENCY FILE (FILE & ITS "DECLASS_H_" HEADERS):    *
+ *         (*) "-MD": $ ./declass -MD yourFile.c // "yourFile_DECLASS.d"    *
+ *         (*) "-MF FILE": $ ./declass -MF deps/yourFile.d yourFile.c       *
+ *   (7) DECLASSIFY "DECLASS_H_" HEADERS INTO SHARED .H/.C FILES:           *
+ *         (*) "--split-headers": $ ./declass --split-headers yourFile.c    *
+ *         (*) see "DECLASS.C & HEADER FILES" below                         *
+ *   (8) SHARE 1 SMRTPTR.H RUNTIME ACROSS FILES (RATHER THAN INLINING IT):  *
+ *         (*) "--runtime=external": $ ./declass --runtime=external a.c     *
+ *         (*) "--emit-runtime": write "declass_rt.h" & "declass_rt.c",     *
+ *             build once: $ gcc -std=c11 -c declass_rt.c &&                *
+ *                         ar rcs libdeclass_rt.a declass_rt.o              *
+ *         (*) auto-compiles link "libdeclass_rt.a" (else "declass_rt.c")   *
+ *   (9) SERVE REQUESTS FROM 1 LONG-RUNNING DECLASS.C (ON A UNIX SOCKET):   *
+ *         (*) "--serve SOCK": $ ./declass --serve /tmp/declass.sock &      *
+ *         (*) "--connect SOCK": $ ./declass --connect /tmp/declass.sock \  *
+ *                                 -no-compile yourFile.c // any flags      *
+ *         (*) re-reads "DECLASS_H_" headers only once they've changed      *
+ *  (10) PRECOMPILE "DECLASS_H_" HEADERS (USED WHILE NEWER THAN THE HEADER):*
+ *         (*) "--precompile": $ ./declass --precompile DECLASS_H_x.h       *
+ *         (*) writes "DECLASS_H_x.dch", mapped in place of the header      *
+ *         (*) w/ its parsed classes & fcns, restored in place of parsing   *
+ *  (11) DECLASSIFY STDIN TO STDOUT (REPORTING TO STDERR, NEVER COMPILING): *
+ *         (*) "-": $ ./declass - < yourFile.c | gcc -x c - -o yourFile     *
+ *         (*) only "-l" & "--runtime=" apply, "DECLASS_H_" headers are     *
+ *             still read relative to the working directory                 *
+ *  (12) AUTO-COMPILE W/ A BUILD PROFILE (DFLT NO OPTIMIZATION FLAGS):      *
+ *         (*) "--profile=debug":   -O0 -g                                  *
+ *         (*) "--profile=release": -O2 -flto & unused section GC           *
+ *         (*) "--profile=native":  -O3 -march=native -flto & section GC    *
+ *         (*) "--pgo CMD": build instrumented, train w/ "CMD", & rebuild   *
+ *             w/ its profile (IE: --pgo "./yourFile < input.txt")          *
+ *   ->> Combine any of the above, w/ 1+ ".c" files among the args          *
+ *         (*) IE:      $ ./declass -no-compile -l -save-temps yourFile.c   *
  *****************************************************************************
  *               -:- DECLASS.C SPECIALIZATION MACRO FLAGS -:-               *
  *   BY PRECEDENCE:                                                         *
@@ -197,6 +235,7 @@
  *     (7) "#define DECLASS_NCOMPILE"     => ONLY CONVERT DON'T GCC COMPILE *
  *     (8) "#define DECLASS_NC11"         => GCC COMPILE W/O "-std=c11"     *
  *     (9) "#define DECLASS_NCOLA"        => DISABLE COLA.C OVERLOADS/DFLTS *
+ *    (10) "#define DECLASS_THREADSAFE"   => THREAD-SAFE "SMRTPTR.H"        *
  *   DEFINING CUSTOM MEMORY ALLOCATION FUNCTIONS:                           *
  *     (0) declass.c relies on being able to identify memory allocation     *
  *         fcns to aptly apply dflt vals (not assigning garbage memory)     *
@@ -205,6 +244,12 @@
  *         to be recognized by declass.c at the top of their program        *
  *         (*) NOTE: ASSUMES ALL ALLOC FCNS RETURN "NULL" OR EXIT ON FAIL   *
  *     (2) list alloc fcn names after a "#define DECLASS_ALLOC_FCNS" macro  *
+ *   "pooled" CLASS OBJECT POOLS:                                           *
+ *     (0) "class cName pooled {...};" GENERATES cName'S OWN OBJECT POOL    *
+ *     (1) "cName_pool_new()" = AN ALLOC FCN RETURNING A POOLED cName PTR:  *
+ *         (*) "cName *oName(args) = cName_pool_new();"                     *
+ *     (2) "cName_pool_del(oName);" DTORS, RECYCLES, & "NULL"S "oName"      *
+ *         (*) from a free list of 64-byte aligned slabs (freed atexit)     *
  *****************************************************************************
  *                     -:- DECLASS.C & HEADER FILES -:-                     *
  *   DENOTING HEADER FILES TO ALSO BE PARSED BY DECLASS.C:                  *
@@ -217,15 +262,22 @@
  *     (1) thus can write 1 class for several files, reduces redundant code *
  *     (2) as w/ a linker, header files are prepended to the main file to   *
  *         simulate as if user wrote a monolithic code base                 *
- *         (*) THUS HEADER FILES & MAIN FILE MUST CUMULATIVELY TAKE LESS    *
- *             MEMORY THAN THE "MAX_FILESIZE" MACRO!                        *
  *     (3) header files NOT prefixed "DECLASS_H_" or "declass_h_" will NOT  *
  *         be prepended to the main codebase by declass.c                   *
+ *   "--split-headers" CMD LINE FLAG:                                       *
+ *     (0) "DECLASS_H_x.h" is declassified into "DECLASS_H_x_DECLASS.h"     *
+ *         (structs, macros, & prototypes) & "DECLASS_H_x_DECLASS.c" (fcn   *
+ *         definitions), which files including it "#include" & link w/      *
+ *     (1) thus each header's methods compile once, not once per includer   *
+ *     (2) headers must hold whole classes, & their static/inline fcns &    *
+ *         global variables stay in the ".h" (as in any other C header)     *
  *****************************************************************************/
 
 // COLA.C STRUCTS
 
 /* GLOBAL FILE FCN/MACRO & OVERLOADING TRACKING STRUCTURES */
+// all COLA tables are growable vectors sized by the fcns/macros actually found in the file
+
 // holds all global fcn & macro def's found in file
 struct function_macro_instance {
   char name[MAX_TOKEN_NAME_LENGTH]; // defined fcn/macro name
@@ -233,17 +285,17 @@ struct function_macro_instance {
   bool overloaded;     // whether its overloaded
   bool is_a_prototype; // whether is a function prototype
   bool is_a_macro;     // whether is a functionlike macro
-} fmacs[MAX_TOTAL_NUMBER_OF_FUNCTIONS_AND_MACROS_IN_PROGRAM];
-int fmacs_size = 0;
+  int next_same_name;  // idx of the prior "fmacs" instance w/ the same name (-1 if none)
+};
 
 // holds function & macro overload instances, derived from "fmacs"
 struct function_macro_overload_instance {
   char name[MAX_TOKEN_NAME_LENGTH]; // overoaded fcn/macro name
-  int arg_sizes[MAX_UNIQUE_OVERLOADS_PER_OVERLOADED_FCN_MACRO_INSTANCE];   // different arg lengths per overload
+  int *arg_sizes;       // different arg lengths per overload
+  bool *is_a_macro;     // whether each overload is a functionlike macro
   int arg_sizes_length; // # of other overoaded fcn/macros w/ same name
-  bool is_a_macro[MAX_UNIQUE_OVERLOADS_PER_OVERLOADED_FCN_MACRO_INSTANCE]; // whether each overload is a functionlike macro
-} overload_fmacs[MAX_TOTAL_NUMBER_OF_FUNCTIONS_AND_MACROS_IN_PROGRAM];
-int overload_fmacs_size = 0;
+  int arg_sizes_max;    // allocated length of "arg_sizes" & "is_a_macro"
+};
 
 /* GLOBAL FILE FCN-WITH-DEFAULT-VALUE-ARGS TRACKING STRUCTURES */
 // holds all global fcn def's found in file with default arg values
@@ -251,25 +303,51 @@ struct function_with_default_value_instance {
   char fcn_name[MAX_TOKEN_NAME_LENGTH]; // fcn instance name
   int total_args;    // fcn's total args (both dflt & not)
   int total_dflts;   // fcn's total dflt args
-  int dflt_idxs[MAX_ARGS_PER_FCN]; // fcn's dflt arg idxs wrt its arg list
-  char dflt_vals[MAX_ARGS_PER_FCN][MAX_LENGTH_PER_ARG];      // fcn's dflt values
-} all_dflt_fcns[MAX_TOTAL_NUMBER_OF_FUNCTIONS_AND_MACROS_IN_PROGRAM]; // struct to hold all dflt-valued fcn instances
-int all_dflt_fcns_size = 0; // total functions registered
+  int *dflt_idxs;    // fcn's dflt arg idxs wrt its arg list
+  char **dflt_vals;  // fcn's dflt values (interned)
+  int max_dflts;     // allocated length of "dflt_idxs" & "dflt_vals"
+};
 
 // holds defaulted-arg function instances, derived from "all_dflt_fcns"
+// (idxs & values per arg length are shared w/ the "all_dflt_fcns" instance they came from)
 struct unique_function_default_values {
   char name[MAX_TOKEN_NAME_LENGTH]; // defaulted-arg (& possibly overoaded) fcn name
   int arg_sizes_length; // # of other overoaded fcns w/ same name
-  int arg_sizes[MAX_UNIQUE_OVERLOADS_PER_OVERLOADED_FCN_MACRO_INSTANCE];   // arg length(s) (> 1 if overloaded)
-  int total_dflts[MAX_UNIQUE_OVERLOADS_PER_OVERLOADED_FCN_MACRO_INSTANCE]; // total arg dflt(s) (> 1 if overloaded)
-  int dflt_idxs[MAX_UNIQUE_OVERLOADS_PER_OVERLOADED_FCN_MACRO_INSTANCE][MAX_ARGS_PER_FCN]; // arg dflt idx(s) (> 1 if overloaded)
-  char dflt_vals[MAX_UNIQUE_OVERLOADS_PER_OVERLOADED_FCN_MACRO_INSTANCE][MAX_ARGS_PER_FCN][MAX_LENGTH_PER_ARG]; // arg dflt val(s) (> 1 if overloaded)
-} unique_dflt_fcns[MAX_TOTAL_NUMBER_OF_FUNCTIONS_AND_MACROS_IN_PROGRAM];   // dflt-arg fcn instance
-int unique_dflt_fcns_size = 0; // total unique fcn names associated w/ having 1+ dflt args
+  int arg_sizes_max;    // allocated length of the per-arg-length arrays below
+  int *arg_sizes;       // arg length(s) (> 1 if overloaded)
+  int *total_dflts;     // total arg dflt(s) (> 1 if overloaded)
+  int **dflt_idxs;      // arg dflt idx(s) (> 1 if overloaded)
+  char ***dflt_vals;    // arg dflt val(s) (> 1 if overloaded)
+};
+
+// COLA name entries: maps each interned identifier to its entries across the tables above
+struct cola_name_entries {
+  int newest_fmac;  // idx of the newest "fmacs" instance w/ the name (older ones chained via "next_same_name")
+  int overload_idx; // idx in "overload_fmacs" (-1 if not overloaded)
+  int dflt_idx;     // idx in "unique_dflt_fcns" (-1 if w/o dflt values)
+};
+
+// interned dflt values: open-addressed hash set, so each distinct value string is allocated once
+struct interned_strings {
+  char **strs;       // hash slots (NULL = empty)
+  int total, max;    // # of strings interned & # of slots
+};
 
 
 // DECLASS.C STRUCTS
 
+// hashed index mapping token names to their idx in a global struct array (chained, newest entry 1st)
+struct name_index_entry {
+  char name[MAX_TOKEN_NAME_LENGTH]; // indexed token name
+  unsigned long hash;               // cached hash of 'name'
+  int id, next;                     // idx in indexed struct array & next entry in bucket chain (-1 = none)
+};
+struct name_index {
+  int *buckets, total_buckets;       // bucket chain heads (-1 = empty)
+  struct name_index_entry *entries;  // entries in order of insertion
+  int total_entries, max_entries;
+};
+
 // stores class names, & their associated methods
 struct class_info { 
   char class_name[MAX_TOKEN_NAME_LENGTH], method_names[MAX_METHODS_PER_CLASS][MAX_TOKEN_NAME_LENGTH]; 
@@ -278,6 +356,7 @@ struct class_info {
   bool class_has_ctor, class_has_ctor_args;            // class has user-defined ctor to invoke when assigning default
   bool class_has_dtor;                                 // class has user-defined dtor to invoke when leaving obj scope
   bool class_has_alloc;                                // class has 1+ member of: malloc/calloc/smrtmalloc/smrtcalloc
+  bool class_is_pooled;                                // class tagged "pooled": obj ptrs alloc'd from its own slab pool
   bool member_is_array[MAX_MEMBERS_PER_CLASS];         // init empty arrays as {0}
   bool member_is_pointer[MAX_MEMBERS_PER_CLASS];       // init pointers as 0 (same as NULL)
   bool member_value_is_alloc[MAX_MEMBERS_PER_CLASS];   // track alloc'd members for '-l' awareness & "sizeof()" arg
@@ -285,16 +364,77 @@ struct class_info {
   char member_value_user_ctor[MAX_MEMBERS_PER_CLASS][MAX_TOKEN_NAME_LENGTH];   // track user-define ctor arr vals (spliced out for DFLT fcn)
   char member_object_class_name[MAX_MEMBERS_PER_CLASS][MAX_TOKEN_NAME_LENGTH]; // used to intialize contained class objects
   int total_methods, total_members, total_uctors;
-} classes[MAX_CLASSES];
-int total_classes = 0;
+  struct name_index method_index; // maps method names to their "method_names" idx
+};
 
 // stores object names, & their associated class
 struct objNames { 
   char class_name[MAX_TOKEN_NAME_LENGTH], object_name[MAX_TOKEN_NAME_LENGTH]; 
   bool is_class_pointer, is_alloced_class_pointer, is_class_array;
   bool class_has_dtor, is_immortal, is_dangling_ctord_ptr;
-} objects[MAX_OBJECTS];
-int total_objects = 0;
+};
+
+// length-tracked growable string: output buffers are appended to w/o rescanning for their '\0'
+struct string_builder {
+  char *str;     // '\0'-terminated contents (NULL until 1st append)
+  long len, max; // current length && allocated capacity
+};
+
+// token stream: a buffer is lexed once into tokens that later passes walk instead of its raw chars
+enum token_kind {TOKEN_IDENTIFIER, TOKEN_NUMBER, TOKEN_STRING, TOKEN_CHAR, TOKEN_COMMENT, TOKEN_PUNCTUATOR};
+struct token {
+  int offset, length; // token's position in its lexed buffer
+  int id;             // interned identifier id (-1 if not an identifier or too long to intern)
+  short kind, depth;  // "enum token_kind" && enclosing brace depth ('{' & '}' get their outer depth)
+};
+struct token_stream {
+  struct token *tokens;
+  int total, max;
+};
+
+// dtors & dtor flags spliced into the file buffer being read are deferred: each is recorded
+// by its offset in "DTOR_SPLICE_BUFFER" & written out once the parser reads up to that offset
+struct dtor_splice {
+  long offset; // position in "DTOR_SPLICE_BUFFER" the dtor is read just before
+  char *dtor;  // dtor/flag being spliced in
+};
+
+// "DECLASS_H_" header parse cache: what declassifying 1 header's segment adds to its state (classes, objects,
+// & alloc fcns), its declassified text, & the fcns/macros cola.c registers in it. reused in place of re-parsing
+// the segment wherever it's reached in the same state (same flags, preceding headers, & header text)
+struct parsed_fmac {
+  long offset;      // its '(' in its header's span
+  int args;         // # of args registered
+  bool is_a_macro, is_a_prototype, is_variadic;
+  struct function_with_default_value_instance dflts; // its "all_dflt_fcns" instance (w/ its own dflt values)
+};
+struct parsed_header {
+  unsigned long long key[2];        // chained key of the flags & every segment up to (& incl) this one
+  struct class_info *classes;       // (w/ empty "method_index"s, rebuilt from "method_names")
+  struct objNames *objects;
+  struct name_index_entry *class_entries, *object_entries; // "CLASS_INDEX" & "OBJECT_INDEX" entries (ids relative to its 1st)
+  char (*alloc_fcns)[MAX_TOKEN_NAME_LENGTH * 2];
+  int total_classes, total_objects, total_class_entries, total_object_entries, total_alloc_fcns;
+  struct string_builder declassified;        // declassified text (untrimmed)
+  bool cola_recorded;                        // whether cola.c's registration of its span was recorded below
+  struct string_builder precola, registered; // its span before & after cola.c whites out its dflt values
+  struct parsed_fmac *fmacs;
+  int total_fmacs, max_fmacs;
+  int skipped_depth;                         // net braces in the macro bodies cola.c skipped in its span
+  int users;                                 // states holding it (freed once unused, unless "cached")
+  bool cached;
+};
+// a "DECLASS_H_" header's segment in the file being declassified
+struct header_segment {
+  struct parsed_header *parsed; // its parse, restored from or recorded for the cache (NULL = neither)
+  bool restored, recording;
+  long start, end;              // its span in the declassified text (-1 = unended)
+  unsigned long long key[2];
+  int classes, objects, class_entries, object_entries, alloc_fcns, continued_errors; // state upon starting to record
+};
+
+// object symbol table: objects scoped by brace depth, innermost declaration found 1st
+#define MAX_OBJECT_SCOPE_DEPTH 1000
 
 // keeps track of "#define"'d flags in the user's program to alter the interpreter's course
 #define TOTAL_FLAGS 6
@@ -302,7 +442,8 @@ struct user_hashtag_defined_flags {
   char flags[TOTAL_FLAGS][30];
   bool defaults[TOTAL_FLAGS];
   bool non_dflt[TOTAL_FLAGS];
-} DEFNS = {
+};
+static const struct user_hashtag_defined_flags DEFAULT_DEFNS = {
   {
     "DECLASS_IGNORE",    "DECLASS_STRICTMODE", "DECLASS_NSMRTPTR",
     "DECLASS_NIMMORTAL", "DECLASS_DTORRETURN", "DECLASS_NOISYSMRTPTR"
@@ -310,161 +451,558 @@ struct user_hashtag_defined_flags {
   {false, false, true,  true,  false, false}, 
   {true,  true,  false, false, true,  true}
 };
-// flags ordered by superseding precedence, & in same order as their "DEFNS.flags[][]" counterparts
-bool *NO_DECLASS    = &DEFNS.defaults[0];  // file is not to be interpretted - terminate program    (default false)
-bool *STRICT_MODE   = &DEFNS.defaults[1];  // !SMRT_PTRS && !IMMORTALITY && DTOR_RETURN             (default false)
-bool *SMRT_PTRS     = &DEFNS.defaults[2];  // confirms default inclusion of smrtptr.h               (default true)
-bool *IMMORTALITY   = &DEFNS.defaults[3];  // confirms default enabling of "immortal" keyword       (default true)
-bool *DTOR_RETURN   = &DEFNS.defaults[4];  // returned objects also dtor'd                          (default false)
-bool *NOISY_SMRTPTR = &DEFNS.defaults[5];  // confirms whether to alert all smrtptr.h alloc/freeing (default false)
-bool NO_SMRTASSERT       = false;          // deactivates all "smrtassert()" statements             (default false)
-bool NO_C11_COMPILE_FLAG = false;          // compiles declassified file w/o "-std=c11"             (default false)
-bool NO_COMPILE          = false;          // declass.c declassifies but DOESN'T compile given file (default false)
-bool NO_COLA_PARSER      = false;          // prevents passing converted file to cola.c overloader  (default false)
-bool MORTAL_ERRORS       = false;          // fatal errors will ask user whether to quit/continue   (default false)
 
 /* NOTE: IT IS ASSUMED THAT USER-DEFINED ALLOCATION FCNS RETURN NULL OR END PROGRAM UPON ALLOC FAILURE */
-int TOTAL_ALLOC_FCNS = 4; // increases if user defines their own allocation fcns
-// user can add up to 100 of their own alloc fcns
-char ALLOC_FCNS[104][MAX_TOKEN_NAME_LENGTH * 2] = { "malloc", "calloc", "smrtmalloc", "smrtcalloc" };
+static const char DEFAULT_ALLOC_FCNS[4][MAX_TOKEN_NAME_LENGTH * 2] = { "malloc", "calloc", "smrtmalloc", "smrtcalloc" };
+
+// declassification state: every table & flag a single declassification reads & writes, so
+// states can each declassify their own file independently (see "declass.h")
+struct declass_state {
+  // COLA.C tables
+  struct function_macro_instance *fmacs;
+  int fmacs_size, fmacs_max;
+  struct function_macro_overload_instance *overload_fmacs;
+  int overload_fmacs_size, overload_fmacs_max;
+  struct function_with_default_value_instance *all_dflt_fcns; // all dflt-valued fcn instances
+  int all_dflt_fcns_size, all_dflt_fcns_max;                  // total functions registered
+  struct unique_function_default_values *unique_dflt_fcns;    // dflt-arg fcn instance
+  int unique_dflt_fcns_size, unique_dflt_fcns_max;            // total unique fcn names associated w/ having 1+ dflt args
+  struct cola_name_entries *cola_names;
+  int cola_names_size, cola_names_max; // "IDENTIFIER_INDEX" maps names to their idx
+  struct interned_strings DFLT_VALUES;
+
+  // classes & objects
+  struct class_info *classes;
+  int total_classes, max_classes; // (always room for the class being parsed at "classes[total_classes]")
+  struct name_index CLASS_INDEX;  // maps class names to their "classes" idx (registered as parsing begins)
+  struct objNames *objects;
+  int total_objects, max_objects;
+
+  // identifier index: interns each distinct identifier lexed, mapping it to its id (also its "cola_names" idx)
+  struct name_index IDENTIFIER_INDEX;
+
+  // deferred dtor splices
+  struct dtor_splice *DTOR_SPLICES;
+  int total_dtor_splices, max_dtor_splices;
+  int next_dtor_splice;     // idx of 1st dtor splice not yet written out
+  char *DTOR_SPLICE_BUFFER; // buffer being read from that dtor splice offsets are relative to
+
+  // object symbol table
+  struct name_index OBJECT_INDEX;
+  int OBJECT_SCOPE_MARKS[MAX_OBJECT_SCOPE_DEPTH]; // # of indexed objects upon entering each scope
+  int OBJECT_SCOPE_DEPTH;
+
+  // "#define"'d flags, initialized from "DEFAULT_DEFNS"
+  struct user_hashtag_defined_flags DEFNS;
+  // flags ordered by superseding precedence, & in same order as their "DEFNS.flags[][]" counterparts
+  bool *NO_DECLASS;    // file is not to be interpretted - terminate program    (default false)
+  bool *STRICT_MODE;   // !SMRT_PTRS && !IMMORTALITY && DTOR_RETURN             (default false)
+  bool *SMRT_PTRS;     // confirms default inclusion of smrtptr.h               (default true)
+  bool *IMMORTALITY;   // confirms default enabling of "immortal" keyword       (default true)
+  bool *DTOR_RETURN;   // returned objects also dtor'd                          (default false)
+  bool *NOISY_SMRTPTR; // confirms whether to alert all smrtptr.h alloc/freeing (default false)
+  bool NO_SMRTASSERT;       // deactivates all "smrtassert()" statements             (default false)
+  bool THREADSAFE_SMRTPTR;  // smrtptr.h may be used by multiple threads at once      (default false)
+  bool NO_C11_COMPILE_FLAG; // compiles declassified file w/o "-std=c11"             (default false)
+  bool NO_COMPILE;          // declass.c declassifies but DOESN'T compile given file (default false)
+  bool NO_COLA_PARSER;      // prevents passing converted file to cola.c overloader  (default false)
+  bool MORTAL_ERRORS;       // fatal errors will ask user whether to quit/continue   (default false)
+  bool SPLIT_HEADERS;       // "DECLASS_H_" headers declassified into own .h/.c files (default false)
+  bool EXTERNAL_RUNTIME;    // "#include" "declass_rt.h" rather than inlining smrtptr.h (default false)
+
+  // allocation fcns: "DEFAULT_ALLOC_FCNS", any the user defines, & 1 per "pooled" class
+  char (*ALLOC_FCNS)[MAX_TOKEN_NAME_LENGTH * 2];
+  int TOTAL_ALLOC_FCNS, max_alloc_fcns;
+
+  // array of the "DECLASS_H_" header files included.
+  // name length is + 8 to account for "delass_" prefix
+  char DECLASS_HEADER_FILE_NAMES[MAX_DECLASS_HEADER_FILES][MAX_TOKEN_NAME_LENGTH + 8];
+  int TOTAL_DECLASS_HEADER_FILES;
+
+  // words of the method being parsed (its args & locals, thus not members): kept here rather than on the
+  // parser's stack, so declassifying threads needn't enlarge theirs
+  char METHOD_WORDS[MAX_WORDS_PER_METHOD][MAX_TOKEN_NAME_LENGTH];
+
+  // "--cache-dir" key: hash of the version, filename, source & every "DECLASS_H_" header included
+  bool hash_sources;                  // whether the sources scraped are hashed into "cache_key"
+  unsigned long long cache_key[2];
+
+  // "--serve": names of every "DECLASS_H_" header stripped by "clean_source()" (NULL = unrecorded)
+  struct string_builder *header_inclusions;
+
+  // "DECLASS_H_" header parse cache: each header's segment declassified, the key chained through them so far,
+  // & the parses read from ".dch" files
+  bool cache_header_parses; // whether to restore from (& record for) "PARSED_HEADERS"
+  struct header_segment *header_segments;
+  int total_header_segments, max_header_segments;
+  unsigned long long header_chain_key[2];
+  struct parsed_header **precompiled_headers;
+  int total_precompiled_headers, max_precompiled_headers;
+  bool precompiling;        // "--precompile": ".dch" files are being remade, so ignored
+  int continued_errors;     // # of errors the user chose to continue past (parses w/ any aren't recorded)
+
+  // fatal errors long jump here rather than exiting if set, w/ the status they'd have exited with
+  jmp_buf *fatal_error_exit;
+  int exit_status;
+  bool interactive; // whether the user can be prompted
+  FILE *out, *err;  // streams reported to (buffered per file in batch mode)
+  char *working_dir; // dir relative paths are resolved against (NULL = the process' cwd)
+};
+
+// state being declassified by the current thread
+static __thread struct declass_state *DC = NULL;
+#define DC_STDOUT (DC != NULL ? DC->out : stdout)
+#define DC_STDERR (DC != NULL ? DC->err : stderr)
+
+// libdeclass context: options applied to each declassification (each w/ its own "declass_state")
+struct declass_ctx {
+  struct declass_options options;
+};
+
+// "--profile=" auto-compile build profiles: gcc flags added to the compile cmd
+struct build_profile {
+  char *name, *cflags;
+};
+#ifndef DECLASS_LIBRARY
+static const struct build_profile BUILD_PROFILES[] = {
+  {"debug",   "-O0 -g"},
+  {"release", "-O2 -flto -ffunction-sections -fdata-sections -Wl,--gc-sections"},
+  {"native",  "-O3 -march=native -flto -ffunction-sections -fdata-sections -Wl,--gc-sections"},
+};
+#endif
+#define TOTAL_BUILD_PROFILES (int)(sizeof(BUILD_PROFILES) / sizeof(BUILD_PROFILES[0]))
+#define PGO_DFLT_PROFILE (&BUILD_PROFILES[1]) // "--pgo" w/o "--profile=" builds "release"
+#define PGO_PROFILE_DIR "_pgo"                // "--pgo" profile data dir: "<executable>_pgo"
+
+// cmd line flags applied to every file declassified
+struct cmd_flags {
+  bool show_class_info, save_temp_files; // "-l" & "-save-temps"
+  bool no_compile, mortal_errors;        // "-no-compile" & "-mortal-errors"
+  int jobs;                              // "-j N" worker threads (0 = 1 file, reported unbuffered)
+  char *cache_dir;                       // "--cache-dir DIR" declassified file cache (NULL = none)
+  bool make_deps;                        // "-MD" write a make dependency file per declassified file
+  char *deps_filename;                   // "-MF FILE" dependency file (NULL = "<file>_DECLASS.d")
+  bool split_headers;                    // "--split-headers" declassify headers into shared .h/.c files
+  bool external_runtime;                 // "--runtime=external" link smrtptr.h from "declass_rt.c"
+  bool emit_runtime;                     // "--emit-runtime" write "declass_rt.h" & "declass_rt.c"
+  bool from_stdin;                       // "-" declassify stdin to stdout (reporting to stderr)
+  const struct build_profile *profile;   // "--profile=NAME" auto-compile build profile (NULL = none)
+  char *pgo_training_cmd;                // "--pgo CMD" train a profile-guided build w/ "CMD" (NULL = none)
+  char *working_dir;                     // "--serve" request's working directory (NULL = the process' cwd)
+};
+
+// each header's text is marked off by these lines while declassified (& w/ "--split-headers", until split out)
+#define DECLASS_H_SEGMENT_START "#pragma DECLASS_H_SEGMENT \""
+#define DECLASS_H_SEGMENT_END "#pragma DECLASS_H_SEGMENT_END\n"
+
+// "--cache" dflt cache dir, relative to "$XDG_CACHE_HOME" (or "$HOME/.cache" if unset)
+#define DFLT_CACHE_DIR "declass"
+#define CACHE_KEY_FNV_OFFSET 14695981039346656037ULL
+#define CACHE_KEY_MIX_OFFSET 0x9e3779b97f4a7c15ULL
+// keys every cached result & ".dch" file: declass.c's version & a hash of the runtime text & limits it declassifies w/
+// (rather than its build time, so rebuilding the same declass.c keeps its cache). set once by "pthread_once"
+static char DECLASS_VERSION_KEY[64];
+static pthread_once_t DECLASS_VERSION_KEY_ONCE = PTHREAD_ONCE_INIT;
+
+// "--serve": each client's request is served on its own thread, & must arrive w/in "SERVE_REQUEST_TIMEOUT"
+// seconds & "SERVE_MAX_REQUEST_SIZE" bytes (so a stalled or runaway client can't tie up the server). at most
+// "SERVE_MAX_CLIENTS" are served at once: the rest wait in the socket's backlog until 1 is done
+#define SERVE_REQUEST_TIMEOUT 10
+#define SERVE_MAX_REQUEST_SIZE (1024 * 1024)
+#define SERVE_MAX_CLIENTS 64
+#ifndef DECLASS_LIBRARY
+struct served_clients {
+  int total;               // # of requests being served
+  pthread_mutex_t lock;
+  pthread_cond_t finished; // signaled as each is done
+};
+static struct served_clients SERVED_CLIENTS = {0, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER};
+#endif
+
+// "--serve" header cache: each "DECLASS_H_" header's cleaned text, reused across requests until its
+// mtime & size change (& then only if its contents' hash changed too). guarded by "lock" for "-j N" &
+// concurrent requests
+struct served_header {
+  dev_t dev;
+  ino_t ino;
+  struct timespec mtime;
+  off_t size;
+  unsigned long long hash;
+  bool split;                        // cleaned w/ "--split-headers" (which rewrites its inclusions)
+  struct string_builder source;      // raw text (hashed into "--cache-dir" keys)
+  struct string_builder cleaned;     // "clean_source()"'d text
+  struct string_builder inclusions;  // '\n'-terminated names of the "DECLASS_H_" headers it includes
+};
+struct served_header_cache {
+  bool serving;
+  struct served_header *headers;
+  int total, capacity;
+  pthread_mutex_t lock;
+};
+static struct served_header_cache SERVED_HEADERS = {false, NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER};
+
+// "DECLASS_H_" header parse cache shared by every state (see "struct parsed_header"): enabled for batch
+// mode & "--serve", evicting the oldest parse past "MAX_PARSED_HEADERS". guarded by "lock"
+#define MAX_PARSED_HEADERS 256
+struct parsed_header_cache {
+  bool caching;
+  struct parsed_header **headers;
+  int total, capacity;
+  pthread_mutex_t lock;
+};
+static struct parsed_header_cache PARSED_HEADERS = {false, NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER};
+
+// "--precompile" ".dch" file: this header, then the names of the "DECLASS_H_" headers it includes ('\n'-
+// terminated), its cleaned text, its "--split-headers" cleaned text, & the parses of its (& its included
+// headers') segments when included by itself (w/ & w/o "--split-headers" & "--runtime=external"). used in
+// place of the header while newer
+#define DCH_MAGIC "DCH\n"
+struct dch_header {
+  char magic[4];
+  char build[64];           // "declass_version_key()": ".dch" files from other versions of declass.c are ignored
+  long inclusions_len, cleaned_len, split_cleaned_len, parses_len;
+  long total_parses;
+};
+// reads the serialized parses of a ".dch" file, field by field
+struct dch_reader {
+  char *at, *end;
+  bool bad; // whether a field ran past "end" or out of bounds (the rest is then ignored)
+};
 
-// cumulative filesizes of the main program & its #included "DECLASS_H_" header files
-long long CUMULATIVE_FILESIZE = 0;
-// array of the "DECLASS_H_" header files included.
-// name length is + 8 to account for "delass_" prefix
-char DECLASS_HEADER_FILE_NAMES[MAX_DECLASS_HEADER_FILES][MAX_TOKEN_NAME_LENGTH + 8];
-int TOTAL_DECLASS_HEADER_FILES = 0;
+// batch mode: worker threads each claim the next unclaimed file, declassifying it w/ its own state
+struct batch_file {
+  char *filename;
+  char *out, *err;         // buffered stdout & stderr reports
+  size_t out_len, err_len;
+  int status;              // exit status of its declassification
+  bool done;
+};
+struct batch {
+  struct batch_file *files;
+  int total_files, next_file; // "next_file" is claimed atomically
+  struct cmd_flags *flags;
+  pthread_mutex_t lock;       // guards each file's "done" flag
+  pthread_cond_t file_done;
+};
 
 // basic c type keywords:
 #define TOTAL_TYPES 14
-char basic_c_types[TOTAL_TYPES][11] = {
+static char basic_c_types[TOTAL_TYPES][11] = {
   "char ","short ","int ","unsigned ","signed ","struct ","union ",
   "long ","float ","double ","bool ","enum ","typedef ","void "
 };
 // brace-additions
 #define TOTAL_BRACE_KEYWORDS 5
-char brace_keywords[TOTAL_BRACE_KEYWORDS][8] = {"else if", "if", "else", "for", "while"};
+static char brace_keywords[TOTAL_BRACE_KEYWORDS][8] = {"else if", "if", "else", "for", "while"};
 
 /* C.O.L.A. "C OVERLOADED LENGTH ARGUMENTS" PARSER MAIN EXECUTION */
-bool COLA_C_main_execution(bool, char*);
+#ifndef DECLASS_LIBRARY
+static bool COLA_C_main_execution(bool, char*, struct string_builder*, bool);
+#endif
+static bool COLA_C_overload(char*, struct string_builder*);
+/* DECLASSIFICATION STATE & EXIT FUNCTIONS */
+static struct declass_state *new_declass_state();
+static void free_declass_state(struct declass_state*);
+static void declass_exit(int);
+#ifndef DECLASS_LIBRARY
+/* CMD LINE FILE & BATCH DECLASSIFICATION FUNCTIONS */
+static int parse_cmd_line_args(int, char*[], struct cmd_flags*, char**, char*);
+static bool is_C_file_name(char*);
+static int declass_file(char*, struct cmd_flags*, FILE*, FILE*);
+static void declass_file_main_execution(char*, struct cmd_flags*);
+static void declassify_and_cola_overload(struct string_builder*, char*, struct cmd_flags*, bool*);
+static void compile_and_report_declassified_file(char*, char*, struct cmd_flags*, bool, char*);
+static int compile_declassified_file(char*);
+static void compile_with_pgo(char*, char*, char*);
+static void clear_pgo_profile_dir(char*);
+static int declass_batch(char**, int, struct cmd_flags*, FILE*, FILE*);
+static void *batch_worker(void*);
+static int declass_stdin(struct cmd_flags*);
+/* "--serve" DECLASSIFICATION SERVER FUNCTIONS */
+static int declass_serve(char*);
+static void *serve_declass_client(void*);
+static void finish_served_client();
+static void serve_declass_request(int);
+static int declass_connect(char*, int, char*[]);
+#endif
+static bool fetch_served_header(char*, struct string_builder*, struct string_builder*);
+static void clean_and_serve_header(char*, struct string_builder*, struct string_builder*);
+static unsigned long long served_header_hash(struct string_builder*);
+/* "DECLASS_H_" HEADER PARSE CACHE FUNCTIONS */
+static void start_DECLASS_H_chain_key();
+static char *begin_DECLASS_H_segment(char*, struct string_builder*);
+static char *end_DECLASS_H_segment(char*, struct string_builder*);
+static bool in_DECLASS_H_segment();
+static struct parsed_header *record_parsed_DECLASS_H_header(struct header_segment*, struct string_builder*);
+static bool restore_parsed_DECLASS_H_header(struct parsed_header*, struct string_builder*);
+static void *copy_parse_table(void*, int, size_t);
+static struct parsed_header *acquire_parsed_DECLASS_H_header(unsigned long long [2]);
+static void release_parsed_DECLASS_H_header(struct parsed_header*);
+#ifndef DECLASS_LIBRARY
+static void publish_parsed_DECLASS_H_headers();
+#endif
+static void free_parsed_DECLASS_H_header(struct parsed_header*);
+static void *reserve_table(void*, int*, int, size_t); // defined in COLA.C below
+/* "--precompile" PRECOMPILED HEADER FUNCTIONS */
+#ifndef DECLASS_LIBRARY
+static int precompile_DECLASS_H_header(char*);
+static void precompile_DECLASS_H_header_execution(char*);
+static void precompile_DECLASS_H_parses(char*, bool, bool, struct string_builder*, long*);
+static void serialize_parsed_DECLASS_H_header(struct parsed_header*, struct string_builder*);
+static void dch_put(struct string_builder*, void*, long);
+static void dch_put_str(struct string_builder*, char*, long);
+#endif
+static bool fetch_precompiled_header(char*, struct string_builder*);
+static void load_precompiled_DECLASS_H_parses(char*, long, long);
+static struct parsed_header *deserialize_parsed_DECLASS_H_header(struct dch_reader*);
+static void dch_get(struct dch_reader*, void*, long);
+static void dch_get_str(struct dch_reader*, char*, long);
+static void dch_get_text(struct dch_reader*, struct string_builder*);
+/* MAKE DEPENDENCY FILE FUNCTIONS */
+#ifndef DECLASS_LIBRARY
+static void write_make_dependencies(char*, char*, char*);
+static void append_make_path(struct string_builder*, char*);
+#endif
+/* DECLASSIFIED FILE CACHE FUNCTIONS */
+static void cache_key_add(char*, long);
+static void key_add(unsigned long long [2], char*, long);
+static void init_declass_version_key();
+static char *declass_version_key();
+#ifndef DECLASS_LIBRARY
+static void cache_entry_path(char*, struct string_builder*);
+static bool make_cache_dir(char*);
+static bool fetch_cached_declassification(char*, char*);
+static void store_declassification_in_cache(char*, char*);
+#endif
+/* DECLASSIFIER */
+static void declassify(struct string_builder*, char*, struct string_builder*);
+/* LIBDECLASS API HELPER */
+static void transpile_source(declass_ctx*, const char*, size_t, struct string_builder*);
 /* BRACE-ADDITION FUNCTION */
-bool at_smrtassert_or_compile_or_cola_macro_flag(char*);
-void add_braces(char []);
+static bool at_smrtassert_or_compile_or_cola_macro_flag(char*);
+static void add_braces(struct string_builder*, struct string_builder*);
 /* "DECLASS_H_" HEADER FILE LINKING FUNCTIONS */
-void scrape_and_include_all_DECLASS_H_headers(char*);
-bool is_valid_DECLASS_H_header_file(char*);
-bool is_unique_DECLASS_H_header(char*);
-void parse_file_for_DECLASS_H_header_files(char*);
+#ifndef DECLASS_LIBRARY
+static void scrape_and_include_all_DECLASS_H_headers(char*, struct string_builder*);
+#endif
+static void include_all_DECLASS_H_headers(char*, struct string_builder*);
+static bool is_valid_DECLASS_H_header_file(char*);
+static bool is_unique_DECLASS_H_header(char*);
+static char *register_DECLASS_H_header_inclusion(char*, char*);
+static void register_DECLASS_H_header(char*);
+/* "--split-headers" SHARED HEADER SPLITTING FUNCTIONS */
+static void split_DECLASS_H_filename(char*, char*, char*);
+#ifndef DECLASS_LIBRARY
+static void split_out_DECLASS_H_headers(char*, struct string_builder*);
+static void split_DECLASS_H_segment(char*, long, struct string_builder*, struct string_builder*);
+static long skip_literal_or_comment(char*, long, long);
+static bool is_extern_fcn_definition(char*, long);
+static void write_if_changed(char*, struct string_builder*);
+#endif
+/* "--runtime=external" SHARED RUNTIME FUNCTIONS */
+#ifndef DECLASS_LIBRARY
+static void emit_declass_runtime();
+static void link_declass_runtime(struct string_builder*);
+#endif
 /* MESSAGE FUNCTIONS */
-void get_invalid_code_snippet(const char*, const char*, char []); // defined in COLA.C below
-void process_cmd_flag(char*, bool*, bool*);
-void enable_smrtptr_alerts();
-void confirm_no_reserved_DC_prefix(char*);
-void confirm_valid_file(char*);
-void confirm_command_processor_exists_for_autonomous_compilation(int);
-void declass_DECLASSIFIED_ascii_art();
-void declass_ERROR_ascii_art();
-void declass_missing_Cfile_alert();
-void throw_DECLASS_IGNORE_message_and_terminate();
-void show_l_flag_data();
-void ask_user_whether_to_quit_or_continue_declassification();
-void POSSIBLE_DUMMY_CTOR_METHOD_ARG_ERROR_MESSAGE(const char [12],int,int);
-void throw_potential_invalid_double_dflt_assignment(const char [12], int, char*);
-void throw_fatal_error_dtor_has_args(char*, int, char*);
+static void get_invalid_code_snippet(const char*, const char*, char []); // defined in COLA.C below
+#ifndef DECLASS_LIBRARY
+static bool process_cmd_flag(char*, struct cmd_flags*);
+#endif
+static void enable_smrtptr_alerts(char*);
+static void reserved_DC_prefix_alert(char*, char*);
+#ifndef DECLASS_LIBRARY
+static void confirm_valid_file(char*);
+static void confirm_command_processor_exists_for_autonomous_compilation(int);
+static void declass_DECLASSIFIED_ascii_art();
+static void declass_ERROR_ascii_art();
+static void declass_missing_Cfile_alert();
+#endif
+static void throw_DECLASS_IGNORE_message_and_terminate();
+#ifndef DECLASS_LIBRARY
+static void show_l_flag_data();
+#endif
+static void ask_user_whether_to_quit_or_continue_declassification();
+static void POSSIBLE_DUMMY_CTOR_METHOD_ARG_ERROR_MESSAGE(const char [12],int,int);
+static void throw_potential_invalid_double_dflt_assignment(const char [12], int, char*);
+static void throw_fatal_error_dtor_has_args(char*, int, char*);
 /* USER-DEFINED ALLOCATION FUNCTIONS PARSING/REGISTERING FUNCTIONS */
-bool is_an_alloc_fcn(char*);
-void register_user_defined_alloc_fcns(char*);
+static bool is_an_alloc_fcn(char*);
+static void register_user_defined_alloc_fcns(char*);
 /* COMMENT & BLANK LINE SKIPPING FUNCTIONS */
-void whitespace_all_comments(char*);
-void trim_sequential_spaces(char []);
-int remove_blank_lines(char*);
+static void clean_source(char*, struct string_builder*);
+static long trim_sequential_spaces(char [], struct header_segment*, int);
+static void move_segment_spans(struct header_segment*, int, int*, long, long);
+static int remove_blank_lines(char*);
 /* STRING HELPER FUNCTIONS */
-bool no_overlap(char, char*);
-bool is_at_substring(char*, char*);
-void account_for_string_char_scopes(bool*, bool*, bool*, char*);
+static bool no_overlap(char, char*);
+static bool is_at_substring(char*, char*);
+static void account_for_string_char_scopes(bool*, bool*, bool*, char*);
+static bool is_escaped(char*);
+/* STRING BUILDER FUNCTIONS */
+static void sb_reserve(struct string_builder*, long);
+static char *sb_reserve_at(struct string_builder*, char*, long);
+static void sb_zero_pad(struct string_builder*, long);
+static void sb_appendn(struct string_builder*, char*, long);
+static void sb_append(struct string_builder*, char*);
+static void sb_putc(struct string_builder*, char);
+static void sb_printf(struct string_builder*, const char*, ...);
+static void sb_truncate(struct string_builder*, long);
+static void sb_free(struct string_builder*);
+/* FILE SCRAPING FUNCTIONS */
+static char *resolve_path(char*, char*);
+static void scrape_file(char*, struct string_builder*);
+/* HASHED NAME INDEX FUNCTIONS */
+static unsigned long hash_token(char*, int);
+static void name_index_add(struct name_index*, char*, int);
+static int name_index_find(struct name_index*, char*, int, int);
+static int class_named(char*, int, int);
+static int class_at(char*, int);
+static void name_index_truncate(struct name_index*, int);
+static void free_name_index(struct name_index*);
+/* LEXER FUNCTIONS */
+static int identifier_id(char*, int);
+static int intern_identifier(char*, int);
+static void lex_tokens(char*, struct token_stream*, bool);
+static void free_token_stream(struct token_stream*);
+static char *next_token_stop(char*, struct token_stream*, int*, char*, char*, bool);
+static bool opens_fcn_definition_params(char*, struct token_stream*, char*);
+/* OBJECT SYMBOL TABLE SCOPE FUNCTIONS */
+static void push_object_scope();
+static void pop_object_scope();
 /* DUMMY CTOR OBJECT INVOCATION CHAIN PARSER */
-void get_dummy_ctor_invoking_object_chain(char*, char*, int, bool*, bool*);
+static void get_dummy_ctor_invoking_object_chain(char*, char*, int, bool*, bool*);
 /* OBJECT CONSTRUCTION FUNCTIONS */
-bool is_a_dummy_ctor(char*);
-void mk_initialization_brace(char [], int);
-void mk_object_array_ctor_macros(char [], char*);
-void mk_ctor_macros(char [], char*);
-void mk_class_global_initializer(char*, char*, char*);
-int prefix_dummy_ctor_with_DC__DUMMY_(char*, char*);
-void mk_dummy_ctor_macros(char*, char*);
+static bool is_a_dummy_ctor(char*);
+static void mk_initialization_brace(struct string_builder*, int);
+static void mk_object_array_ctor_macros(struct string_builder*, char*);
+static void mk_ctor_macros(struct string_builder*, char*);
+static void mk_class_global_initializer(struct string_builder*, char*, char*);
+static int prefix_dummy_ctor_with_DC__DUMMY_(struct string_builder*, char*);
+static void mk_dummy_ctor_macros(struct string_builder*, char*);
 /* USER-DEFINED OBJECT CONSTRUCTOR (CTOR) PARSING FUNCTIONS */
-bool get_user_ctor(char*, char*, char*, bool*);
-char *check_for_ctor_obj(char*, char*, int*, int*, bool*);
+static bool get_user_ctor(char*, char*, char*, bool*);
+static char *check_for_ctor_obj(char*, struct string_builder*, int*, bool*);
+static long class_ctor_splice_headroom(char*);
 /* OBJECT ARRAY DESTRUCTION-MACRO CREATION FUNCTION */
-void mk_dtor_array_macro(char [], char*);
+static void mk_dtor_array_macro(struct string_builder*, char*);
+/* "pooled" CLASS OBJECT POOL CREATION FUNCTIONS */
+static bool class_is_pooled(char*);
+static void register_class_pool_alloc_fcn(char*);
+static void mk_class_pool_decls(struct string_builder*, char*);
+static void mk_class_pool_fcns(struct string_builder*, char*);
 /* USER-DEFINED OBJECT DESTRUCTOR (DTOR) PARSING & SPLICING FUNCTIONS */
-int shiftSplice_dtor_in_buffer(char*, char*, bool);
-bool object_is_returned(char*);
-void get_if_else_object_idxs(char*, int*);
-bool unique_dtor_condition(char*, char*);
-int one_line_conditional(char*, bool);
-int return_then_immediate_exit(char*);
-void add_object_dtor(char*, bool, bool);
+static int dtor_splice_bound(long, bool);
+static bool dtor_splice_matches(int, char*);
+static bool dtor_spliced_at(char*, char*);
+static bool dtor_already_in_scope(char*, char*, bool);
+static bool defer_dtor_splice(char*, char*, bool, bool);
+static void emit_dtor_splices(char*, struct string_builder*);
+static char *before_next_dtor_splice(char*);
+static bool object_is_returned(char*);
+static void get_if_else_object_idxs(char*, int*);
+static bool unique_dtor_condition(char*, char*);
+static int one_line_conditional(char*, bool);
+static int return_then_immediate_exit(char*);
+static void add_object_dtor(char*, bool, bool);
 /* OBJECT METHOD PARSER */
-int parse_method_invocation(char*, char*, int*, bool, char[][MAX_TOKEN_NAME_LENGTH]);
-void splice_in_prepended_method_name(char*, char*, int, char*, int*, int*, char[][MAX_TOKEN_NAME_LENGTH]);
-void splice_in_prepended_NESTED_method_name(char*, char*, int, char*, int*, char[][MAX_TOKEN_NAME_LENGTH]);
-void rmv_excess_buffer_objectChain(char*, char*, char*, char*, char*);
+static int parse_method_invocation(char*, struct string_builder*, bool, char[][MAX_TOKEN_NAME_LENGTH]);
+static void splice_in_prepended_method_name(char*, char*, int, struct string_builder*, int*, char[][MAX_TOKEN_NAME_LENGTH]);
+static void splice_in_prepended_NESTED_method_name(char*, char*, int, struct string_builder*, int*, char[][MAX_TOKEN_NAME_LENGTH]);
+static void rmv_excess_buffer_objectChain(char*, char*, char*, struct string_builder*, char*);
 /* OBJECT METHOD PARSER HELPER FUNCTIONS */
-int is_method_invocation(char*);
-bool invoked_member_is_method(char*, char*, bool);
-void get_invoked_member_name(char*, char*);
-void get_object_name(char*, char*, char*, int, char [][MAX_TOKEN_NAME_LENGTH], bool, bool*);
-int prefix_local_members_and_cpy_method_args(char*, char*, char [][MAX_TOKEN_NAME_LENGTH], int*, char);
+static int is_method_invocation(char*);
+static bool invoked_member_is_method(char*, char*, bool);
+static void get_invoked_member_name(char*, char*);
+static void get_object_name(char*, char*, char*, int, char [][MAX_TOKEN_NAME_LENGTH], bool, bool*);
+static int prefix_local_members_and_cpy_method_args(char*, struct string_builder*, char [][MAX_TOKEN_NAME_LENGTH], int*, char);
 /* STORE OBJECT INFORMATION */
-bool store_object_info(char*, int, bool*);
+static bool store_object_info(char*, int, bool*);
 /* PARSE CLASS HELPER FUNCTIONS */
-void initialize_new_class_default_properties(char*);
-bool is_struct_definition(char*);
-void get_class_name(char*, char*);
-void confirm_only_one_cdtor(char*, char*, bool);
-void confirm_only_valid_cola_overloads(char*);
-int count_class_cdtor_args(char*);
-void get_prepended_method_name(char*, char*, char*, bool*, bool*);
-int get_initialized_member_value(char*);
-void register_member_class_objects(char*);
-void check_for_alloc_sizeof_arg();
-int get_class_member(char*, bool);
-void add_method_word(char [][MAX_TOKEN_NAME_LENGTH], int*, char*, char*);
+static void initialize_new_class_default_properties(char*);
+static void reserve_class_tables(int, int, int);
+static bool is_struct_definition(char*);
+static void get_class_name(char*, char*);
+static void confirm_only_one_cdtor(char*, char*, bool);
+static void confirm_only_valid_cola_overloads(char*);
+static int count_class_cdtor_args(char*);
+static void get_prepended_method_name(char*, char*, char*, bool*, bool*);
+static int get_initialized_member_value(char*);
+static void register_member_class_objects(char*);
+static void check_for_alloc_sizeof_arg();
+static int get_class_member(char*, bool);
+static void add_method_word(char [][MAX_TOKEN_NAME_LENGTH], int*, char*, char*);
 /* CONFIRM WHETHER METHOD'S WORD IS A LOCAL CLASS MEMBER */
-bool not_local_var_declaration(char*);
-bool not_in_method_words(char [][MAX_TOKEN_NAME_LENGTH], int, char*);
-bool not_an_external_invocation(char*);
-void splice_in_this_arrowPtr(char*);
-int parse_local_nested_method(char*, char*, char*, char [][MAX_TOKEN_NAME_LENGTH]);
-bool valid_member(char*, char*, char, char, char [][MAX_TOKEN_NAME_LENGTH], int);
+static bool not_local_var_declaration(char*);
+static bool not_in_method_words(char [][MAX_TOKEN_NAME_LENGTH], int, char*);
+static bool not_an_external_invocation(char*);
+static void splice_in_this_arrowPtr(struct string_builder*);
+static int parse_local_nested_method(char*, struct string_builder*, char*, char [][MAX_TOKEN_NAME_LENGTH]);
+static bool valid_member(char*, char*, char, char, char [][MAX_TOKEN_NAME_LENGTH], int);
 /* PARSE CLASS */
-int parse_class(char*, char [], int*);
+static int parse_class(char*, struct string_builder*);
 
 // declassed program contact header, "immortal" keyword, & deactivate smrtassert
-#define DC_SUPPORT_CONTACT "Email jrandleman@scu.edu or see https://github.com/jrandleman for support */\nint DC__NDTR = 1;"
+#define DC_SUPPORT_EMAIL "Email jrandleman@scu.edu or see https://github.com/jrandleman for support */"
+#define DC_SUPPORT_CONTACT DC_SUPPORT_EMAIL "\nint DC__NDTR = 1;"
+// "--runtime=external" runtime: built once (or into "DECLASS_RT_LIB") & shared by every declassified file
+#define DECLASS_RT_H   "declass_rt.h"
+#define DECLASS_RT_C   "declass_rt.c"
+#define DECLASS_RT_LIB "libdeclass_rt.a"
 #define IMMORTAL_KEYWORD_DEF "#define immortal // immortal keyword active\n"
 #define NDEBUG_SMRTPTR_DEF "#define DECLASS_NDEBUG // smartptr.h \"smrtassert()\"statements disabled\n"
+#define THREADSAFE_SMRTPTR_DEF "#define DECLASS_THREADSAFE // smrtptr.h's garbage collector locked per shard\n"
 // smrtptr.h to implement stdlib.h's memory handling functions w/ garbage collection
-char DC_SMART_POINTER_H_[5000] = "\
+static char DC_SMART_POINTER_H_[16000] = "\
 /****************************** SMRTPTR.H START ******************************/\n\
 // Source: https://github.com/jrandleman/C-Libraries/tree/master/Smart-Pointer\n\
 #ifndef SMRTPTR_H_\n\
 #define SMRTPTR_H_\n\
 #include <stdio.h>\n\
 #include <stdlib.h>\n\
-// garbage collector & smart pointer storage struct\n\
+#include <string.h>\n\
+// \"#define DECLASS_THREADSAFE\": the garbage collector is split into 64 independently locked shards\n\
+// (by ptr hash, so any thread may free any smrt ptr) & each thread opens its own arena regions\n\
+#ifdef DECLASS_THREADSAFE\n\
+#include <pthread.h>\n\
+#define SMRTPTR_SHARDS 64\n\
+#define SMRTPTR_THREAD_LOCAL __thread\n\
+#define SMRTPTR_SHARD_ALIGN _Alignas(64)\n\
+#else\n\
+#define SMRTPTR_SHARDS 1\n\
+#define SMRTPTR_THREAD_LOCAL\n\
+#define SMRTPTR_SHARD_ALIGN\n\
+#endif\n\
+// garbage collector & smart pointer storage struct: an open-addressing hash set (per shard)\n\
+// shards are cache-line aligned, so their size rounds up to a multiple of 64 (no false sharing)\n\
 static struct SMRTPTR_GARBAGE_COLLECTOR {\n\
-  long len, max; // current # of ptrs && max capacity\n\
-  void **ptrs;   // unique ptr set to free all smrt ptrs\n\
-} SMRTPTR_GC = {-1};\n\
-// invoked by atexit to free all ctor-alloc'd memory\n\
+  SMRTPTR_SHARD_ALIGN long len; // current # of ptrs\n\
+  long max;      // # of slots (a power of 2, kept under 3/4 full)\n\
+  void **ptrs;   // unique ptr set to free all smrt ptrs (NULL slots are empty)\n\
+#ifdef DECLASS_THREADSAFE\n\
+  pthread_mutex_t lock; // guards the shard\n\
+#endif\n\
+} SMRTPTR_GC[SMRTPTR_SHARDS];\n\
+// arena regions: while 1 is open, smrtmalloc/smrtcalloc bump-allocate from its chunks (each\n\
+// a smart ptr itself, so still freed atexit) which smrtarena_end frees all at once\n\
+struct SMRTARENA_CHUNK {\n\
+  struct SMRTARENA_CHUNK *prev; // region's previous (full) chunk\n\
+  size_t len, max;              // bytes bumped thus far && bytes available\n\
+};\n\
+static SMRTPTR_THREAD_LOCAL struct SMRTARENA_REGION {\n\
+  struct SMRTARENA_REGION *outer; // enclosing open region (NULL if outermost)\n\
+  struct SMRTARENA_CHUNK *chunks; // newest chunk (NULL until 1st alloc)\n\
+} *SMRTARENA = NULL;\n\
+// invoked by atexit to free all ctor-alloc'd memory (join any threads using smrt ptrs 1st)\n\
 static void smrtptr_free_all() {\n\
-  int i = 0;\n\
-  for(; i < SMRTPTR_GC.len; ++i) free(SMRTPTR_GC.ptrs[i]);\n\
-  if(SMRTPTR_GC.len > 0) free(SMRTPTR_GC.ptrs);\n\
-  // if(SMRTPTR_GC.len > 0) printf(\"FREED %ld SMART POINTERS!\\n\", SMRTPTR_GC.len); // optional\n\
-  SMRTPTR_GC.len = 0;\n\
+  long len = 0, s = 0, i;\n\
+  for(; s < SMRTPTR_SHARDS; ++s) {\n\
+    for(i = 0; i < SMRTPTR_GC[s].max; ++i) if(SMRTPTR_GC[s].ptrs[i]) free(SMRTPTR_GC[s].ptrs[i]);\n\
+    free(SMRTPTR_GC[s].ptrs);\n\
+    len += SMRTPTR_GC[s].len, SMRTPTR_GC[s].len = 0, SMRTPTR_GC[s].max = 0, SMRTPTR_GC[s].ptrs = NULL;\n\
+  }\n\
+  // if(len > 0) printf(\"FREED %ld SMART POINTERS!\\n\", len); // optional\n\
+  SMRTARENA = NULL;\n\
 }\n\
 // throws invalid allocation errors\n\
 static void smrtptr_throw_bad_alloc(char *alloc_type, char *smrtptr_h_fcn) {\n\
@@ -472,6 +1010,75 @@ static void smrtptr_throw_bad_alloc(char *alloc_type, char *smrtptr_h_fcn) {\n\
   fprintf(stderr, \"-:- FREEING ALLOCATED MEMORY THUS FAR AND TERMINATING PROGRAM -:-\\n\\n\");\n\
   exit(EXIT_FAILURE); // still frees any ptrs allocated thus far\n\
 }\n\
+// registers the garbage collector to be freed atexit (once, rather than per ptr) & inits its locks\n\
+static void smrtptr_init_gc() {\n\
+#ifdef DECLASS_THREADSAFE\n\
+  long s = 0;\n\
+  for(; s < SMRTPTR_SHARDS; ++s) pthread_mutex_init(&SMRTPTR_GC[s].lock, NULL);\n\
+#endif\n\
+  atexit(smrtptr_free_all);\n\
+}\n\
+// lock & unlock gc's shard (no-ops w/o \"DECLASS_THREADSAFE\")\n\
+static void smrtptr_lock(struct SMRTPTR_GARBAGE_COLLECTOR *gc) {\n\
+#ifdef DECLASS_THREADSAFE\n\
+  pthread_mutex_lock(&gc->lock);\n\
+#endif\n\
+  (void)gc;\n\
+}\n\
+static void smrtptr_unlock(struct SMRTPTR_GARBAGE_COLLECTOR *gc) {\n\
+#ifdef DECLASS_THREADSAFE\n\
+  pthread_mutex_unlock(&gc->lock);\n\
+#endif\n\
+  (void)gc;\n\
+}\n\
+// hashes ptr: its low bits pick the 1st slot it may be stored in, & its top 6 its shard\n\
+static unsigned long long smrtptr_hash(void *ptr) {\n\
+  unsigned long long hash = (unsigned long long)(size_t)ptr;\n\
+  hash ^= hash >> 33, hash *= 0xff51afd7ed558ccdULL, hash ^= hash >> 33;\n\
+  return hash;\n\
+}\n\
+// returns the garbage collector shard storing ptr (initializing the garbage collector if unused)\n\
+static struct SMRTPTR_GARBAGE_COLLECTOR *smrtptr_shard(void *ptr) {\n\
+#ifdef DECLASS_THREADSAFE\n\
+  static pthread_once_t init = PTHREAD_ONCE_INIT;\n\
+  pthread_once(&init, smrtptr_init_gc);\n\
+  return &SMRTPTR_GC[smrtptr_hash(ptr) >> 58];\n\
+#else\n\
+  static int init = 0;\n\
+  if(!init) init = 1, smrtptr_init_gc();\n\
+  return (void)ptr, SMRTPTR_GC;\n\
+#endif\n\
+}\n\
+// returns the slot of gc holding ptr, else the empty slot ptr would be stored in\n\
+static long smrtptr_find(struct SMRTPTR_GARBAGE_COLLECTOR *gc, void *ptr) {\n\
+  long i = (long)(smrtptr_hash(ptr) & (unsigned long long)(gc->max - 1));\n\
+  while(gc->ptrs[i] && gc->ptrs[i] != ptr) i = (i + 1) & (gc->max - 1);\n\
+  return i;\n\
+}\n\
+// empties slot i of gc, shifting back any later ptrs whose probe passed through it\n\
+static void smrtptr_unslot(struct SMRTPTR_GARBAGE_COLLECTOR *gc, long i) {\n\
+  long j = i, home;\n\
+  gc->ptrs[i] = NULL;\n\
+  while(gc->ptrs[j = (j + 1) & (gc->max - 1)]) {\n\
+    home = (long)(smrtptr_hash(gc->ptrs[j]) & (unsigned long long)(gc->max - 1));\n\
+    if((j > i && (home <= i || home > j)) || (j < i && home <= i && home > j))\n\
+      gc->ptrs[i] = gc->ptrs[j], gc->ptrs[j] = NULL, i = j;\n\
+  }\n\
+  gc->len--;\n\
+}\n\
+// rehashes gc into \"new_max\" slots (a power of 2)\n\
+static void smrtptr_rehash(struct SMRTPTR_GARBAGE_COLLECTOR *gc, long new_max) {\n\
+  long old_max = gc->max, i = 0;\n\
+  void **old_ptrs = gc->ptrs;\n\
+  gc->ptrs = calloc(new_max, sizeof(void *));\n\
+  if(!gc->ptrs) {\n\
+    gc->ptrs = old_ptrs;\n\
+    smrtptr_throw_bad_alloc(old_max ? \"REALLOC\" : \"MALLOC\", \"GARBAGE COLLECTOR\");\n\
+  }\n\
+  gc->max = new_max;\n\
+  for(; i < old_max; ++i) if(old_ptrs[i]) gc->ptrs[smrtptr_find(gc, old_ptrs[i])] = old_ptrs[i];\n\
+  free(old_ptrs);\n\
+}\n\
 // acts like assert, but exits rather than abort to free smart pointers\n\
 #ifndef DECLASS_NDEBUG\n\
 #define smrtassert(condition) ({\\\n\
@@ -487,32 +1094,77 @@ static void smrtptr_throw_bad_alloc(char *alloc_type, char *smrtptr_h_fcn) {\n\
 #endif\n\
 // smrtptr stores ptr passed as arg to be freed atexit\n\
 void smrtptr(void *ptr) {\n\
-  // free ptrs atexit\n\
-  atexit(smrtptr_free_all);\n\
-  // malloc garbage collector\n\
-  if(SMRTPTR_GC.len == -1) {\n\
-    SMRTPTR_GC.ptrs = malloc(sizeof(void *) * 10);\n\
-    if(!SMRTPTR_GC.ptrs) {\n\
-      fprintf(stderr, \"\\n-:- \\033[1m\\033[31mERROR\\033[0m COULDN'T MALLOC MEMORY TO INITIALIZE SMRTPTR.H'S GARBAGE COLLECTOR -:-\\n\\n\");\n\
-      exit(EXIT_FAILURE);\n\
-    }\n\
-    SMRTPTR_GC.max = 10, SMRTPTR_GC.len = 0;\n\
+  struct SMRTPTR_GARBAGE_COLLECTOR *gc;\n\
+  long i;\n\
+  if(!ptr) return;\n\
+  gc = smrtptr_shard(ptr);\n\
+  smrtptr_lock(gc);\n\
+  // double the slots if adding ptr would fill over 3/4 of them\n\
+  if(4 * (gc->len + 1) > 3 * gc->max) smrtptr_rehash(gc, gc->max ? gc->max * 2 : 16);\n\
+  // add ptr to the garbage collector if not already present (ensures no double-freeing)\n\
+  i = smrtptr_find(gc, ptr);\n\
+  if(gc->ptrs[i] != ptr) {\n\
+    gc->ptrs[i] = ptr, gc->len++;\n\
+    // printf(\"SMART POINTER #%ld STORED!\\n\", gc->len); // optional\n\
+  }\n\
+  smrtptr_unlock(gc);\n\
+}\n\
+// hints \"n\" more ptrs will be stored, growing the garbage collector once up front\n\
+void smrtptr_reserve(size_t n) {\n\
+  struct SMRTPTR_GARBAGE_COLLECTOR *gc = SMRTPTR_GC;\n\
+  long max, s = 0;\n\
+  if(n > ((size_t)-1) >> 4) smrtptr_throw_bad_alloc(\"RESERVE\", \"GARBAGE COLLECTOR\");\n\
+  smrtptr_shard(NULL); // initialize garbage collector\n\
+  n = (n + SMRTPTR_SHARDS - 1) / SMRTPTR_SHARDS; // ptrs spread evenly across shards\n\
+  for(; s < SMRTPTR_SHARDS; ++s, ++gc) {\n\
+    smrtptr_lock(gc);\n\
+    for(max = gc->max ? gc->max : 16; 4 * (gc->len + (long)n) > 3 * max; max *= 2);\n\
+    if(max > gc->max) smrtptr_rehash(gc, max);\n\
+    smrtptr_unlock(gc);\n\
   }\n\
-  // reallocate if \"max\" ptrs already added\n\
-  if(SMRTPTR_GC.len == SMRTPTR_GC.max) {\n\
-    SMRTPTR_GC.max *= SMRTPTR_GC.max;\n\
-    void **SMRTPTR_TEMP = realloc(SMRTPTR_GC.ptrs, sizeof(void *) * SMRTPTR_GC.max);\n\
-    if(!SMRTPTR_TEMP) smrtptr_throw_bad_alloc(\"REALLOC\", \"GARBAGE COLLECTOR\");\n\
-    SMRTPTR_GC.ptrs = SMRTPTR_TEMP;\n\
+}\n\
+// returns the 1st byte of chunk to bump-allocate from (16-byte aligned)\n\
+static char *smrtarena_bytes(struct SMRTARENA_CHUNK *chunk) {\n\
+  return (char *)chunk + ((sizeof(struct SMRTARENA_CHUNK) + 15) & ~(size_t)15);\n\
+}\n\
+// bump-allocates \"size\" bytes from region, prefixed by \"size\" (for smrtrealloc)\n\
+static void *smrtarena_alloc(struct SMRTARENA_REGION *region, size_t size) {\n\
+  struct SMRTARENA_CHUNK *chunk = region->chunks;\n\
+  size_t need = ((size + 15) & ~(size_t)15) + 16, max;\n\
+  if(size > ((size_t)-1) >> 2) smrtptr_throw_bad_alloc(\"BUMP-ALLOCATE\", \"ARENA\");\n\
+  if(!chunk || chunk->max - chunk->len < need) { // add a chunk twice the size of the last\n\
+    for(max = chunk ? chunk->max * 2 : 4096; max < need; max *= 2);\n\
+    chunk = malloc(((sizeof(struct SMRTARENA_CHUNK) + 15) & ~(size_t)15) + max);\n\
+    if(!chunk) smrtptr_throw_bad_alloc(\"MALLOC\", \"ARENA\");\n\
+    smrtptr(chunk);\n\
+    chunk->prev = region->chunks, chunk->len = 0, chunk->max = max;\n\
+    region->chunks = chunk;\n\
   }\n\
-  // add ptr to SMRTPTR_GC if not already present (ensures no double-freeing)\n\
-  int i = 0;\n\
-  for(; i < SMRTPTR_GC.len; ++i) if(SMRTPTR_GC.ptrs[i] == ptr) return;\n\
-  SMRTPTR_GC.ptrs[SMRTPTR_GC.len++] = ptr;\n\
-  // printf(\"SMART POINTER #%ld STORED!\\n\", SMRTPTR_GC.len); // optional\n\
+  size_t *block = (size_t *)(smrtarena_bytes(chunk) + chunk->len);\n\
+  chunk->len += need;\n\
+  *block = size;\n\
+  return (char *)block + 16;\n\
+}\n\
+// returns the open region ptr was bumped from (NULL if not an arena ptr)\n\
+static struct SMRTARENA_REGION *smrtarena_owner(void *ptr) {\n\
+  struct SMRTARENA_REGION *region = SMRTARENA;\n\
+  struct SMRTARENA_CHUNK *chunk;\n\
+  for(; region; region = region->outer)\n\
+    for(chunk = region->chunks; chunk; chunk = chunk->prev)\n\
+      if((char *)ptr >= smrtarena_bytes(chunk) && (char *)ptr < smrtarena_bytes(chunk) + chunk->len) return region;\n\
+  return NULL;\n\
+}\n\
+// opens a region: smrtmalloc/smrtcalloc bump-allocate from it until the matching smrtarena_end\n\
+void smrtarena_begin(void) {\n\
+  struct SMRTARENA_REGION *region = malloc(sizeof(struct SMRTARENA_REGION));\n\
+  if(!region) smrtptr_throw_bad_alloc(\"MALLOC\", \"SMRTARENA_BEGIN FUNCTION\");\n\
+  smrtptr(region);\n\
+  region->outer = SMRTARENA, region->chunks = NULL;\n\
+  SMRTARENA = region;\n\
 }\n\
 // malloc's a pointer, stores it in the garbage collector, then returns ptr\n\
 void *smrtmalloc(size_t alloc_size) {\n\
+  if(SMRTARENA) return smrtarena_alloc(SMRTARENA, alloc_size);\n\
   void *smtr_malloced_ptr = malloc(alloc_size);\n\
   if(smtr_malloced_ptr == NULL) smrtptr_throw_bad_alloc(\"MALLOC\", \"SMRTMALLOC FUNCTION\");\n\
   smrtptr(smtr_malloced_ptr);\n\
@@ -520,6 +1172,10 @@ void *smrtmalloc(size_t alloc_size) {\n\
 }\n\
 // calloc's a pointer, stores it in the garbage collector, then returns ptr\n\
 void *smrtcalloc(size_t alloc_num, size_t alloc_size) {\n\
+  if(SMRTARENA) {\n\
+    if(alloc_size && alloc_num > ((size_t)-1) / alloc_size) smrtptr_throw_bad_alloc(\"CALLOC\", \"SMRTCALLOC FUNCTION\");\n\
+    return memset(smrtarena_alloc(SMRTARENA, alloc_num * alloc_size), 0, alloc_num * alloc_size);\n\
+  }\n\
   void *smtr_calloced_ptr = calloc(alloc_num, alloc_size);\n\
   if(smtr_calloced_ptr == NULL) smrtptr_throw_bad_alloc(\"CALLOC\", \"SMRTCALLOC FUNCTION\");\n\
   smrtptr(smtr_calloced_ptr);\n\
@@ -528,17 +1184,28 @@ void *smrtcalloc(size_t alloc_num, size_t alloc_size) {\n\
 // realloc's a pointer, stores it anew in the garbage collector, then returns ptr\n\
 // compatible both \"smart\" & \"dumb\" ptrs!\n\
 void *smrtrealloc(void *ptr, size_t realloc_size) {\n\
-  int i = 0;\n\
+  struct SMRTPTR_GARBAGE_COLLECTOR *gc = smrtptr_shard(ptr);\n\
   void *smtr_realloced_ptr;\n\
+  long i;\n\
   // realloc a \"smart\" ptr already in garbage collector\n\
-  for(; i < SMRTPTR_GC.len; ++i)\n\
-    if(SMRTPTR_GC.ptrs[i] == ptr) {\n\
-      smtr_realloced_ptr = realloc(ptr, realloc_size); // frees ptr in garbage collector\n\
-      if(smtr_realloced_ptr == NULL) smrtptr_throw_bad_alloc(\"REALLOC\", \"SMRTREALLOC FUNCTION\");\n\
-      SMRTPTR_GC.ptrs[i] = smtr_realloced_ptr; // point freed ptr at realloced address\n\
-      // printf(\"SMART POINTER REALLOC'D!\\n\"); // optional\n\
-      return smtr_realloced_ptr;\n\
-    }\n\
+  smrtptr_lock(gc);\n\
+  if(ptr && gc->len > 0 && gc->ptrs[i = smrtptr_find(gc, ptr)] == ptr) {\n\
+    smtr_realloced_ptr = realloc(ptr, realloc_size); // frees ptr in garbage collector\n\
+    if(smtr_realloced_ptr == NULL) smrtptr_throw_bad_alloc(\"REALLOC\", \"SMRTREALLOC FUNCTION\");\n\
+    if(smtr_realloced_ptr != ptr) smrtptr_unslot(gc, i); // rekey freed ptr to realloced address\n\
+    smrtptr_unlock(gc);\n\
+    if(smtr_realloced_ptr != ptr) smrtptr(smtr_realloced_ptr);\n\
+    // printf(\"SMART POINTER REALLOC'D!\\n\"); // optional\n\
+    return smtr_realloced_ptr;\n\
+  }\n\
+  smrtptr_unlock(gc);\n\
+  // bump-allocate a NULL or arena ptr anew in its region (its old block is freed by smrtarena_end)\n\
+  struct SMRTARENA_REGION *region;\n\
+  if(SMRTARENA && (!ptr || (region = smrtarena_owner(ptr)))) {\n\
+    if(!ptr) return smrtarena_alloc(SMRTARENA, realloc_size);\n\
+    if(realloc_size <= *(size_t *)((char *)ptr - 16)) return ptr;\n\
+    return memcpy(smrtarena_alloc(region, realloc_size), ptr, *(size_t *)((char *)ptr - 16));\n\
+  }\n\
   // realloc a \"dumb\" ptr then add it to garbage collector\n\
   smtr_realloced_ptr = realloc(ptr, realloc_size);\n\
   if(smtr_realloced_ptr == NULL) smrtptr_throw_bad_alloc(\"REALLOC\", \"SMRTREALLOC FUNCTION\");\n\
@@ -547,283 +1214,1817 @@ void *smrtrealloc(void *ptr, size_t realloc_size) {\n\
 }\n\
 // prematurely frees ptr arg prior to atexit (if exists)\n\
 void smrtfree(void *ptr) {\n\
-  int i = 0, j;\n\
-  for(; i < SMRTPTR_GC.len; ++i) // find ptr in garbage collector\n\
-    if(SMRTPTR_GC.ptrs[i] == ptr) {\n\
-      free(ptr);\n\
-      for(j = i; j < SMRTPTR_GC.len - 1; ++j) // shift ptrs down\n\
-        SMRTPTR_GC.ptrs[j] = SMRTPTR_GC.ptrs[j + 1];\n\
-      SMRTPTR_GC.len--;\n\
-      // printf(\"SMART POINTER FREED!\\n\"); // optional\n\
-      return;\n\
-    }\n\
+  struct SMRTPTR_GARBAGE_COLLECTOR *gc;\n\
+  long i = -1;\n\
+  if(!ptr) return;\n\
+  gc = smrtptr_shard(ptr);\n\
+  smrtptr_lock(gc);\n\
+  if(gc->len > 0 && gc->ptrs[i = smrtptr_find(gc, ptr)] == ptr) smrtptr_unslot(gc, i); // find ptr in garbage collector\n\
+  else i = -1;\n\
+  smrtptr_unlock(gc);\n\
+  if(i == -1) return;\n\
+  free(ptr);\n\
+  // printf(\"SMART POINTER FREED!\\n\"); // optional\n\
+}\n\
+// closes the innermost region, freeing all it allocated at once (its ptrs needn't be smrtfree'd)\n\
+void smrtarena_end(void) {\n\
+  struct SMRTARENA_REGION *region = SMRTARENA;\n\
+  struct SMRTARENA_CHUNK *chunk, *prev;\n\
+  if(!region) return;\n\
+  for(chunk = region->chunks; chunk; chunk = prev) prev = chunk->prev, smrtfree(chunk);\n\
+  SMRTARENA = region->outer;\n\
+  smrtfree(region);\n\
 }\n\
 #endif\n\
 /******************************* SMRTPTR.H END *******************************/";
+#ifndef DECLASS_LIBRARY
+// smrtptr.h's declarations, for "--split-headers" header files (its definitions stay in the main file)
+static const char DC_SMART_POINTER_DECLS_[] = "\
+#ifndef SMRTPTR_H_ // smrtptr.h's declarations (defined wherever smrtptr.h itself is inlined)\n\
+#include <stdio.h>\n\
+#include <stdlib.h>\n\
+void smrtptr(void *ptr);\n\
+void smrtptr_reserve(size_t n);\n\
+void *smrtmalloc(size_t alloc_size);\n\
+void *smrtcalloc(size_t alloc_num, size_t alloc_size);\n\
+void *smrtrealloc(void *ptr, size_t realloc_size);\n\
+void smrtfree(void *ptr);\n\
+void smrtarena_begin(void);\n\
+void smrtarena_end(void);\n\
+#ifndef DECLASS_NDEBUG\n\
+#define smrtassert(condition) ({\\\n\
+  if(!(condition)) {\\\n\
+    fprintf(stderr, \"\\n\\033[1m\\033[31mERROR\\033[0m Smart Assertion failed: (%s), function %s, file %s,\
+ line %d.\\n\", #condition, __func__, __FILE__, __LINE__);\\\n\
+    fprintf(stderr, \">> Freeing Allocated Smart Pointers & Terminating Program.\\n\\n\");\\\n\
+    exit(EXIT_FAILURE);\\\n\
+  }\\\n\
+})\n\
+#else\n\
+#define smrtassert(condition)\n\
+#endif\n\
+#endif\n";
+#endif
 
 /******************************************************************************
 * MAIN EXECUTION
 ******************************************************************************/
 
+#ifndef DECLASS_LIBRARY
 int main(int argc, char *argv[]) {
-  // confirm passed .c file in cmd line arg to declass
-  if(argc<2 || argc>6 || argv[argc-1][strlen(argv[argc-1])-2] != '.' || 
-    (argv[argc-1][strlen(argv[argc-1])-1] != 'c' && argv[argc-1][strlen(argv[argc-1])-1] != 'C'))
-    declass_missing_Cfile_alert();
-  // process cmd line flags: 1) determine if displaying class info at exit: "-l"
-  //                         2) determine if not to compile: "-no-compile"
-  //                         3) determine if to save temp "pre-COLA" file: "-save-temps"
-  bool show_class_info = false, save_temp_files = false;
-  if(argc > 2)
-    for(int i = 1; i < argc - 1; ++i)
-      process_cmd_flag(argv[i], &show_class_info, &save_temp_files);
+  // process cmd line flags & collect the ".c" files to declassify: 1) displaying class info at exit: "-l"
+  //                                                                2) not to compile: "-no-compile"
+  //                                                                3) save temp "pre-COLA" file: "-save-temps"
+  //                                                                4) batch over "N" threads: "-j N"
+  //                                                                5) cache declassified files: "--cache-dir DIR"
+  //                                                                6) write make dependencies: "-MD" & "-MF FILE"
+  //                                                                7) split out headers: "--split-headers"
+  //                                                                8) shared runtime: "--runtime=external"
+  //                                                                9) server: "--serve SOCK" & "--connect SOCK"
+  //                                                               10) precompile headers: "--precompile DECLASS_H_x.h"
+  //                                                               11) stdin to stdout: "-"
+  //                                                               12) build profiles: "--profile=NAME" & "--pgo CMD"
+  struct cmd_flags flags = {false, false, false, false, 0, NULL, false, NULL, false, false, false, false, NULL, NULL, NULL};
+  char dflt_cache_dir[MAX_TOKEN_NAME_LENGTH * 4];
+  char **filenames = malloc(sizeof(char *) * argc);
+  int total_files, status;
+  if(filenames == NULL) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR CMD LINE FILES!\033[0m\n\n", __LINE__);
+    exit(EXIT_FAILURE);
+  }
+  if(argc == 3 && strcmp(argv[1], "--serve") == 0) return declass_serve(argv[2]);
+  if(argc > 2 && strcmp(argv[1], "--precompile") == 0) { // "--precompile DECLASS_H_x.h ..."
+    for(status = EXIT_SUCCESS, total_files = 2; total_files < argc; ++total_files)
+      if(precompile_DECLASS_H_header(argv[total_files]) != EXIT_SUCCESS) status = EXIT_FAILURE;
+    free(filenames);
+    return status;
+  }
+  bool connecting = (argc > 2 && strcmp(argv[1], "--connect") == 0); // flags are checked here, before reaching the server
+  if(connecting) total_files = parse_cmd_line_args(argc - 2, &argv[2], &flags, filenames, dflt_cache_dir);
+  else           total_files = parse_cmd_line_args(argc, argv, &flags, filenames, dflt_cache_dir);
+  if(total_files < 0 || (flags.from_stdin && (total_files > 0 || connecting))) declass_missing_Cfile_alert();
+  if(flags.from_stdin) {
+    free(filenames);
+    return declass_stdin(&flags);
+  }
+  if(flags.emit_runtime) emit_declass_runtime();
+  if(total_files == 0 && flags.emit_runtime) return EXIT_SUCCESS; // only writing the runtime
+  if(total_files == 0 || (total_files > 1 && flags.deps_filename != NULL)) declass_missing_Cfile_alert(); // 1 "-MF" file per ".c" file
+
+  if(connecting)
+    status = declass_connect(argv[2], argc - 3, &argv[3]);
+  else if(total_files == 1 && flags.jobs == 0)
+    status = declass_file(filenames[0], &flags, stdout, stderr);
+  else
+    status = declass_batch(filenames, total_files, &flags, stdout, stderr);
+  free(filenames);
+  return status;
+}
 
+/******************************************************************************
+* CMD LINE FILE & BATCH DECLASSIFICATION FUNCTIONS
+******************************************************************************/
+
+// sets "flags" & collects the ".c" files in "argv" (past "argv[0]") into "filenames". returns the number of
+// files, or -1 if a flag was misused. "--cache" stores its dflt dir in "dflt_cache_dir"
+static int parse_cmd_line_args(int argc, char *argv[], struct cmd_flags *flags, char **filenames, char *dflt_cache_dir) {
+  int total_files = 0;
+  for(int i = 1; i < argc; ++i) {
+    if(is_C_file_name(argv[i])) {
+      filenames[total_files++] = argv[i];
+    } else if(strcmp(argv[i], "-") == 0) {
+      flags->from_stdin = true;
+    } else if(strncmp(argv[i], "-j", 2) == 0) { // "-j N" or "-jN"
+      char *jobs = (argv[i][2] != '\0') ? &argv[i][2] : (i + 1 < argc) ? argv[++i] : "";
+      if((flags->jobs = atoi(jobs)) < 1) return -1;
+    } else if(strncmp(argv[i], "--cache-dir", 11) == 0) { // "--cache-dir DIR" or "--cache-dir=DIR"
+      flags->cache_dir = (argv[i][11] == '=') ? &argv[i][12] : (argv[i][11] == '\0' && i + 1 < argc) ? argv[++i] : "";
+      if(*flags->cache_dir == '\0') return -1;
+    } else if(strcmp(argv[i], "--cache") == 0) { // dflt cache dir
+      char *xdg_cache = getenv("XDG_CACHE_HOME"), *home = getenv("HOME");
+      if(xdg_cache != NULL && *xdg_cache != '\0')
+        snprintf(dflt_cache_dir, MAX_TOKEN_NAME_LENGTH * 4, "%s/%s", xdg_cache, DFLT_CACHE_DIR);
+      else
+        snprintf(dflt_cache_dir, MAX_TOKEN_NAME_LENGTH * 4, "%s/.cache/%s", (home != NULL) ? home : ".", DFLT_CACHE_DIR);
+      flags->cache_dir = dflt_cache_dir;
+    } else if(strncmp(argv[i], "--pgo", 5) == 0) { // "--pgo CMD" or "--pgo=CMD"
+      flags->pgo_training_cmd = (argv[i][5] == '=') ? &argv[i][6] : (argv[i][5] == '\0' && i + 1 < argc) ? argv[++i] : "";
+      if(*flags->pgo_training_cmd == '\0') return -1;
+    } else if(strncmp(argv[i], "-MF", 3) == 0) { // "-MF FILE" or "-MFFILE" (implies "-MD")
+      flags->deps_filename = (argv[i][3] != '\0') ? &argv[i][3] : (i + 1 < argc) ? argv[++i] : "";
+      if(*flags->deps_filename == '\0') return -1;
+      flags->make_deps = true;
+    } else if(!process_cmd_flag(argv[i], flags)) {
+      return -1;
+    }
+  }
+  return total_files;
+}
+
+// whether cmd line arg "arg" names a ".c" file
+static bool is_C_file_name(char *arg) {
+  int len = strlen(arg);
+  return len > 2 && arg[len-2] == '.' && (arg[len-1] == 'c' || arg[len-1] == 'C');
+}
+
+// declassifies, COLA overloads, & compiles (as flagged) "file_name" w/ its own state, reporting to
+// "out" & "err". returns the status declass.c would've exited with (fatal errors end only this file)
+static int declass_file(char *file_name, struct cmd_flags *flags, FILE *out, FILE *err) {
+  jmp_buf fatal_error_exit;
+  struct declass_state *state = new_declass_state();
+  int status;
+  if(state == NULL) {
+    fprintf(err, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR DECLASSIFICATION STATE!\033[0m\n\n", __LINE__);
+    return EXIT_FAILURE;
+  }
+  state->fatal_error_exit = &fatal_error_exit;
+  state->interactive = (flags->jobs == 0); // batched files can't prompt the user
+  state->out = out, state->err = err;
+  state->NO_COMPILE = flags->no_compile;
+  state->MORTAL_ERRORS = flags->mortal_errors;
+  state->SPLIT_HEADERS = flags->split_headers;
+  state->EXTERNAL_RUNTIME = flags->external_runtime;
+  state->cache_header_parses = PARSED_HEADERS.caching;
+  state->working_dir = flags->working_dir;
+  DC = state;
+  if(setjmp(fatal_error_exit) == 0) declass_file_main_execution(file_name, flags);
+  status = state->exit_status;
+  DC = NULL;
+  free_declass_state(state);
+  return status;
+}
+
+// declassifies "file_name" under the current thread's "DC" state
+static void declass_file_main_execution(char *file_name, struct cmd_flags *flags) {
   // old & new file buffers, as well as filename
-  char file_contents[MAX_FILESIZE], NEW_FILE[MAX_FILESIZE];
+  struct string_builder FILE_BUFFER = {NULL, 0, 0};
   char filename[MAX_TOKEN_NAME_LENGTH], original_filename_executable[MAX_TOKEN_NAME_LENGTH];
-  FLOOD_ZEROS(file_contents, MAX_FILESIZE); FLOOD_ZEROS(NEW_FILE, MAX_FILESIZE);
   FLOOD_ZEROS(filename, MAX_TOKEN_NAME_LENGTH); FLOOD_ZEROS(original_filename_executable, MAX_TOKEN_NAME_LENGTH);
-  strcpy(filename, argv[argc-1]);
+  // "filename" later holds the longest derived name, "<filename>_DECLASS_PRECOLA.c" (only
+  // written to disk w/ "-save-temps" or "-no-cola", but always handed to COLA to name its output)
+  if(strlen(file_name) + strlen("_DECLASS_PRECOLA") >= MAX_TOKEN_NAME_LENGTH) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m FILE PATH \"%s\" EXCEEDS %d CHARACTERS!\033[0m\n\n",
+      __LINE__, file_name, MAX_TOKEN_NAME_LENGTH - (int)strlen("_DECLASS_PRECOLA") - 1);
+    declass_exit(EXIT_FAILURE);
+  }
+  strcpy(filename, file_name);
   confirm_valid_file(filename);
   strcpy(original_filename_executable, filename);
   NEW_EXTENSION(original_filename_executable, ""); // remove ".c" from executable file's name
 
-  FSCRAPE(file_contents, filename);
-  char filler_array_argument[MAX_WORDS_PER_METHOD][MAX_TOKEN_NAME_LENGTH];
-  int i = 0, j = 0;
-  bool in_a_string = false, in_a_char = false, in_token_scope = true;
   bool found_COLA_overloads = false;
+  char declass_filename[MAX_TOKEN_NAME_LENGTH + 16];
+  sprintf(declass_filename, "%s_DECLASS.c", original_filename_executable);
+  struct string_builder extra_sources = {NULL, 0, 0}; // split-out headers & runtime to also compile
+  sb_append(&extra_sources, "");
+
+  // key cached declassifications by declass.c's version, the filename (shown in the output's
+  // banner), & the file's source + its headers (thus also any "#define DECLASS_*" flags).
+  // "--split-headers" writes several files per declassification, thus isn't cached
+  bool caching = (flags->cache_dir != NULL && !flags->split_headers);
+  if(caching) {
+    DC->hash_sources = true;
+    DC->cache_key[0] = CACHE_KEY_FNV_OFFSET, DC->cache_key[1] = CACHE_KEY_MIX_OFFSET;
+    cache_key_add(declass_version_key(), strlen(declass_version_key()));
+    cache_key_add(filename, strlen(filename));
+    char *runtime_flag = flags->external_runtime ? "--runtime=external" : "--runtime=inline";
+    cache_key_add(runtime_flag, strlen(runtime_flag));
+  }
 
-  char dummy_ctor_invoking_obj_chain[MAX_TOKEN_NAME_LENGTH * 2], *read, *write;
-  bool dummy_ctor_ptr_invoked, dummy_ctor_invoker_redefined;
-  int dummy_ctor_len;
-  FLOOD_ZEROS(dummy_ctor_invoking_obj_chain, MAX_TOKEN_NAME_LENGTH * 2);
-
-  // remove commments from program: ensures braces applied properly & reduces size
-  whitespace_all_comments(file_contents);
-  trim_sequential_spaces(file_contents);
-  // confirm user didn't use "DC_" to prefix any token names
-  confirm_no_reserved_DC_prefix(file_contents);
-  // check for & scrape any "#include"'d "DECLASS_H_" header files & prepend them to "file_contents"
-  scrape_and_include_all_DECLASS_H_headers(file_contents);
+  // scrape the file & any "#include"'d "DECLASS_H_" header files, cleaning each once (removes comments,
+  // trims redundant whitespace, & confirms no "DC_" prefixed token names), then prepend the headers &
   // wrap braces around single-line "braceless" if, else if, else, while, & for loops
-  add_braces(file_contents);
+  scrape_and_include_all_DECLASS_H_headers(filename, &FILE_BUFFER);
   // simulate as if "#define DECLASS_NCOMPILE" were found if command processor DNE
   confirm_command_processor_exists_for_autonomous_compilation(__LINE__);
-  // uncomment smrtptr.h's alerts if user included "#define DECLASS_NOISYSMRTPTR"
-  if(*SMRT_PTRS && *NOISY_SMRTPTR) enable_smrtptr_alerts();
 
-  while(file_contents[i] != '\0') {
-    // don't modify anything in strings
-    account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, &file_contents[i]);
+  // reuse a cached declassification if found ("-l" & "-save-temps" need the full pipeline's output)
+  if(caching && !flags->show_class_info && !flags->save_temp_files
+    && fetch_cached_declassification(flags->cache_dir, declass_filename)) {
+    sb_free(&FILE_BUFFER);
+    declass_DECLASSIFIED_ascii_art();
+    fprintf(DC_STDOUT, "%s \033[1m==CACHED=>\033[0m %s", filename, declass_filename);
+    strcpy(filename, declass_filename);
+  } else {
+    declassify_and_cola_overload(&FILE_BUFFER, filename, flags, &found_COLA_overloads);
+    if(caching) store_declassification_in_cache(flags->cache_dir, declass_filename);
+    if(flags->split_headers) split_out_DECLASS_H_headers(declass_filename, &extra_sources);
+  }
+  if(flags->external_runtime && !DC->NO_COMPILE) link_declass_runtime(&extra_sources);
+  if(flags->make_deps) write_make_dependencies(flags->deps_filename, declass_filename, file_name);
+  compile_and_report_declassified_file(filename, original_filename_executable, flags, found_COLA_overloads, extra_sources.str);
+  sb_free(&extra_sources);
+}
 
-    // store class info & convert to structs calling external fcns
-    if(in_token_scope && is_at_substring(&file_contents[i], "class ") && (!VARCHAR(file_contents[i-1]))) 
-      i += parse_class(&file_contents[i], NEW_FILE, &j);
+// declassifies the braced & header-prepended "FILE_BUFFER" of "filename" & passes it to "cola.c" (unless
+// disabled), writing "<filename>_DECLASS.c" & leaving "filename" as the file to compile
+static void declassify_and_cola_overload(struct string_builder *FILE_BUFFER, char *filename, struct cmd_flags *flags, bool *found_COLA_overloads) {
+  struct string_builder HEADED_NEW_FILE = {NULL, 0, 0};
+  char original_filename_executable[MAX_TOKEN_NAME_LENGTH];
+  strcpy(original_filename_executable, filename);
+  NEW_EXTENSION(original_filename_executable, "");
+  declassify(FILE_BUFFER, filename, &HEADED_NEW_FILE);
+  sb_free(FILE_BUFFER);
 
-    // store declared class object info
-    bool dummy_ctor = false;
-    for(int k = 0; in_token_scope && k < total_classes; ++k)
-      if(is_at_substring(&file_contents[i], classes[k].class_name) 
-        && !VARCHAR(file_contents[i+strlen(classes[k].class_name)]) && !VARCHAR(file_contents[i-1]))
-        if(store_object_info(&file_contents[i], 0, &dummy_ctor)) { // assign default values
+  // notify user declassification conversion completed
+  declass_DECLASSIFIED_ascii_art();
+  fprintf(DC_STDOUT, "%s \033[1m==DECLASSIFIED=>\033[0m ", filename);
+  if(DC->NO_COLA_PARSER) 
+    NEW_EXTENSION(filename, "_DECLASS.c");
+  else
+    NEW_EXTENSION(filename, "_DECLASS_PRECOLA.c");
+  // name the pre-COLA file only if it's written out (else cola.c's "_DECLASS.c" output)
+  if(DC->NO_COLA_PARSER || flags->save_temp_files) fprintf(DC_STDOUT, "%s", filename);
+  else                                             fprintf(DC_STDOUT, "%s_DECLASS.c", original_filename_executable);
+  if(flags->show_class_info || !DC->NO_COLA_PARSER || DC->NO_COMPILE) 
+    fprintf(DC_STDOUT, "\n=================================================================================");
+  if(flags->show_class_info || !DC->NO_COLA_PARSER) fprintf(DC_STDOUT, "\n");
 
-          // check if a so-called "dummy ctor" was detected and splice 
-          // in the "DC__DUMMY_" class/ctor name's prefix if so
-          if(dummy_ctor) {
-            read = &file_contents[i], write = &NEW_FILE[j], dummy_ctor_ptr_invoked = dummy_ctor_invoker_redefined = false;
-            FLOOD_ZEROS(dummy_ctor_invoking_obj_chain, MAX_TOKEN_NAME_LENGTH * 2);
-            // flag the object to be destroyed again after being assigned to a dummy ctor (being that they're a new obj instance)
-            get_dummy_ctor_invoking_object_chain(read, dummy_ctor_invoking_obj_chain, k, &dummy_ctor_ptr_invoked, &dummy_ctor_invoker_redefined);
-            dummy_ctor_len = prefix_dummy_ctor_with_DC__DUMMY_(write, read);
-            j = strlen(NEW_FILE), i += dummy_ctor_len;
-            // As per Documentation's "DECLASS.C CTORS & DTORS" > "FORMATTING" > "(2)", dummy ctors only 
-            // return single obj instances, thus "obj arrays" are presumed to be assigning one of their
-            // individual object "cells" w/in.
-            add_object_dtor(&file_contents[i], true, dummy_ctor_invoker_redefined); 
-            if(dummy_ctor_invoker_redefined) { // Don't add for new declarations
-              if(dummy_ctor_ptr_invoked)
-                sprintf(&NEW_FILE[j], ";if(%s){%s->DC_DTR=&DC__NDTR;}", dummy_ctor_invoking_obj_chain, dummy_ctor_invoking_obj_chain);
-              else if(dummy_ctor_invoker_redefined)
-                sprintf(&NEW_FILE[j], ";%s.DC_DTR=&DC__NDTR", dummy_ctor_invoking_obj_chain);
-              j = strlen(NEW_FILE);
-            }
-            break;
-          }
+  // write newly converted/declassified file (cola.c is handed it in memory, w/ "-save-temps" still writing it out)
+  if(DC->NO_COLA_PARSER || flags->save_temp_files) FPUT(HEADED_NEW_FILE.str, HEADED_NEW_FILE.len, filename);
+
+  // if passing to "cola.c"
+  if(!DC->NO_COLA_PARSER) {
+    fprintf(DC_STDOUT, "\033[1m >> RUNNING COLA.C:\033[0m\n=================================================================================\n");
+    *found_COLA_overloads = COLA_C_main_execution(flags->show_class_info, filename, &HEADED_NEW_FILE, flags->save_temp_files);
+  }
+  sb_free(&HEADED_NEW_FILE);
+  publish_parsed_DECLASS_H_headers(); // cola.c's done recording their registration
+
+  // if compiling & cola-overloaded
+  if(!DC->NO_COLA_PARSER && !DC->NO_COMPILE) {
+    // cola.c creates a new file w/ the original filename + "_DECLASS.c" on success
+    FLOOD_ZEROS(filename, MAX_TOKEN_NAME_LENGTH);
+    sprintf(filename, "%s_DECLASS.c", original_filename_executable);
+  }
+
+  // show "-l" flag class info
+  if(flags->show_class_info) show_l_flag_data();
+}
+
+// compiles the declassified "filename" (& any split-out headers or runtime in "extra_sources")
+// into "original_filename_executable" (if applicable/able) & signs off
+static void compile_and_report_declassified_file(char *filename, char *original_filename_executable, struct cmd_flags *flags, bool found_COLA_overloads, char *extra_sources) {
+  // generate compilation cmd (w/ any "--profile=" flags, & "--pgo"'s dflt profile)
+  struct string_builder compile_cmd = {NULL, 0, 0};
+  const struct build_profile *profile = (flags->profile == NULL && flags->pgo_training_cmd != NULL) ? PGO_DFLT_PROFILE : flags->profile;
+  if(!DC->NO_COMPILE)
+    sb_printf(&compile_cmd, "gcc%s%s%s%s -o %s %s%s", DC->NO_C11_COMPILE_FLAG ? "" : " -std=c11", (profile != NULL) ? " " : "",
+      (profile != NULL) ? profile->cflags : "", !DC->THREADSAFE_SMRTPTR ? "" : DC->EXTERNAL_RUNTIME ? " -pthread -DDECLASS_THREADSAFE=" : " -pthread",
+      original_filename_executable, filename, extra_sources);
+  if(!DC->NO_COMPILE) {
+    fprintf(DC_STDOUT, "\n=================================================================================\n");
+    fprintf(DC_STDOUT, "%s \033[1m=GCC=COMPILES=TO=>\033[0m %s", filename, original_filename_executable);
+    fprintf(DC_STDOUT, "\n=================================================================================\n");
+  }
+  if(!DC->NO_COMPILE && flags->pgo_training_cmd != NULL) {
+    compile_with_pgo(compile_cmd.str, original_filename_executable, flags->pgo_training_cmd);
+  } else if(!DC->NO_COMPILE) { 
+    fprintf(DC_STDOUT, "\033[1mCOMPILING CONVERTED CODE:\033[0m\n  $ %s", compile_cmd.str);
+    fprintf(DC_STDOUT, "\n=================================================================================\n");
+    compile_declassified_file(compile_cmd.str); // compile the declassified/converted code
+  }
+  sb_free(&compile_cmd);
+  
+  // Based on prior '=' sign divider output
+  if((DC->NO_COMPILE && flags->show_class_info) || (DC->NO_COMPILE && !flags->show_class_info && !found_COLA_overloads && !DC->NO_COLA_PARSER)) 
+    fprintf(DC_STDOUT, "\n=============================\n");
+  else if(DC->NO_COMPILE && !flags->show_class_info && !found_COLA_overloads && DC->NO_COLA_PARSER)
+    fprintf(DC_STDOUT, "\n");
+  fprintf(DC_STDOUT, " >> Terminating Declassifier.\n");
+  fprintf(DC_STDOUT, "=============================\n\n");
+}
+
+// compiles the declassified file via "compile_cmd", copying gcc's output into the file's buffered
+// report if batched (so it isn't interleaved w/ other files' reports). returns the cmd's exit status
+static int compile_declassified_file(char *compile_cmd) {
+  if(DC->out == stdout && DC->working_dir == NULL) return system(compile_cmd);
+  struct string_builder piped_compile_cmd = {NULL, 0, 0};
+  char gcc_output[512];
+  if(DC->working_dir != NULL) { // run from the "--serve" request's working directory
+    sb_append(&piped_compile_cmd, "cd '");
+    for(char *p = DC->working_dir; *p != '\0'; ++p)
+      if(*p == '\'') sb_append(&piped_compile_cmd, "'\\''");
+      else sb_putc(&piped_compile_cmd, *p);
+    sb_append(&piped_compile_cmd, "' 2>&1 && ");
+  }
+  sb_printf(&piped_compile_cmd, "%s 2>&1", compile_cmd);
+  FILE *gcc = popen(piped_compile_cmd.str, "r");
+  sb_free(&piped_compile_cmd);
+  if(gcc == NULL) return -1;
+  for(size_t n; (n = fread(gcc_output, 1, sizeof(gcc_output), gcc)) > 0;) fwrite(gcc_output, 1, n, DC->out);
+  return pclose(gcc);
+}
+
+// "--pgo": compiles "compile_cmd" instrumented, runs "training_cmd" to profile "executable", then
+// recompiles it w/ the profile (or w/o if training failed) from "<executable>_pgo"
+static void compile_with_pgo(char *compile_cmd, char *executable, char *training_cmd) {
+  struct string_builder pgo_cmd = {NULL, 0, 0};
+  char profile_dir[MAX_TOKEN_NAME_LENGTH + 8];
+  sprintf(profile_dir, "%s" PGO_PROFILE_DIR, executable);
+  clear_pgo_profile_dir(profile_dir);
+  sb_printf(&pgo_cmd, "%s -fprofile-generate=%s", compile_cmd, profile_dir);
+  fprintf(DC_STDOUT, "\033[1mCOMPILING INSTRUMENTED CODE (PGO 1/3):\033[0m\n  $ %s", pgo_cmd.str);
+  fprintf(DC_STDOUT, "\n=================================================================================\n");
+  if(compile_declassified_file(pgo_cmd.str) != 0) {
+    sb_free(&pgo_cmd);
+    return;
+  }
+  fprintf(DC_STDOUT, "\033[1mTRAINING PROFILE (PGO 2/3):\033[0m\n  $ %s", training_cmd);
+  fprintf(DC_STDOUT, "\n=================================================================================\n");
+  fflush(DC_STDOUT);
+  sb_truncate(&pgo_cmd, 0);
+  if(compile_declassified_file(training_cmd) == 0) {
+    sb_printf(&pgo_cmd, "%s -fprofile-use=%s -fprofile-correction -Wno-missing-profile", compile_cmd, profile_dir);
+  } else {
+    fprintf(DC_STDERR, "\033[1mdeclass.c:%03d: \033[33mWARNING:\033[0m\033[1m PGO TRAINING CMD FAILED, COMPILING W/O A PROFILE!\033[0m\n", __LINE__);
+    sb_append(&pgo_cmd, compile_cmd);
+  }
+  fprintf(DC_STDOUT, "\033[1mCOMPILING PROFILE-GUIDED CODE (PGO 3/3):\033[0m\n  $ %s", pgo_cmd.str);
+  fprintf(DC_STDOUT, "\n=================================================================================\n");
+  compile_declassified_file(pgo_cmd.str);
+  sb_free(&pgo_cmd);
+}
+
+// "--pgo": rmvs any profile data left in "profile_dir" by a prior build, whose stale counts
+// would otherwise be merged into (or mismatch) the new profile
+static void clear_pgo_profile_dir(char *profile_dir) {
+  struct string_builder gcda_path = {NULL, 0, 0};
+  struct dirent *entry;
+  char resolved[PATH_MAX];
+  DIR *dir = opendir(profile_dir = resolve_path(profile_dir, resolved));
+  if(dir == NULL) return;
+  while((entry = readdir(dir)) != NULL) {
+    long len = strlen(entry->d_name);
+    if(len < 5 || strcmp(&entry->d_name[len-5], ".gcda") != 0) continue;
+    sb_truncate(&gcda_path, 0);
+    sb_printf(&gcda_path, "%s/%s", profile_dir, entry->d_name);
+    remove(gcda_path.str);
+  }
+  closedir(dir);
+  sb_free(&gcda_path);
+}
+
+// declassifies "filenames" over a pool of "flags->jobs" worker threads, reporting each file's
+// buffered output to "out" & "err" in the order given. returns EXIT_FAILURE if any file failed
+static int declass_batch(char **filenames, int total_files, struct cmd_flags *flags, FILE *out, FILE *err) {
+  struct batch batch = {NULL, total_files, 0, flags, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER};
+  int total_workers = (flags->jobs == 0) ? 1 : (flags->jobs < total_files) ? flags->jobs : total_files; // 1 if many files w/o "-j N"
+  int status = EXIT_SUCCESS, i;
+  pthread_t *workers = malloc(sizeof(pthread_t) * total_workers);
+  if(workers == NULL || (batch.files = calloc(total_files, sizeof(struct batch_file))) == NULL) {
+    fprintf(err, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR BATCH DECLASSIFICATION!\033[0m\n\n", __LINE__);
+    free(workers);
+    return EXIT_FAILURE;
+  }
+  for(i = 0; i < total_files; ++i) batch.files[i].filename = filenames[i];
+  if(total_files > 1) PARSED_HEADERS.caching = true; // files sharing "DECLASS_H_" headers reuse each's parse
+
+  // spawn the workers (any that can't be spawned leave their share to the rest, or to this thread if none were)
+  for(i = 0; i < total_workers; ++i)
+    if(pthread_create(&workers[i], NULL, batch_worker, &batch) != 0) break;
+  if((total_workers = i) == 0) batch_worker(&batch);
+
+  // report each file once done, in order
+  for(i = 0; i < total_files; ++i) {
+    struct batch_file *file = &batch.files[i];
+    pthread_mutex_lock(&batch.lock);
+    while(!file->done) pthread_cond_wait(&batch.file_done, &batch.lock);
+    pthread_mutex_unlock(&batch.lock);
+    if(file->out_len > 0) fwrite(file->out, 1, file->out_len, out);
+    if(file->err_len > 0) fwrite(file->err, 1, file->err_len, err);
+    fflush(out);
+    free(file->out), free(file->err);
+    if(file->status != EXIT_SUCCESS) status = EXIT_FAILURE;
+  }
+  for(i = 0; i < total_workers; ++i) pthread_join(workers[i], NULL);
+  free(workers);
+  free(batch.files);
+  return status;
+}
+
+// batch worker thread: declassifies the next unclaimed file into its buffered report until none remain
+static void *batch_worker(void *batch_ptr) {
+  struct batch *batch = batch_ptr;
+  for(int i; (i = __sync_fetch_and_add(&batch->next_file, 1)) < batch->total_files;) {
+    struct batch_file *file = &batch->files[i];
+    FILE *out = open_memstream(&file->out, &file->out_len), *err = open_memstream(&file->err, &file->err_len);
+    file->status = declass_file(file->filename, batch->flags, (out != NULL) ? out : stdout, (err != NULL) ? err : stderr);
+    if(out != NULL) fclose(out);
+    if(err != NULL) fclose(err);
+    pthread_mutex_lock(&batch->lock);
+    file->done = true;
+    pthread_cond_signal(&batch->file_done);
+    pthread_mutex_unlock(&batch->lock);
+  }
+  return NULL;
+}
+
+// "-": declassifies (& COLA overloads) stdin to stdout, reporting to stderr & never touching disk
+// (other than reading "DECLASS_H_" headers). returns the status declass.c would've exited with
+static int declass_stdin(struct cmd_flags *flags) {
+  jmp_buf fatal_error_exit;
+  declass_ctx ctx = {{"stdin", false, flags->external_runtime}};
+  struct string_builder source = {NULL, 0, 0}, output = {NULL, 0, 0};
+  struct declass_state *state = new_declass_state();
+  char buffer[4096];
+  int status;
+  if(state == NULL) {
+    fprintf(stderr, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR DECLASSIFICATION STATE!\033[0m\n\n", __LINE__);
+    return EXIT_FAILURE;
+  }
+  for(size_t n; (n = fread(buffer, 1, sizeof(buffer), stdin)) > 0;) sb_appendn(&source, buffer, n);
+  sb_append(&source, "");
+  state->fatal_error_exit = &fatal_error_exit;
+  state->out = state->err = stderr; // stdout only gets the declassified file
+  state->NO_COMPILE = true;
+  state->EXTERNAL_RUNTIME = flags->external_runtime;
+  DC = state;
+  if(setjmp(fatal_error_exit) == 0) {
+    transpile_source(&ctx, source.str, source.len, &output);
+    fwrite(output.str, 1, output.len, stdout);
+    if(flags->show_class_info) show_l_flag_data();
+  }
+  status = state->exit_status;
+  DC = NULL;
+  free_declass_state(state);
+  sb_free(&source), sb_free(&output);
+  return (fflush(stdout) == 0) ? status : EXIT_FAILURE;
+}
+#endif
+
+/******************************************************************************
+* "--serve" DECLASSIFICATION SERVER FUNCTIONS
+******************************************************************************/
+
+#ifndef DECLASS_LIBRARY
+// serves declassification requests from "declass --connect" on unix socket "socket_path" until killed,
+// keeping each "DECLASS_H_" header's cleaned text (only re-read once modified) & parsed classes, objects,
+// & fcns (reused while its text & the headers before it are unchanged) between requests
+static int declass_serve(char *socket_path) {
+  struct sockaddr_un addr;
+  pthread_attr_t client_attr;
+  pthread_t thread;
+  int listener, client;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if(strlen(socket_path) >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m SOCKET PATH \"%s\" IS TOO LONG!\033[0m\n\n", __LINE__, socket_path);
+    return EXIT_FAILURE;
+  }
+  strcpy(addr.sun_path, socket_path);
+  if((listener = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+    fprintf(stderr, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T OPEN A SOCKET!\033[0m\n\n", __LINE__);
+    return EXIT_FAILURE;
+  }
+  if(connect(listener, (struct sockaddr *)&addr, sizeof(addr)) == 0) { // don't steal a live server's socket
+    fprintf(stderr, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m ALREADY SERVING ON \"%s\"!\033[0m\n\n", __LINE__, socket_path);
+    close(listener);
+    return EXIT_FAILURE;
+  }
+  close(listener);
+  unlink(socket_path); // stale socket of a server that's since exited
+  if((listener = socket(AF_UNIX, SOCK_STREAM, 0)) < 0 || bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0
+    || listen(listener, SOMAXCONN) != 0) {
+    fprintf(stderr, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T SERVE ON \"%s\"!\033[0m\n\n", __LINE__, socket_path);
+    return EXIT_FAILURE;
+  }
+  signal(SIGPIPE, SIG_IGN); // clients hanging up early only end their own request
+  SERVED_HEADERS.serving = true;
+  PARSED_HEADERS.caching = true;
+  pthread_attr_init(&client_attr);
+  pthread_attr_setdetachstate(&client_attr, PTHREAD_CREATE_DETACHED);
+  printf("\033[1mdeclass.c: SERVING ON \"%s\"\033[0m\n", socket_path);
+  fflush(stdout);
+  for(;;) {
+    pthread_mutex_lock(&SERVED_CLIENTS.lock); // only accept once a client slot is free
+    while(SERVED_CLIENTS.total >= SERVE_MAX_CLIENTS) pthread_cond_wait(&SERVED_CLIENTS.finished, &SERVED_CLIENTS.lock);
+    pthread_mutex_unlock(&SERVED_CLIENTS.lock);
+    if((client = accept(listener, NULL, NULL)) < 0) {
+      if(errno == EINTR || errno == ECONNABORTED) continue;
+      break;
+    }
+    pthread_mutex_lock(&SERVED_CLIENTS.lock);
+    ++SERVED_CLIENTS.total;
+    pthread_mutex_unlock(&SERVED_CLIENTS.lock);
+    if(pthread_create(&thread, &client_attr, serve_declass_client, (void *)(long)client) != 0) {
+      serve_declass_request(client); // can't spawn a thread: serve it on this 1
+      finish_served_client();
+    }
+  }
+  pthread_attr_destroy(&client_attr);
+  close(listener);
+  return EXIT_FAILURE;
+}
+
+// "--serve" client thread: serves the request on "client"
+static void *serve_declass_client(void *client) {
+  serve_declass_request((int)(long)client);
+  finish_served_client();
+  return NULL;
+}
+
+// frees the client slot of a request just served
+static void finish_served_client() {
+  pthread_mutex_lock(&SERVED_CLIENTS.lock);
+  --SERVED_CLIENTS.total;
+  pthread_cond_signal(&SERVED_CLIENTS.finished);
+  pthread_mutex_unlock(&SERVED_CLIENTS.lock);
+}
+
+// declassifies a "declass --connect" request on "client": its working directory then its cmd line args,
+// each '\0'-terminated. replies w/ the files' reports, then a '\0' & the exit status byte. its files are
+// resolved against its working directory, as the server's cwd is shared by every request being served
+static void serve_declass_request(int client) {
+  struct string_builder request = {NULL, 0, 0};
+  struct cmd_flags flags = {false, false, false, false, 0, NULL, false, NULL, false, false, false, false, NULL, NULL, NULL};
+  struct timeval read_timeout = {SERVE_REQUEST_TIMEOUT, 0};
+  struct stat buf;
+  char dflt_cache_dir[MAX_TOKEN_NAME_LENGTH * 4], buffer[4096], **argv = NULL, **filenames = NULL;
+  int argc = 1, total_files = -1, status = EXIT_FAILURE;
+  time_t deadline = time(NULL) + SERVE_REQUEST_TIMEOUT;
+  bool timed_out = false, too_large = false;
+  long i;
+  FILE *reply = fdopen(client, "w");
+  if(reply == NULL) { close(client); return; }
+  setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &read_timeout, sizeof(read_timeout));
+  for(ssize_t n; !timed_out && !too_large && (n = read(client, buffer, sizeof(buffer))) != 0;) {
+    if(n < 0 && errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK) break;
+    timed_out = (time(NULL) >= deadline || (n < 0 && errno != EINTR));
+    if(n > 0 && !(too_large = (request.len + n > SERVE_MAX_REQUEST_SIZE))) sb_appendn(&request, buffer, n);
+  }
+  for(i = 0; i < request.len; ++i) argc += (request.str[i] == '\0'); // cwd & each arg
+  if(timed_out)
+    fprintf(reply, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m REQUEST NOT SENT W/IN %d SECONDS!\033[0m\n\n", __LINE__, SERVE_REQUEST_TIMEOUT);
+  else if(too_large)
+    fprintf(reply, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m REQUEST EXCEEDS %d BYTES!\033[0m\n\n", __LINE__, SERVE_MAX_REQUEST_SIZE);
+  else if(request.len > 0 && request.str[request.len-1] == '\0' && (argv = malloc(sizeof(char *) * argc)) != NULL
+    && (filenames = malloc(sizeof(char *) * argc)) != NULL) {
+    argv[0] = "declass", argc = 1;
+    for(i = strlen(request.str) + 1; i < request.len; i += strlen(&request.str[i]) + 1) argv[argc++] = &request.str[i];
+    if(request.str[0] != '/' || stat(request.str, &buf) != 0 || !S_ISDIR(buf.st_mode))
+      fprintf(reply, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ENTER DIRECTORY \"%s\"!\033[0m\n\n", __LINE__, request.str);
+    else if((total_files = parse_cmd_line_args(argc, argv, &flags, filenames, dflt_cache_dir)) < 1)
+      fprintf(reply, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m MISSING .c FILE OR MISUSED CMD LINE FLAG!\033[0m\n\n", __LINE__);
+    else {
+      if(flags.jobs == 0) flags.jobs = 1; // served files can't prompt the user
+      flags.working_dir = request.str;
+      status = declass_batch(filenames, total_files, &flags, reply, reply);
+    }
+  }
+  fputc('\0', reply);
+  fputc(status, reply);
+  fclose(reply);
+  free(argv), free(filenames);
+  sb_free(&request);
+}
+
+// sends the ".c" files & flags in "argv" (from the working directory) to the "declass --serve" server
+// on "socket_path", relaying its reports. returns the exit status it replied w/
+static int declass_connect(char *socket_path, int argc, char *argv[]) {
+  struct sockaddr_un addr;
+  char cwd[PATH_MAX], buffer[4096];
+  int server, status = EXIT_FAILURE;
+  bool replied = false;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+  if(getcwd(cwd, sizeof(cwd)) == NULL || (server = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+    fprintf(stderr, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T OPEN A SOCKET!\033[0m\n\n", __LINE__);
+    return EXIT_FAILURE;
+  }
+  if(connect(server, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+    fprintf(stderr, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m NO DECLASS SERVER ON \"%s\" (START 1 W/ \"--serve\")!\033[0m\n\n", __LINE__, socket_path);
+    close(server);
+    return EXIT_FAILURE;
+  }
+  FILE *request = fdopen(dup(server), "w");
+  if(request == NULL) { close(server); return EXIT_FAILURE; }
+  fwrite(cwd, 1, strlen(cwd) + 1, request);
+  for(int i = 0; i < argc; ++i) fwrite(argv[i], 1, strlen(argv[i]) + 1, request);
+  fclose(request);
+  shutdown(server, SHUT_WR);
+  for(ssize_t n; (n = read(server, buffer, sizeof(buffer))) != 0;) {
+    if(n < 0 && errno == EINTR) continue;
+    if(n < 0) break;
+    char *end = memchr(buffer, '\0', n);
+    fwrite(buffer, 1, (end != NULL) ? end - buffer : n, stdout);
+    fflush(stdout);
+    if(end == NULL) continue;
+    if(end + 1 < buffer + n) status = (unsigned char)end[1], replied = true;
+    else if(read(server, buffer, 1) == 1) status = (unsigned char)buffer[0], replied = true;
+    break;
+  }
+  close(server);
+  if(!replied) fprintf(stderr, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m DECLASS SERVER ON \"%s\" HUNG UP!\033[0m\n\n", __LINE__, socket_path);
+  return status;
+}
+#endif
+
+// "--serve": copies "header_name"'s cleaned text into "cleaned" if cached & unchanged (re-registering the
+// headers it includes), & its raw text into "source" when needed for a "--cache-dir" key. else reads
+// the header into "source" & returns false, to be cleaned by "clean_and_serve_header()"
+static bool fetch_served_header(char *header_name, struct string_builder *source, struct string_builder *cleaned) {
+  struct served_header *header = NULL;
+  struct stat buf;
+  char resolved[PATH_MAX];
+  bool served = false;
+  if(stat(resolve_path(header_name, resolved), &buf) != 0) {
+    scrape_file(header_name, source);
+    return false;
+  }
+  pthread_mutex_lock(&SERVED_HEADERS.lock);
+  for(int i = 0; i < SERVED_HEADERS.total && header == NULL; ++i)
+    if(SERVED_HEADERS.headers[i].dev == buf.st_dev && SERVED_HEADERS.headers[i].ino == buf.st_ino)
+      header = &SERVED_HEADERS.headers[i];
+  if(header != NULL && header->split == DC->SPLIT_HEADERS) {
+    if(header->mtime.tv_sec == buf.st_mtim.tv_sec && header->mtime.tv_nsec == buf.st_mtim.tv_nsec && header->size == buf.st_size) {
+      served = true;
+      if(DC->hash_sources) sb_appendn(source, header->source.str, header->source.len);
+    } else { // touched: only re-clean if its contents changed
+      pthread_mutex_unlock(&SERVED_HEADERS.lock);
+      scrape_file(header_name, source);
+      unsigned long long hash = served_header_hash(source);
+      pthread_mutex_lock(&SERVED_HEADERS.lock);
+      for(int i = 0; i < SERVED_HEADERS.total && !served; ++i) // (may have moved while unlocked)
+        if(SERVED_HEADERS.headers[i].dev == buf.st_dev && SERVED_HEADERS.headers[i].ino == buf.st_ino
+          && SERVED_HEADERS.headers[i].hash == hash && SERVED_HEADERS.headers[i].split == DC->SPLIT_HEADERS) {
+          header = &SERVED_HEADERS.headers[i], served = true;
+          header->mtime = buf.st_mtim, header->size = buf.st_size;
+        }
+    }
+  }
+  if(served) {
+    sb_appendn(cleaned, header->cleaned.str, header->cleaned.len);
+    for(char *name = header->inclusions.str, *end; name != NULL && *name != '\0'; name = end + 1) {
+      end = strchr(name, '\n');
+      *end = '\0';
+      register_DECLASS_H_header(name);
+      *end = '\n';
+    }
+  }
+  pthread_mutex_unlock(&SERVED_HEADERS.lock);
+  if(!served && source->len == 0) scrape_file(header_name, source);
+  return served;
+}
+
+// "--serve": cleans "header_name"'s raw text in "source" into "cleaned", caching the result for later requests
+static void clean_and_serve_header(char *header_name, struct string_builder *source, struct string_builder *cleaned) {
+  struct served_header header = {0};
+  struct stat buf;
+  char resolved[PATH_MAX];
+  DC->header_inclusions = &header.inclusions;
+  sb_append(&header.inclusions, "");
+  clean_source(source->str, cleaned);
+  DC->header_inclusions = NULL;
+  if(stat(resolve_path(header_name, resolved), &buf) != 0) { sb_free(&header.inclusions); return; }
+  header.dev = buf.st_dev, header.ino = buf.st_ino, header.mtime = buf.st_mtim, header.size = buf.st_size;
+  header.hash = served_header_hash(source);
+  header.split = DC->SPLIT_HEADERS;
+  sb_appendn(&header.source, source->str, source->len);
+  sb_appendn(&header.cleaned, cleaned->str, cleaned->len);
+  pthread_mutex_lock(&SERVED_HEADERS.lock);
+  int i = 0;
+  while(i < SERVED_HEADERS.total && (SERVED_HEADERS.headers[i].dev != header.dev || SERVED_HEADERS.headers[i].ino != header.ino)) ++i;
+  if(i < SERVED_HEADERS.total) { // replace the stale entry
+    sb_free(&SERVED_HEADERS.headers[i].source), sb_free(&SERVED_HEADERS.headers[i].cleaned), sb_free(&SERVED_HEADERS.headers[i].inclusions);
+  } else if(SERVED_HEADERS.total == SERVED_HEADERS.capacity) {
+    int capacity = (SERVED_HEADERS.capacity == 0) ? 16 : SERVED_HEADERS.capacity * 2;
+    struct served_header *headers = realloc(SERVED_HEADERS.headers, sizeof(struct served_header) * capacity);
+    if(headers == NULL) { // just don't cache it
+      pthread_mutex_unlock(&SERVED_HEADERS.lock);
+      sb_free(&header.source), sb_free(&header.cleaned), sb_free(&header.inclusions);
+      return;
+    }
+    SERVED_HEADERS.headers = headers, SERVED_HEADERS.capacity = capacity;
+  }
+  if(i == SERVED_HEADERS.total) ++SERVED_HEADERS.total;
+  SERVED_HEADERS.headers[i] = header;
+  pthread_mutex_unlock(&SERVED_HEADERS.lock);
+}
+
+// "--serve": FNV-1a hash of a header's raw text, to tell whether a touched header actually changed
+static unsigned long long served_header_hash(struct string_builder *source) {
+  unsigned long long hash = CACHE_KEY_FNV_OFFSET;
+  for(long i = 0; i < source->len; ++i) hash = (hash ^ (unsigned char)source->str[i]) * 1099511628211ULL;
+  return hash;
+}
+
+/******************************************************************************
+* "DECLASS_H_" HEADER PARSE CACHE FUNCTIONS
+******************************************************************************/
+
+// starts "DC->header_chain_key" w/ all a header's parse depends on besides the headers before it: declass.c's
+// version key, the flags found or given, & the alloc fcns
+static void start_DECLASS_H_chain_key() {
+  bool flags[] = {DC->NO_SMRTASSERT, DC->THREADSAFE_SMRTPTR, DC->NO_COLA_PARSER, DC->SPLIT_HEADERS, DC->EXTERNAL_RUNTIME};
+  DC->header_chain_key[0] = CACHE_KEY_FNV_OFFSET, DC->header_chain_key[1] = CACHE_KEY_MIX_OFFSET;
+  key_add(DC->header_chain_key, declass_version_key(), strlen(declass_version_key()));
+  key_add(DC->header_chain_key, (char *)DC->DEFNS.defaults, sizeof(DC->DEFNS.defaults));
+  key_add(DC->header_chain_key, (char *)flags, sizeof(flags));
+  for(int i = 0; i < DC->TOTAL_ALLOC_FCNS; ++i) key_add(DC->header_chain_key, DC->ALLOC_FCNS[i], strlen(DC->ALLOC_FCNS[i]));
+}
+
+// at the "DECLASS_H_SEGMENT_START" line "segment": chains its header's text into "DC->header_chain_key", then
+// restores its cached parse (appending its declassified text to "NEW_FILE") & returns the line ending it if
+// found, else returns the line past its start to parse (recording the parse for the cache if caching)
+static char *begin_DECLASS_H_segment(char *segment, struct string_builder *NEW_FILE) {
+  char *body = strchr(segment, '\n') + 1, *end = strstr(body - 1, "\n" DECLASS_H_SEGMENT_END);
+  struct header_segment *seg;
+  struct parsed_header *parsed;
+  DC->header_segments = reserve_table(DC->header_segments, &DC->max_header_segments, DC->total_header_segments + 1, sizeof(struct header_segment));
+  seg = &DC->header_segments[DC->total_header_segments++];
+  if(DC->SPLIT_HEADERS) sb_appendn(NEW_FILE, segment, body - segment);
+  seg->start = NEW_FILE->len, seg->end = -1;
+  if(end == NULL) return body;
+  key_add(DC->header_chain_key, segment, ++end - segment);
+  memcpy(seg->key, DC->header_chain_key, sizeof(seg->key));
+  // only self-contained segments are cached: w/o any objects' scopes or dtors left open before them
+  if(DC->OBJECT_SCOPE_DEPTH != 0 || DC->next_dtor_splice < DC->total_dtor_splices) return body;
+  if((parsed = acquire_parsed_DECLASS_H_header(seg->key)) != NULL) {
+    if(restore_parsed_DECLASS_H_header(parsed, NEW_FILE)) {
+      seg->parsed = parsed, seg->restored = true;
+      return end;
+    }
+    release_parsed_DECLASS_H_header(parsed);
+  }
+  if(DC->cache_header_parses) {
+    seg->recording = true;
+    seg->classes = DC->total_classes, seg->objects = DC->total_objects, seg->alloc_fcns = DC->TOTAL_ALLOC_FCNS;
+    seg->class_entries = DC->CLASS_INDEX.total_entries, seg->object_entries = DC->OBJECT_INDEX.total_entries;
+    seg->continued_errors = DC->continued_errors;
+  }
+  return body;
+}
+
+// at the "DECLASS_H_SEGMENT_END" line "segment_end" of the latest segment begun: records its parse if
+// recording & still self-contained, returns the line past it
+static char *end_DECLASS_H_segment(char *segment_end, struct string_builder *NEW_FILE) {
+  struct header_segment *seg = &DC->header_segments[DC->total_header_segments - 1];
+  int i;
+  seg->end = NEW_FILE->len;
+  if(seg->recording && DC->OBJECT_SCOPE_DEPTH == 0 && DC->next_dtor_splice == DC->total_dtor_splices
+    && DC->continued_errors == seg->continued_errors && DC->OBJECT_INDEX.total_entries >= seg->object_entries) {
+    for(i = seg->class_entries; i < DC->CLASS_INDEX.total_entries && DC->CLASS_INDEX.entries[i].id >= seg->classes; ++i);
+    bool own_entries = (i == DC->CLASS_INDEX.total_entries);
+    for(i = seg->object_entries; i < DC->OBJECT_INDEX.total_entries && DC->OBJECT_INDEX.entries[i].id >= seg->objects; ++i);
+    if(own_entries && i == DC->OBJECT_INDEX.total_entries) seg->parsed = record_parsed_DECLASS_H_header(seg, NEW_FILE);
+  }
+  seg->recording = false;
+  if(DC->SPLIT_HEADERS) sb_append(NEW_FILE, DECLASS_H_SEGMENT_END);
+  return segment_end + strlen(DECLASS_H_SEGMENT_END);
+}
+
+// whether a segment's been begun but not yet ended
+static bool in_DECLASS_H_segment() {
+  return DC->total_header_segments > 0 && DC->header_segments[DC->total_header_segments - 1].end == -1;
+}
+
+// returns a copy of what "seg" added to the state since it started recording, & its declassified text in "NEW_FILE"
+static struct parsed_header *record_parsed_DECLASS_H_header(struct header_segment *seg, struct string_builder *NEW_FILE) {
+  struct parsed_header *parsed = calloc(1, sizeof(struct parsed_header));
+  int i;
+  if(parsed == NULL) return NULL; // just don't cache it
+  memcpy(parsed->key, seg->key, sizeof(parsed->key));
+  parsed->total_classes = DC->total_classes - seg->classes;
+  parsed->total_objects = DC->total_objects - seg->objects;
+  parsed->total_class_entries = DC->CLASS_INDEX.total_entries - seg->class_entries;
+  parsed->total_object_entries = DC->OBJECT_INDEX.total_entries - seg->object_entries;
+  parsed->total_alloc_fcns = DC->TOTAL_ALLOC_FCNS - seg->alloc_fcns;
+  parsed->classes = copy_parse_table(&DC->classes[seg->classes], parsed->total_classes, sizeof(struct class_info));
+  parsed->objects = copy_parse_table(&DC->objects[seg->objects], parsed->total_objects, sizeof(struct objNames));
+  parsed->class_entries = copy_parse_table(&DC->CLASS_INDEX.entries[seg->class_entries], parsed->total_class_entries, sizeof(struct name_index_entry));
+  parsed->object_entries = copy_parse_table(&DC->OBJECT_INDEX.entries[seg->object_entries], parsed->total_object_entries, sizeof(struct name_index_entry));
+  parsed->alloc_fcns = copy_parse_table(&DC->ALLOC_FCNS[seg->alloc_fcns], parsed->total_alloc_fcns, sizeof(DC->ALLOC_FCNS[0]));
+  for(i = 0; i < parsed->total_classes; ++i) memset(&parsed->classes[i].method_index, 0, sizeof(struct name_index));
+  for(i = 0; i < parsed->total_class_entries; ++i) parsed->class_entries[i].id -= seg->classes;
+  for(i = 0; i < parsed->total_object_entries; ++i) parsed->object_entries[i].id -= seg->objects;
+  sb_appendn(&parsed->declassified, &NEW_FILE->str[seg->start], NEW_FILE->len - seg->start);
+  parsed->users = 1;
+  return parsed;
+}
+
+// adds "parsed" to the state as if its segment were just parsed into "NEW_FILE". returns whether it did
+static bool restore_parsed_DECLASS_H_header(struct parsed_header *parsed, struct string_builder *NEW_FILE) {
+  int i, j;
+  reserve_class_tables(parsed->total_classes, parsed->total_objects, parsed->total_alloc_fcns);
+  for(i = 0; i < parsed->total_classes; ++i) {
+    struct class_info *class = &DC->classes[DC->total_classes + i];
+    free_name_index(&class->method_index);
+    memcpy(class, &parsed->classes[i], sizeof(struct class_info));
+    for(j = 0; j < class->total_methods; ++j) name_index_add(&class->method_index, class->method_names[j], j);
+  }
+  for(i = 0; i < parsed->total_class_entries; ++i)
+    name_index_add(&DC->CLASS_INDEX, parsed->class_entries[i].name, DC->total_classes + parsed->class_entries[i].id);
+  for(i = 0; i < parsed->total_object_entries; ++i)
+    name_index_add(&DC->OBJECT_INDEX, parsed->object_entries[i].name, DC->total_objects + parsed->object_entries[i].id);
+  if(parsed->total_objects > 0) memcpy(&DC->objects[DC->total_objects], parsed->objects, sizeof(struct objNames) * parsed->total_objects);
+  if(parsed->total_alloc_fcns > 0) memcpy(&DC->ALLOC_FCNS[DC->TOTAL_ALLOC_FCNS], parsed->alloc_fcns, sizeof(DC->ALLOC_FCNS[0]) * parsed->total_alloc_fcns);
+  DC->total_classes += parsed->total_classes, DC->total_objects += parsed->total_objects, DC->TOTAL_ALLOC_FCNS += parsed->total_alloc_fcns;
+  sb_appendn(NEW_FILE, parsed->declassified.str, parsed->declassified.len);
+  return true;
+}
+
+// returns a malloc'd copy of the 'len' elems of 'size' bytes at 'table' (NULL if 'len' is 0)
+static void *copy_parse_table(void *table, int len, size_t size) {
+  void *copy;
+  if(len == 0) return NULL;
+  if((copy = malloc(size * len)) == NULL) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR HEADER PARSE CACHE!\033[0m\n\n", __LINE__);
+    declass_exit(EXIT_FAILURE);
+  }
+  return memcpy(copy, table, size * len);
+}
+
+// returns the parse keyed by 'key' read from a ".dch" file or (if caching) in "PARSED_HEADERS", held until
+// released (NULL if none)
+static struct parsed_header *acquire_parsed_DECLASS_H_header(unsigned long long key[2]) {
+  struct parsed_header *parsed = NULL;
+  int i;
+  pthread_mutex_lock(&PARSED_HEADERS.lock);
+  for(i = 0; i < DC->total_precompiled_headers && parsed == NULL; ++i)
+    if(memcmp(DC->precompiled_headers[i]->key, key, sizeof(DC->precompiled_headers[i]->key)) == 0) parsed = DC->precompiled_headers[i];
+  for(i = 0; DC->cache_header_parses && i < PARSED_HEADERS.total && parsed == NULL; ++i)
+    if(memcmp(PARSED_HEADERS.headers[i]->key, key, sizeof(PARSED_HEADERS.headers[i]->key)) == 0) parsed = PARSED_HEADERS.headers[i];
+  if(parsed != NULL) ++parsed->users;
+  pthread_mutex_unlock(&PARSED_HEADERS.lock);
+  return parsed;
+}
+
+// stops holding "parsed", freeing it if no longer held nor cached
+static void release_parsed_DECLASS_H_header(struct parsed_header *parsed) {
+  pthread_mutex_lock(&PARSED_HEADERS.lock);
+  bool unused = (--parsed->users == 0 && !parsed->cached);
+  pthread_mutex_unlock(&PARSED_HEADERS.lock);
+  if(unused) free_parsed_DECLASS_H_header(parsed);
+}
+
+#ifndef DECLASS_LIBRARY
+// caches every parse recorded by the current state (once cola.c's registered its span, never changing after)
+static void publish_parsed_DECLASS_H_headers() {
+  for(int i = 0; i < DC->total_header_segments; ++i) {
+    struct parsed_header *parsed = DC->header_segments[i].parsed, *evicted = NULL;
+    int j;
+    if(parsed == NULL || DC->header_segments[i].restored) continue;
+    pthread_mutex_lock(&PARSED_HEADERS.lock);
+    for(j = 0; j < PARSED_HEADERS.total && memcmp(PARSED_HEADERS.headers[j]->key, parsed->key, sizeof(parsed->key)) != 0; ++j);
+    if(j == PARSED_HEADERS.total && PARSED_HEADERS.total == MAX_PARSED_HEADERS) { // evict the oldest
+      evicted = PARSED_HEADERS.headers[0];
+      evicted->cached = false;
+      memmove(PARSED_HEADERS.headers, &PARSED_HEADERS.headers[1], sizeof(struct parsed_header *) * --PARSED_HEADERS.total);
+      if(evicted->users > 0) evicted = NULL; // freed by its last user
+    }
+    if(j == PARSED_HEADERS.total && PARSED_HEADERS.total == PARSED_HEADERS.capacity) {
+      int capacity = (PARSED_HEADERS.capacity == 0) ? 16 : PARSED_HEADERS.capacity * 2;
+      struct parsed_header **headers = realloc(PARSED_HEADERS.headers, sizeof(struct parsed_header *) * capacity);
+      if(headers != NULL) PARSED_HEADERS.headers = headers, PARSED_HEADERS.capacity = capacity;
+    }
+    if(j == PARSED_HEADERS.total && PARSED_HEADERS.total < PARSED_HEADERS.capacity) { // (unless another state cached it 1st)
+      PARSED_HEADERS.headers[PARSED_HEADERS.total++] = parsed;
+      parsed->cached = true;
+    }
+    pthread_mutex_unlock(&PARSED_HEADERS.lock);
+    if(evicted != NULL) free_parsed_DECLASS_H_header(evicted);
+    release_parsed_DECLASS_H_header(parsed);
+    DC->header_segments[i].parsed = NULL;
+  }
+}
+#endif
+
+// frees "parsed" & every table it allocated
+static void free_parsed_DECLASS_H_header(struct parsed_header *parsed) {
+  for(int i = 0; i < parsed->total_fmacs; ++i) {
+    for(int j = 0; j < parsed->fmacs[i].dflts.total_dflts; ++j) free(parsed->fmacs[i].dflts.dflt_vals[j]);
+    free(parsed->fmacs[i].dflts.dflt_idxs), free(parsed->fmacs[i].dflts.dflt_vals);
+  }
+  free(parsed->fmacs);
+  free(parsed->classes), free(parsed->objects), free(parsed->class_entries), free(parsed->object_entries), free(parsed->alloc_fcns);
+  sb_free(&parsed->declassified), sb_free(&parsed->precola), sb_free(&parsed->registered);
+  free(parsed);
+}
+
+/******************************************************************************
+* "--precompile" PRECOMPILED HEADER FUNCTIONS
+******************************************************************************/
+
+#ifndef DECLASS_LIBRARY
+// precompiles "DECLASS_H_" header "header_name" into "<header>.dch" w/ its own state, reporting to
+// stdout & stderr. returns the status declass.c would've exited with
+static int precompile_DECLASS_H_header(char *header_name) {
+  jmp_buf fatal_error_exit;
+  struct declass_state *state = new_declass_state();
+  int status;
+  if(state == NULL) {
+    fprintf(stderr, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR DECLASSIFICATION STATE!\033[0m\n\n", __LINE__);
+    return EXIT_FAILURE;
+  }
+  state->fatal_error_exit = &fatal_error_exit;
+  state->out = stdout, state->err = stderr;
+  DC = state;
+  if(setjmp(fatal_error_exit) == 0) precompile_DECLASS_H_header_execution(header_name);
+  status = state->exit_status;
+  DC = NULL;
+  free_declass_state(state);
+  return status;
+}
+
+// writes "header_name"'s ".dch" file under the current thread's "DC" state: the header's cleaned
+// text (both w/ & w/o "--split-headers") & the "DECLASS_H_" headers it includes, ready to splice in,
+// & its segments' parses, ready to restore
+static void precompile_DECLASS_H_header_execution(char *header_name) {
+  struct string_builder source = {NULL, 0, 0}, inclusions = {NULL, 0, 0}, cleaned = {NULL, 0, 0}, split_cleaned = {NULL, 0, 0};
+  struct string_builder dch = {NULL, 0, 0}, parses = {NULL, 0, 0};
+  struct dch_header header;
+  long total_parses = 0;
+  char dch_filename[MAX_TOKEN_NAME_LENGTH + 8];
+  if(strlen(header_name) >= MAX_TOKEN_NAME_LENGTH || strlen(header_name) < 3 || strcmp(&header_name[strlen(header_name)-2], ".h") != 0) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m \"--precompile\" EXPECTS A \"DECLASS_H_\" HEADER, NOT \"%s\"!\033[0m\n\n", __LINE__, header_name);
+    declass_exit(EXIT_FAILURE);
+  }
+  scrape_file(header_name, &source);
+  sb_append(&inclusions, "");
+  DC->header_inclusions = &inclusions;
+  clean_source(source.str, &cleaned);
+  DC->header_inclusions = NULL;
+  DC->SPLIT_HEADERS = true;
+  clean_source(source.str, &split_cleaned);
+  sb_append(&parses, "");
+  for(int split = 0; split < 2; ++split)
+    for(int external = 0; external < 2; ++external) precompile_DECLASS_H_parses(header_name, split, external, &parses, &total_parses);
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, DCH_MAGIC, sizeof(header.magic));
+  strncpy(header.build, declass_version_key(), sizeof(header.build) - 1);
+  header.inclusions_len = inclusions.len, header.cleaned_len = cleaned.len, header.split_cleaned_len = split_cleaned.len;
+  header.parses_len = parses.len, header.total_parses = total_parses;
+  sb_appendn(&dch, (char *)&header, sizeof(header));
+  sb_appendn(&dch, inclusions.str, inclusions.len);
+  sb_appendn(&dch, cleaned.str, cleaned.len);
+  sb_appendn(&dch, split_cleaned.str, split_cleaned.len);
+  sb_appendn(&dch, parses.str, parses.len);
+  strcpy(dch_filename, header_name);
+  NEW_EXTENSION(dch_filename, ".dch");
+  FPUT(dch.str, dch.len, dch_filename);
+  fprintf(DC_STDOUT, "%s \033[1m==PRECOMPILED=>\033[0m %s (%ld PARSES)\n", header_name, dch_filename, total_parses);
+  sb_free(&source), sb_free(&inclusions), sb_free(&cleaned), sb_free(&split_cleaned), sb_free(&parses), sb_free(&dch);
+}
+
+// declassifies (& cola.c registers) a file only including "header_name" w/ its own state, w/ or w/o
+// "--split-headers" & "--runtime=external", appending the parses recorded for its headers' segments to
+// "parses" (counted in "*total_parses"). a header failing to declassify is left to be reported once included
+static void precompile_DECLASS_H_parses(char *header_name, bool split_headers, bool external_runtime, struct string_builder *parses, long *total_parses) {
+  jmp_buf fatal_error_exit;
+  declass_ctx ctx = {{header_name, false, external_runtime}};
+  struct declass_state *reporting = DC, *state = new_declass_state();
+  struct string_builder source = {NULL, 0, 0}, *output = calloc(1, sizeof(struct string_builder)); // (heap-held to outlive a "longjmp")
+  FILE *discarded = fopen("/dev/null", "w");
+  if(state != NULL && output != NULL && discarded != NULL) {
+    sb_printf(&source, "#include \"%s\"\n", header_name);
+    state->fatal_error_exit = &fatal_error_exit;
+    state->out = state->err = discarded; // (reported once a file including the header is declassified)
+    state->NO_COMPILE = true;
+    state->SPLIT_HEADERS = split_headers, state->EXTERNAL_RUNTIME = external_runtime;
+    state->cache_header_parses = state->precompiling = true;
+    state->working_dir = reporting->working_dir;
+    DC = state;
+    if(setjmp(fatal_error_exit) == 0) {
+      transpile_source(&ctx, source.str, source.len, output);
+      DC = reporting;
+      for(int i = 0; i < state->total_header_segments; ++i)
+        if(state->header_segments[i].parsed != NULL && !state->header_segments[i].restored)
+          serialize_parsed_DECLASS_H_header(state->header_segments[i].parsed, parses), ++*total_parses;
+    }
+    DC = reporting;
+    sb_free(output);
+  }
+  if(state != NULL) free_declass_state(state);
+  if(discarded != NULL) fclose(discarded);
+  free(output);
+  sb_free(&source);
+}
+
+// appends "parsed" to "parses" (omitting "method_index"s & each table's unused elems), as read back by
+// "deserialize_parsed_DECLASS_H_header()"
+static void serialize_parsed_DECLASS_H_header(struct parsed_header *parsed, struct string_builder *parses) {
+  int i, j;
+  dch_put(parses, parsed->key, sizeof(parsed->key));
+  dch_put(parses, &parsed->total_classes, sizeof(int)), dch_put(parses, &parsed->total_objects, sizeof(int));
+  dch_put(parses, &parsed->total_class_entries, sizeof(int)), dch_put(parses, &parsed->total_object_entries, sizeof(int));
+  dch_put(parses, &parsed->total_alloc_fcns, sizeof(int));
+  for(i = 0; i < parsed->total_classes; ++i) {
+    struct class_info *class = &parsed->classes[i];
+    dch_put_str(parses, class->class_name, strlen(class->class_name));
+    dch_put(parses, &class->total_methods, sizeof(int)), dch_put(parses, &class->total_members, sizeof(int));
+    dch_put(parses, &class->total_uctors, sizeof(int));
+    for(j = 0; j < class->total_methods; ++j) dch_put_str(parses, class->method_names[j], strlen(class->method_names[j]));
+    for(j = 0; j < class->total_members; ++j) {
+      dch_put_str(parses, class->member_names[j], strlen(class->member_names[j]));
+      dch_put_str(parses, class->member_values[j], strlen(class->member_values[j]));
+      dch_put_str(parses, class->member_value_user_ctor[j], strlen(class->member_value_user_ctor[j]));
+      dch_put_str(parses, class->member_object_class_name[j], strlen(class->member_object_class_name[j]));
+      dch_put(parses, &class->member_is_array[j], sizeof(bool)), dch_put(parses, &class->member_is_pointer[j], sizeof(bool));
+      dch_put(parses, &class->member_value_is_alloc[j], sizeof(bool)), dch_put(parses, &class->member_is_immortal[j], sizeof(bool));
+    }
+    dch_put(parses, class->class_uctor_arg_lengths, sizeof(int) * class->total_uctors);
+    dch_put(parses, &class->class_has_ctor, sizeof(bool)), dch_put(parses, &class->class_has_ctor_args, sizeof(bool));
+    dch_put(parses, &class->class_has_dtor, sizeof(bool)), dch_put(parses, &class->class_has_alloc, sizeof(bool));
+    dch_put(parses, &class->class_is_pooled, sizeof(bool));
+  }
+  for(i = 0; i < parsed->total_objects; ++i) {
+    struct objNames *object = &parsed->objects[i];
+    dch_put_str(parses, object->class_name, strlen(object->class_name));
+    dch_put_str(parses, object->object_name, strlen(object->object_name));
+    dch_put(parses, &object->is_class_pointer, sizeof(bool)), dch_put(parses, &object->is_alloced_class_pointer, sizeof(bool));
+    dch_put(parses, &object->is_class_array, sizeof(bool)), dch_put(parses, &object->class_has_dtor, sizeof(bool));
+    dch_put(parses, &object->is_immortal, sizeof(bool)), dch_put(parses, &object->is_dangling_ctord_ptr, sizeof(bool));
+  }
+  for(i = 0; i < parsed->total_class_entries + parsed->total_object_entries; ++i) {
+    struct name_index_entry *entry = (i < parsed->total_class_entries) ? &parsed->class_entries[i] : &parsed->object_entries[i - parsed->total_class_entries];
+    dch_put_str(parses, entry->name, strlen(entry->name));
+    dch_put(parses, &entry->hash, sizeof(entry->hash)), dch_put(parses, &entry->id, sizeof(int));
+  }
+  for(i = 0; i < parsed->total_alloc_fcns; ++i) dch_put_str(parses, parsed->alloc_fcns[i], strlen(parsed->alloc_fcns[i]));
+  dch_put_str(parses, parsed->declassified.str, parsed->declassified.len);
+  dch_put(parses, &parsed->cola_recorded, sizeof(bool));
+  dch_put_str(parses, parsed->precola.str, parsed->precola.len);
+  dch_put_str(parses, parsed->registered.str, parsed->registered.len);
+  dch_put(parses, &parsed->skipped_depth, sizeof(int)), dch_put(parses, &parsed->total_fmacs, sizeof(int));
+  for(i = 0; i < parsed->total_fmacs; ++i) {
+    struct parsed_fmac *fmac = &parsed->fmacs[i];
+    dch_put(parses, &fmac->offset, sizeof(long)), dch_put(parses, &fmac->args, sizeof(int));
+    dch_put(parses, &fmac->is_a_macro, sizeof(bool)), dch_put(parses, &fmac->is_a_prototype, sizeof(bool));
+    dch_put(parses, &fmac->is_variadic, sizeof(bool));
+    dch_put_str(parses, fmac->dflts.fcn_name, strlen(fmac->dflts.fcn_name));
+    dch_put(parses, &fmac->dflts.total_args, sizeof(int)), dch_put(parses, &fmac->dflts.total_dflts, sizeof(int));
+    dch_put(parses, fmac->dflts.dflt_idxs, sizeof(int) * fmac->dflts.total_dflts);
+    for(j = 0; j < fmac->dflts.total_dflts; ++j) dch_put_str(parses, fmac->dflts.dflt_vals[j], strlen(fmac->dflts.dflt_vals[j]));
+  }
+}
+
+// appends the "size" bytes of "field" to "parses"
+static void dch_put(struct string_builder *parses, void *field, long size) {
+  if(size > 0) sb_appendn(parses, (char *)field, size);
+}
+
+// appends the "len" chars of "str" to "parses", preceded by "len"
+static void dch_put_str(struct string_builder *parses, char *str, long len) {
+  dch_put(parses, &len, sizeof(len));
+  dch_put(parses, str, len);
+}
+#endif
+
+// if "header_name" has a ".dch" file newer than itself (made by this version of declass.c), maps it in
+// to append its cleaned text to "cleaned", register the headers it includes, & load its parses. returns
+// whether it did
+static bool fetch_precompiled_header(char *header_name, struct string_builder *cleaned) {
+  struct stat header_buf, dch_buf;
+  struct dch_header header;
+  char dch_filename[MAX_TOKEN_NAME_LENGTH + 8], resolved[PATH_MAX], *mapped, *inclusions, *name, *end;
+  int fd;
+  if(strlen(header_name) >= MAX_TOKEN_NAME_LENGTH || DC->precompiling) return false;
+  strcpy(dch_filename, header_name);
+  NEW_EXTENSION(dch_filename, ".dch");
+  if(stat(resolve_path(header_name, resolved), &header_buf) != 0 || (fd = open(resolve_path(dch_filename, resolved), O_RDONLY)) < 0) return false;
+  if(fstat(fd, &dch_buf) != 0 || dch_buf.st_size < (off_t)sizeof(header) || dch_buf.st_mtim.tv_sec < header_buf.st_mtim.tv_sec
+    || (dch_buf.st_mtim.tv_sec == header_buf.st_mtim.tv_sec && dch_buf.st_mtim.tv_nsec <= header_buf.st_mtim.tv_nsec)
+    || (mapped = mmap(NULL, dch_buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+    close(fd);
+    return false;
+  }
+  close(fd);
+  memcpy(&header, mapped, sizeof(header));
+  if(memcmp(header.magic, DCH_MAGIC, sizeof(header.magic)) != 0 || strncmp(header.build, declass_version_key(), sizeof(header.build) - 1) != 0
+    || header.inclusions_len < 0 || header.cleaned_len < 0 || header.split_cleaned_len < 0 || header.parses_len < 0
+    || (long)sizeof(header) + header.inclusions_len + header.cleaned_len + header.split_cleaned_len + header.parses_len != dch_buf.st_size) {
+    munmap(mapped, dch_buf.st_size);
+    return false;
+  }
+  inclusions = &mapped[sizeof(header)];
+  if(DC->SPLIT_HEADERS)
+    sb_appendn(cleaned, &inclusions[header.inclusions_len + header.cleaned_len], header.split_cleaned_len);
+  else
+    sb_appendn(cleaned, &inclusions[header.inclusions_len], header.cleaned_len);
+  for(name = inclusions; name < &inclusions[header.inclusions_len] && (end = memchr(name, '\n', &inclusions[header.inclusions_len] - name)) != NULL; name = end + 1) {
+    char inclusion[MAX_TOKEN_NAME_LENGTH + 8];
+    if(end - name >= (long)sizeof(inclusion)) continue;
+    memcpy(inclusion, name, end - name);
+    inclusion[end - name] = '\0';
+    register_DECLASS_H_header(inclusion);
+  }
+  load_precompiled_DECLASS_H_parses(&inclusions[header.inclusions_len + header.cleaned_len + header.split_cleaned_len], header.parses_len, header.total_parses);
+  munmap(mapped, dch_buf.st_size);
+  return true;
+}
+
+// adds the "total" parses serialized in the "len" bytes at "parses" to "DC->precompiled_headers" (held until
+// the state's freed), skipping any already added. stops at the 1st malformed parse
+static void load_precompiled_DECLASS_H_parses(char *parses, long len, long total) {
+  struct dch_reader dch = {parses, parses + len, false};
+  for(long i = 0; i < total; ++i) {
+    struct parsed_header *parsed = deserialize_parsed_DECLASS_H_header(&dch);
+    int j;
+    if(parsed == NULL) return;
+    for(j = 0; j < DC->total_precompiled_headers && memcmp(DC->precompiled_headers[j]->key, parsed->key, sizeof(parsed->key)) != 0; ++j);
+    if(j < DC->total_precompiled_headers) { free_parsed_DECLASS_H_header(parsed); continue; } // (also in another ".dch")
+    DC->precompiled_headers = reserve_table(DC->precompiled_headers, &DC->max_precompiled_headers, DC->total_precompiled_headers + 1, sizeof(struct parsed_header *));
+    DC->precompiled_headers[DC->total_precompiled_headers++] = parsed;
+  }
+}
+
+// reads the next parse written by "serialize_parsed_DECLASS_H_header()" from "dch", held by 1 user (NULL if malformed)
+static struct parsed_header *deserialize_parsed_DECLASS_H_header(struct dch_reader *dch) {
+  struct parsed_header *parsed = calloc(1, sizeof(struct parsed_header));
+  int i, j, totals[5];
+  if(parsed == NULL) return NULL;
+  parsed->users = 1;
+  dch_get(dch, parsed->key, sizeof(parsed->key));
+  for(i = 0; i < 5; ++i) dch_get(dch, &totals[i], sizeof(int));
+  if(dch->bad || totals[0] < 0 || totals[0] > dch->end - dch->at || totals[1] < 0 || totals[1] > dch->end - dch->at || totals[2] < 0
+    || totals[2] > totals[0] || totals[3] < 0 || totals[3] > totals[1] || totals[4] < 0 || totals[4] > dch->end - dch->at
+    || (totals[0] > 0 && (parsed->classes = calloc(totals[0], sizeof(struct class_info))) == NULL)
+    || (totals[1] > 0 && (parsed->objects = calloc(totals[1], sizeof(struct objNames))) == NULL)
+    || (totals[2] > 0 && (parsed->class_entries = calloc(totals[2], sizeof(struct name_index_entry))) == NULL)
+    || (totals[3] > 0 && (parsed->object_entries = calloc(totals[3], sizeof(struct name_index_entry))) == NULL)
+    || (totals[4] > 0 && (parsed->alloc_fcns = calloc(totals[4], sizeof(parsed->alloc_fcns[0]))) == NULL)) {
+    free_parsed_DECLASS_H_header(parsed);
+    return NULL;
+  }
+  parsed->total_classes = totals[0], parsed->total_objects = totals[1];
+  parsed->total_class_entries = totals[2], parsed->total_object_entries = totals[3], parsed->total_alloc_fcns = totals[4];
+  for(i = 0; i < parsed->total_classes && !dch->bad; ++i) {
+    struct class_info *class = &parsed->classes[i];
+    dch_get_str(dch, class->class_name, sizeof(class->class_name));
+    dch_get(dch, &class->total_methods, sizeof(int)), dch_get(dch, &class->total_members, sizeof(int));
+    dch_get(dch, &class->total_uctors, sizeof(int));
+    if(class->total_methods < 0 || class->total_methods > MAX_METHODS_PER_CLASS || class->total_members < 0
+      || class->total_members > MAX_MEMBERS_PER_CLASS || class->total_uctors < 0 || class->total_uctors > MAX_METHODS_PER_CLASS) {
+      dch->bad = true;
+      break;
+    }
+    for(j = 0; j < class->total_methods; ++j) dch_get_str(dch, class->method_names[j], sizeof(class->method_names[j]));
+    for(j = 0; j < class->total_members; ++j) {
+      dch_get_str(dch, class->member_names[j], sizeof(class->member_names[j]));
+      dch_get_str(dch, class->member_values[j], sizeof(class->member_values[j]));
+      dch_get_str(dch, class->member_value_user_ctor[j], sizeof(class->member_value_user_ctor[j]));
+      dch_get_str(dch, class->member_object_class_name[j], sizeof(class->member_object_class_name[j]));
+      dch_get(dch, &class->member_is_array[j], sizeof(bool)), dch_get(dch, &class->member_is_pointer[j], sizeof(bool));
+      dch_get(dch, &class->member_value_is_alloc[j], sizeof(bool)), dch_get(dch, &class->member_is_immortal[j], sizeof(bool));
+    }
+    dch_get(dch, class->class_uctor_arg_lengths, sizeof(int) * class->total_uctors);
+    dch_get(dch, &class->class_has_ctor, sizeof(bool)), dch_get(dch, &class->class_has_ctor_args, sizeof(bool));
+    dch_get(dch, &class->class_has_dtor, sizeof(bool)), dch_get(dch, &class->class_has_alloc, sizeof(bool));
+    dch_get(dch, &class->class_is_pooled, sizeof(bool));
+  }
+  for(i = 0; i < parsed->total_objects && !dch->bad; ++i) {
+    struct objNames *object = &parsed->objects[i];
+    dch_get_str(dch, object->class_name, sizeof(object->class_name));
+    dch_get_str(dch, object->object_name, sizeof(object->object_name));
+    dch_get(dch, &object->is_class_pointer, sizeof(bool)), dch_get(dch, &object->is_alloced_class_pointer, sizeof(bool));
+    dch_get(dch, &object->is_class_array, sizeof(bool)), dch_get(dch, &object->class_has_dtor, sizeof(bool));
+    dch_get(dch, &object->is_immortal, sizeof(bool)), dch_get(dch, &object->is_dangling_ctord_ptr, sizeof(bool));
+  }
+  for(i = 0; i < parsed->total_class_entries + parsed->total_object_entries && !dch->bad; ++i) {
+    bool class_entry = (i < parsed->total_class_entries);
+    struct name_index_entry *entry = class_entry ? &parsed->class_entries[i] : &parsed->object_entries[i - parsed->total_class_entries];
+    dch_get_str(dch, entry->name, sizeof(entry->name));
+    dch_get(dch, &entry->hash, sizeof(entry->hash)), dch_get(dch, &entry->id, sizeof(int));
+    entry->next = -1;
+    if(entry->id < 0 || entry->id >= (class_entry ? parsed->total_classes : parsed->total_objects)) dch->bad = true;
+  }
+  for(i = 0; i < parsed->total_alloc_fcns; ++i) dch_get_str(dch, parsed->alloc_fcns[i], sizeof(parsed->alloc_fcns[i]));
+  dch_get_text(dch, &parsed->declassified);
+  dch_get(dch, &parsed->cola_recorded, sizeof(bool));
+  dch_get_text(dch, &parsed->precola);
+  dch_get_text(dch, &parsed->registered);
+  dch_get(dch, &parsed->skipped_depth, sizeof(int)), dch_get(dch, &totals[0], sizeof(int));
+  if(parsed->precola.len != parsed->registered.len) dch->bad = true;
+  for(i = 0; i < totals[0] && !dch->bad; ++i) {
+    parsed->fmacs = reserve_table(parsed->fmacs, &parsed->max_fmacs, parsed->total_fmacs + 1, sizeof(struct parsed_fmac));
+    struct parsed_fmac *fmac = &parsed->fmacs[parsed->total_fmacs++];
+    dch_get(dch, &fmac->offset, sizeof(long)), dch_get(dch, &fmac->args, sizeof(int));
+    dch_get(dch, &fmac->is_a_macro, sizeof(bool)), dch_get(dch, &fmac->is_a_prototype, sizeof(bool));
+    dch_get(dch, &fmac->is_variadic, sizeof(bool));
+    dch_get_str(dch, fmac->dflts.fcn_name, sizeof(fmac->dflts.fcn_name));
+    dch_get(dch, &fmac->dflts.total_args, sizeof(int)), dch_get(dch, &j, sizeof(int));
+    if(dch->bad || fmac->offset < 0 || fmac->offset >= parsed->precola.len || j < 0 || j > fmac->dflts.total_args
+      || (j > 0 && ((fmac->dflts.dflt_idxs = calloc(j, sizeof(int))) == NULL || (fmac->dflts.dflt_vals = calloc(j, sizeof(char *))) == NULL))) {
+      dch->bad = true;
+      break;
+    }
+    dch_get(dch, fmac->dflts.dflt_idxs, sizeof(int) * j);
+    for(fmac->dflts.total_dflts = 0; fmac->dflts.total_dflts < j && !dch->bad; ++fmac->dflts.total_dflts) {
+      struct string_builder value = {NULL, 0, 0};
+      sb_append(&value, "");
+      dch_get_text(dch, &value);
+      fmac->dflts.dflt_vals[fmac->dflts.total_dflts] = value.str;
+    }
+    fmac->dflts.max_dflts = j;
+  }
+  if(dch->bad) {
+    free_parsed_DECLASS_H_header(parsed);
+    return NULL;
+  }
+  return parsed;
+}
+
+// reads the next "size" bytes of "dch" into "field" (zeroing it if they run past its end)
+static void dch_get(struct dch_reader *dch, void *field, long size) {
+  if(size <= 0) return;
+  if(dch->bad || dch->end - dch->at < size) {
+    dch->bad = true;
+    memset(field, 0, size);
+    return;
+  }
+  memcpy(field, dch->at, size);
+  dch->at += size;
+}
+
+// reads the next string of "dch" into the "max"-char array "str" ('\0'-terminated)
+static void dch_get_str(struct dch_reader *dch, char *str, long max) {
+  long len = 0;
+  dch_get(dch, &len, sizeof(len));
+  if(dch->bad || len < 0 || len >= max || dch->end - dch->at < len) {
+    dch->bad = true;
+    *str = '\0';
+    return;
+  }
+  memcpy(str, dch->at, len);
+  str[len] = '\0';
+  dch->at += len;
+}
+
+// appends the next string of "dch" to "text"
+static void dch_get_text(struct dch_reader *dch, struct string_builder *text) {
+  long len = 0;
+  dch_get(dch, &len, sizeof(len));
+  if(dch->bad || len < 0 || dch->end - dch->at < len) {
+    dch->bad = true;
+    return;
+  }
+  if(len > 0) sb_appendn(text, dch->at, len);
+  dch->at += len;
+}
+
+/******************************************************************************
+* MAKE DEPENDENCY FILE FUNCTIONS
+******************************************************************************/
+
+#ifndef DECLASS_LIBRARY
+// writes a make/ninja dependency rule to "deps_filename" (dflt "<file>_DECLASS.d") making "declass_filename"
+// depend on "source_filename" & every "DECLASS_H_" header it (transitively) included, w/ an empty rule per
+// header (like gcc's "-MP") so deleting a header doesn't break the build
+static void write_make_dependencies(char *deps_filename, char *declass_filename, char *source_filename) {
+  struct string_builder deps = {NULL, 0, 0};
+  char dflt_deps_filename[MAX_TOKEN_NAME_LENGTH + 16], resolved[PATH_MAX];
+  int i;
+  if(deps_filename == NULL) {
+    strcpy(dflt_deps_filename, declass_filename);
+    NEW_EXTENSION(dflt_deps_filename, ".d");
+    deps_filename = dflt_deps_filename;
+  }
+  append_make_path(&deps, declass_filename);
+  sb_append(&deps, ": ");
+  append_make_path(&deps, source_filename);
+  for(i = 0; i < DC->TOTAL_DECLASS_HEADER_FILES; ++i)
+    if(access(resolve_path(DC->DECLASS_HEADER_FILE_NAMES[i], resolved), R_OK) == 0) { // skip missing headers the user chose to continue w/o
+      sb_append(&deps, " \\\n  ");
+      append_make_path(&deps, DC->DECLASS_HEADER_FILE_NAMES[i]);
+    }
+  sb_putc(&deps, '\n');
+  for(i = 0; i < DC->TOTAL_DECLASS_HEADER_FILES; ++i)
+    if(access(resolve_path(DC->DECLASS_HEADER_FILE_NAMES[i], resolved), R_OK) == 0) {
+      sb_putc(&deps, '\n');
+      append_make_path(&deps, DC->DECLASS_HEADER_FILE_NAMES[i]);
+      sb_append(&deps, ":\n");
+    }
+  FPUT(deps.str, deps.len, deps_filename);
+  sb_free(&deps);
+}
+
+// appends "path" to "deps", escaping the chars make treats specially in rules
+static void append_make_path(struct string_builder *deps, char *path) {
+  for(; *path != '\0'; ++path) {
+    if(*path == '$')                          sb_putc(deps, '$');
+    else if(*path == ' ' || *path == '#')     sb_putc(deps, '\\');
+    sb_putc(deps, *path);
+  }
+}
+#endif
+
+/******************************************************************************
+* DECLASSIFIED FILE CACHE FUNCTIONS
+******************************************************************************/
+
+// hashes the 'len' chars at 'str' into "DC->cache_key"
+static void cache_key_add(char *str, long len) {
+  key_add(DC->cache_key, str, len);
+}
+
+// hashes the 'len' chars at 'str' into 'key' (& 'len' itself, so adjacent items can't run together)
+static void key_add(unsigned long long key[2], char *str, long len) {
+  unsigned long long fnv = key[0], mix = key[1];
+  unsigned char *bytes = (unsigned char *)str, *len_bytes = (unsigned char *)&len;
+  for(int i = 0; i < (int)sizeof(len); ++i) {
+    fnv = (fnv ^ len_bytes[i]) * 1099511628211ULL;
+    mix = (mix ^ len_bytes[i]) * 0xff51afd7ed558ccdULL, mix ^= mix >> 29;
+  }
+  for(long i = 0; i < len; ++i) { // 2 independent 64-bit lanes: FNV-1a & a multiply-xorshift mix
+    fnv = (fnv ^ bytes[i]) * 1099511628211ULL;
+    mix = (mix ^ bytes[i]) * 0xff51afd7ed558ccdULL, mix ^= mix >> 29;
+  }
+  key[0] = fnv, key[1] = mix;
+}
+
+// hashes declass.c's version w/ all else its output depends on besides its input & flags (the runtime
+// text it emits & its parser's limits) into "DECLASS_VERSION_KEY"
+static void init_declass_version_key() {
+  unsigned long long key[2] = {CACHE_KEY_FNV_OFFSET, CACHE_KEY_MIX_OFFSET};
+  int limits[] = {MAX_MEMBERS_PER_CLASS, MAX_METHODS_PER_CLASS, MAX_WORDS_PER_METHOD, MAX_DEFAULT_VALUE_LENGTH,
+                  MAX_TOKEN_NAME_LENGTH, MAX_DECLASS_HEADER_FILES, MAX_OBJECT_SCOPE_DEPTH};
+  char *runtime_text[] = {DC_SUPPORT_CONTACT, IMMORTAL_KEYWORD_DEF, NDEBUG_SMRTPTR_DEF, THREADSAFE_SMRTPTR_DEF,
+                          DC_SMART_POINTER_H_
+#ifndef DECLASS_LIBRARY
+                          , (char *)DC_SMART_POINTER_DECLS_
+#endif
+                          };
+  key_add(key, DECLASS_VERSION, strlen(DECLASS_VERSION));
+  key_add(key, (char *)limits, sizeof(limits));
+  key_add(key, (char *)DEFAULT_ALLOC_FCNS, sizeof(DEFAULT_ALLOC_FCNS));
+  for(int i = 0; i < (int)(sizeof(runtime_text) / sizeof(runtime_text[0])); ++i)
+    key_add(key, runtime_text[i], strlen(runtime_text[i]));
+  snprintf(DECLASS_VERSION_KEY, sizeof(DECLASS_VERSION_KEY), "%s %016llx%016llx", DECLASS_VERSION, key[0], key[1]);
+}
+
+// returns "DECLASS_VERSION_KEY", hashing it on 1st use
+static char *declass_version_key() {
+  pthread_once(&DECLASS_VERSION_KEY_ONCE, init_declass_version_key);
+  return DECLASS_VERSION_KEY;
+}
+
+#ifndef DECLASS_LIBRARY
+// appends the path of the cache entry keyed by "DC->cache_key" in "cache_dir" to "path"
+static void cache_entry_path(char *cache_dir, struct string_builder *path) {
+  char resolved[PATH_MAX];
+  sb_printf(path, "%s/%016llx%016llx.c", resolve_path(cache_dir, resolved), DC->cache_key[0], DC->cache_key[1]);
+}
+
+// makes "dir" & any missing parent dirs, returns whether "dir" exists as a dir afterwards
+static bool make_cache_dir(char *dir) {
+  struct string_builder path = {NULL, 0, 0};
+  struct stat buf;
+  char resolved[PATH_MAX];
+  sb_append(&path, resolve_path(dir, resolved));
+  for(char *p = path.str + 1; *p != '\0'; ++p)
+    if(*p == '/') *p = '\0', mkdir(path.str, 0755), *p = '/';
+  mkdir(path.str, 0755);
+  bool made = (stat(path.str, &buf) == 0 && S_ISDIR(buf.st_mode));
+  sb_free(&path);
+  return made;
+}
+
+// writes the cached declassification keyed by "DC->cache_key" (if any) to "declass_filename",
+// returns whether one was found
+static bool fetch_cached_declassification(char *cache_dir, char *declass_filename) {
+  struct string_builder entry = {NULL, 0, 0}, cached = {NULL, 0, 0};
+  cache_entry_path(cache_dir, &entry);
+  bool found = (access(entry.str, R_OK) == 0);
+  if(found) {
+    scrape_file(entry.str, &cached);
+    FPUT(cached.str, cached.len, declass_filename);
+  }
+  sb_free(&entry);
+  sb_free(&cached);
+  return found;
+}
+
+// caches the declassified "declass_filename" under "DC->cache_key": written to a unique temp file 1st
+// & renamed into place, so concurrent declassifications (& CI jobs) never read a partial entry
+static void store_declassification_in_cache(char *cache_dir, char *declass_filename) {
+  struct string_builder entry = {NULL, 0, 0}, temp = {NULL, 0, 0}, declassified = {NULL, 0, 0};
+  FILE *fptr = NULL;
+  char resolved[PATH_MAX];
+  int fd = -1;
+  if(access(resolve_path(declass_filename, resolved), R_OK) != 0) return; // nothing declassified to cache
+  cache_entry_path(cache_dir, &entry);
+  sb_printf(&temp, "%s.XXXXXX", entry.str);
+  if(make_cache_dir(cache_dir) && (fd = mkstemp(temp.str)) >= 0 && (fptr = fdopen(fd, "w")) != NULL) {
+    scrape_file(declass_filename, &declassified);
+    bool written = (fwrite(declassified.str, 1, declassified.len, fptr) == (size_t)declassified.len);
+    if(fclose(fptr) != 0 || !written || rename(temp.str, entry.str) != 0) remove(temp.str);
+  } else {
+    if(fd >= 0) close(fd), remove(temp.str);
+    fprintf(DC_STDERR, "\033[1mdeclass.c:%03d: \033[33mWARNING:\033[0m\033[1m COULDN'T WRITE TO CACHE DIR \"%s\"!\033[0m\n", __LINE__, cache_dir);
+  }
+  sb_free(&entry);
+  sb_free(&temp);
+  sb_free(&declassified);
+}
+#endif
+
+/******************************************************************************
+* DECLASSIFIER
+******************************************************************************/
+
+// declassifies the braced & header-prepended "FILE_BUFFER" into "HEADED_NEW_FILE", headed w/ "filename"
+static void declassify(struct string_builder *FILE_BUFFER, char *filename, struct string_builder *HEADED_NEW_FILE) {
+  struct string_builder NEW_FILE = {NULL, 0, 0};
+  char *file_contents;
+  char *stop;
+  int i = 0, next_token = 0;
+  long unread_shift = 0; // chars spliced in ahead of the unread tokens (lexed before any class was parsed)
+  bool params_scoped = false; // whether the next '{' opens the body of a fcn whose scope opened at its parameters
+  struct token_stream stream = {NULL, 0, 0};
+
+  char dummy_ctor_invoking_obj_chain[MAX_TOKEN_NAME_LENGTH * 2], *read;
+  bool dummy_ctor_ptr_invoked, dummy_ctor_invoker_redefined;
+  int dummy_ctor_len;
+  FLOOD_ZEROS(dummy_ctor_invoking_obj_chain, MAX_TOKEN_NAME_LENGTH * 2);
+
+  sb_zero_pad(FILE_BUFFER, FILE_BUFFER_PADDING);
+  file_contents = FILE_BUFFER->str;
+
+  // dtors spliced into "file_contents" are written to "NEW_FILE" once read up to
+  DC->DTOR_SPLICE_BUFFER = file_contents;
+  start_DECLASS_H_chain_key();
+  lex_tokens(file_contents, &stream, false);
+
+  while(file_contents[i] != '\0') {
+    // write out any dtors spliced in prior the current char
+    emit_dtor_splices(&file_contents[i], &NEW_FILE);
+
+    // copy straight through to the next token parsed below (or the next dtor spliced in), never into strings
+    stop = next_token_stop(&file_contents[unread_shift], &stream, &next_token, &file_contents[i], "{}#(", false);
+    if(stop == NULL) stop = &file_contents[i] + strlen(&file_contents[i]);
+    stop = before_next_dtor_splice(stop);
+    if(stop > &file_contents[i]) {
+      sb_appendn(&NEW_FILE, &file_contents[i], stop - &file_contents[i]);
+      i = stop - file_contents;
+      continue;
+    }
+
+    // restore each "DECLASS_H_" header segment's cached parse if found (else parse it), marking it off
+    // in "NEW_FILE" only w/ "--split-headers"
+    if(i == 0 || file_contents[i-1] == '\n') {
+      if(is_at_substring(&file_contents[i], DECLASS_H_SEGMENT_START)) {
+        i = begin_DECLASS_H_segment(&file_contents[i], &NEW_FILE) - file_contents;
+        continue;
+      } else if(in_DECLASS_H_segment() && is_at_substring(&file_contents[i], DECLASS_H_SEGMENT_END)) {
+        i = end_DECLASS_H_segment(&file_contents[i], &NEW_FILE) - file_contents;
+        continue;
+      }
+    }
 
-          // check if class object is already initialized by user
-          int already_assigned = i;
-          while(file_contents[already_assigned] != '\0' && no_overlap(file_contents[already_assigned], "\n;,=")) 
-            ++already_assigned;
-          if(file_contents[already_assigned] == '=' && !objects[total_objects-1].is_alloced_class_pointer) {
-            add_object_dtor(&file_contents[i], true, false); 
-            break;
-          }
+    // store class info & convert to structs calling external fcns
+    if(is_at_substring(&file_contents[i], "class ") && (!VARCHAR(file_contents[i-1]))) {
+      // make room for any member ctor invocations spliced into the class ("dtor splices" are offsets, thus unmoved)
+      sb_zero_pad(FILE_BUFFER, class_ctor_splice_headroom(&file_contents[i]) + FILE_BUFFER_PADDING);
+      file_contents = DC->DTOR_SPLICE_BUFFER = FILE_BUFFER->str;
+      i += parse_class(&file_contents[i], &NEW_FILE);
+      long spliced = strlen(&file_contents[FILE_BUFFER->len]); // account for spliced ctors, all w/in the class
+      FILE_BUFFER->len += spliced, unread_shift += spliced;
+    }
 
-          // determine if object is invoking it's user-defined constructor
-          char *user_ctor_finder = &file_contents[i], user_ctor[1000];
-          FLOOD_ZEROS(user_ctor, 1000);
-          bool is_fcn_returning_obj = false;
-          bool user_ctor_invoked = get_user_ctor(user_ctor_finder,user_ctor,classes[k].class_name,&is_fcn_returning_obj);
+    // store declared class object info
+    bool dummy_ctor = false;
+    int k = class_at(&file_contents[i], DC->total_classes); // 1 class index probe per identifier
+    if(k != -1 && store_object_info(&file_contents[i], 0, &dummy_ctor)) do { // assign default values ('break' once handled)
+
+      // check if a so-called "dummy ctor" was detected and splice 
+      // in the "DC__DUMMY_" class/ctor name's prefix if so
+      if(dummy_ctor) {
+        read = &file_contents[i], dummy_ctor_ptr_invoked = dummy_ctor_invoker_redefined = false;
+        FLOOD_ZEROS(dummy_ctor_invoking_obj_chain, MAX_TOKEN_NAME_LENGTH * 2);
+        // flag the object to be destroyed again after being assigned to a dummy ctor (being that they're a new obj instance)
+        get_dummy_ctor_invoking_object_chain(read, dummy_ctor_invoking_obj_chain, k, &dummy_ctor_ptr_invoked, &dummy_ctor_invoker_redefined);
+        dummy_ctor_len = prefix_dummy_ctor_with_DC__DUMMY_(&NEW_FILE, read);
+        i += dummy_ctor_len;
+        // As per Documentation's "DECLASS.C CTORS & DTORS" > "FORMATTING" > "(2)", dummy ctors only 
+        // return single obj instances, thus "obj arrays" are presumed to be assigning one of their
+        // individual object "cells" w/in.
+        add_object_dtor(&file_contents[i], true, dummy_ctor_invoker_redefined); 
+        if(dummy_ctor_invoker_redefined) { // Don't add for new declarations
+          if(dummy_ctor_ptr_invoked)
+            sb_printf(&NEW_FILE, ";if(%s){%s->DC_DTR=&DC__NDTR;}", dummy_ctor_invoking_obj_chain, dummy_ctor_invoking_obj_chain);
+          else if(dummy_ctor_invoker_redefined)
+            sb_printf(&NEW_FILE, ";%s.DC_DTR=&DC__NDTR", dummy_ctor_invoking_obj_chain);
+        }
+        break;
+      }
 
-          // don't splice in any constructors if "object" is actually a fcn returning an object
-          if(is_fcn_returning_obj) break;
+      // check if class object is already initialized by user
+      int already_assigned = i;
+      while(file_contents[already_assigned] != '\0' && no_overlap(file_contents[already_assigned], "\n;,=")) 
+        ++already_assigned;
+      if(file_contents[already_assigned] == '=' && !DC->objects[DC->total_objects-1].is_alloced_class_pointer) {
+        add_object_dtor(&file_contents[i], true, false); 
+        break;
+      }
 
-          // initialization undefined -- use default initial values
-          while(file_contents[i] != '\0' && file_contents[i-1] != ';') NEW_FILE[j++] = file_contents[i++];
-          // if an obj ptr allocating memory, confirm obj != NULL prior to passing to ctors & dflt-val assignment
-          objects[total_objects-1].is_dangling_ctord_ptr = false; // ID dangling ptrs (no ctor/'='/alloc) to assign "objPtr=NULL" in "add_object_dtor()"
-          if(objects[total_objects-1].is_alloced_class_pointer) {
-            sprintf(&NEW_FILE[j], " if(%s){", objects[total_objects-1].object_name), j = strlen(NEW_FILE);
-          // if obj a ctor'd ptr but not alloc'd, still assign dangling ptr to NULL prior any CTOR's
-          } else if(objects[total_objects-1].is_class_pointer) {
-            sprintf(&NEW_FILE[j], " %s=NULL;", objects[total_objects-1].object_name), j = strlen(NEW_FILE);
-            objects[total_objects-1].is_dangling_ctord_ptr = true;
-          }
-          // only apply default values if either a non-ptr or an allocated ptr
-          if(!objects[total_objects-1].is_class_pointer || objects[total_objects-1].is_alloced_class_pointer) {
-            if(objects[total_objects-1].is_class_array)        // object = array, use macro init
-              sprintf(&NEW_FILE[j], " DC__%s_ARR(%s);", classes[k].class_name, objects[total_objects-1].object_name);
-            else if(objects[total_objects-1].is_class_pointer) // object != array, so init via its class' global object & init its "2-Be_Dtor'd" flag
-              sprintf(&NEW_FILE[j], " DC__%s_CTOR((*%s));%s->DC_DTR=&DC__NDTR;", 
-                classes[k].class_name, objects[total_objects-1].object_name, objects[total_objects-1].object_name);
-            else                                               // object != array, so init via its class' global object
-              sprintf(&NEW_FILE[j], " DC__%s_CTOR(%s);", classes[k].class_name, objects[total_objects-1].object_name);
-            j = strlen(NEW_FILE);
-          }
+      // determine if object is invoking it's user-defined constructor
+      char *user_ctor_finder = &file_contents[i], user_ctor[1000];
+      FLOOD_ZEROS(user_ctor, 1000);
+      bool is_fcn_returning_obj = false;
+      bool user_ctor_invoked = get_user_ctor(user_ctor_finder,user_ctor,DC->classes[k].class_name,&is_fcn_returning_obj);
+
+      // don't splice in any constructors if "object" is actually a fcn returning an object
+      if(is_fcn_returning_obj) break;
+
+      // initialization undefined -- use default initial values
+      while(file_contents[i] != '\0' && file_contents[i-1] != ';') sb_putc(&NEW_FILE, file_contents[i++]);
+      // if an obj ptr allocating memory, confirm obj != NULL prior to passing to ctors & dflt-val assignment
+      DC->objects[DC->total_objects-1].is_dangling_ctord_ptr = false; // ID dangling ptrs (no ctor/'='/alloc) to assign "objPtr=NULL" in "add_object_dtor()"
+      if(DC->objects[DC->total_objects-1].is_alloced_class_pointer) {
+        sb_printf(&NEW_FILE, " if(%s){", DC->objects[DC->total_objects-1].object_name);
+      // if obj a ctor'd ptr but not alloc'd, still assign dangling ptr to NULL prior any CTOR's
+      } else if(DC->objects[DC->total_objects-1].is_class_pointer) {
+        sb_printf(&NEW_FILE, " %s=NULL;", DC->objects[DC->total_objects-1].object_name);
+        DC->objects[DC->total_objects-1].is_dangling_ctord_ptr = true;
+      }
+      // only apply default values if either a non-ptr or an allocated ptr
+      if(!DC->objects[DC->total_objects-1].is_class_pointer || DC->objects[DC->total_objects-1].is_alloced_class_pointer) {
+        if(DC->objects[DC->total_objects-1].is_class_array)        // object = array, use macro init
+          sb_printf(&NEW_FILE, " DC__%s_ARR(%s);", DC->classes[k].class_name, DC->objects[DC->total_objects-1].object_name);
+        else if(DC->objects[DC->total_objects-1].is_class_pointer) // object != array, so init via its class' global object & init its "2-Be_Dtor'd" flag
+          sb_printf(&NEW_FILE, " DC__%s_CTOR((*%s));%s->DC_DTR=&DC__NDTR;", 
+            DC->classes[k].class_name, DC->objects[DC->total_objects-1].object_name, DC->objects[DC->total_objects-1].object_name);
+        else                                               // object != array, so init via its class' global object
+          sb_printf(&NEW_FILE, " DC__%s_CTOR(%s);", DC->classes[k].class_name, DC->objects[DC->total_objects-1].object_name);
+      }
 
-          // add user-defined ctor invocation w/ initialization values (if present)
-          if(user_ctor_invoked) { sprintf(&NEW_FILE[j], " %s", user_ctor); j = strlen(NEW_FILE); }
-          add_object_dtor(&file_contents[i], false, false); // splice in object's class dtor at the end of the current scope
+      // add user-defined ctor invocation w/ initialization values (if present)
+      if(user_ctor_invoked) sb_printf(&NEW_FILE, " %s", user_ctor);
+      add_object_dtor(&file_contents[i], false, false); // splice in object's class dtor at the end of the current scope
 
-          // if an obj ptr allocing memory, close the "if != null" braced-condition
-          if(objects[total_objects-1].is_alloced_class_pointer) NEW_FILE[j++] = '}';
-          break;
-        }
+      // if an obj ptr allocing memory, close the "if != null" braced-condition
+      if(DC->objects[DC->total_objects-1].is_alloced_class_pointer) sb_putc(&NEW_FILE, '}');
+    } while(false);
+
+    // write out dtors spliced in after any object declaration just parsed
+    emit_dtor_splices(&file_contents[i], &NEW_FILE);
 
     // modify object invoking method to fcn call w/ a prepended class-converted-struct name
-    if(in_token_scope && total_classes > 0) 
-      i += parse_method_invocation(&file_contents[i], NEW_FILE, &j, false, filler_array_argument);
+    if(DC->total_classes > 0) 
+      i += parse_method_invocation(&file_contents[i], &NEW_FILE, false, DC->METHOD_WORDS); // (unused unless nested)
+
+    // track brace scopes for the object symbol table: a global fcn definition's scope opens at its parameter
+    // list (as do methods' in "parse_class()"), so its parameters are dropped w/ its body's closing '}'
+    if(file_contents[i] == '(' && DC->OBJECT_SCOPE_DEPTH == 0
+      && opens_fcn_definition_params(&file_contents[unread_shift], &stream, &file_contents[i])) {
+      push_object_scope();
+      params_scoped = true;
+    } else if(file_contents[i] == '{') {
+      if(!params_scoped) push_object_scope();
+      params_scoped = false;
+    } else if(file_contents[i] == '}') {
+      pop_object_scope();
+    }
 
     // save non-class data to file
-    NEW_FILE[j++] = file_contents[i++]; 
+    sb_putc(&NEW_FILE, file_contents[i++]);
   }
-  NEW_FILE[j] = '\0';
-
+  emit_dtor_splices(&file_contents[i], &NEW_FILE);
+  free_token_stream(&stream);
+  if(in_DECLASS_H_segment()) DC->header_segments[DC->total_header_segments - 1].end = NEW_FILE.len;
 
-  // finishing touches -- remove spaces, write to file the struct / methods-turned-fcns / general file 
-  // buffers, pass to "cola.c", output class object details as per "-l" flag, & GCC compile as needed.
-  trim_sequential_spaces(NEW_FILE);
+  // finishing touches -- remove spaces (moving the header segments' spans w/ their text), & head the
+  // struct / methods-turned-fcns / general file buffers
+  NEW_FILE.len = (NEW_FILE.len > 0) ? trim_sequential_spaces(NEW_FILE.str, DC->header_segments, DC->total_header_segments) : 0;
 
-  char HEADED_NEW_FILE[MAX_FILESIZE]; FLOOD_ZEROS(HEADED_NEW_FILE, MAX_FILESIZE);
+  sb_reserve(HEADED_NEW_FILE, HEADED_NEW_FILE->len + NEW_FILE.len + strlen(DC_SMART_POINTER_H_) + 1000);
 
   // determine if ought to include smrtptr.h/"immortal"-keyword at top of file - as per whether
   // "#define DECLASS_NSMRTPTR" or "#define DECLASS_NIMMORTAL" wasn't/was found
-  char *headed_new_file_ptr = HEADED_NEW_FILE;
-  sprintf(headed_new_file_ptr,"/* DECLASSIFIED: %s\n * %s\n", filename, DC_SUPPORT_CONTACT);
-  headed_new_file_ptr += strlen(headed_new_file_ptr);
-  if(*IMMORTALITY)   sprintf(headed_new_file_ptr,"%s", IMMORTAL_KEYWORD_DEF); // include "immortal" keyword if active
-  headed_new_file_ptr += strlen(headed_new_file_ptr);
-  if(NO_SMRTASSERT) sprintf(headed_new_file_ptr,"%s", NDEBUG_SMRTPTR_DEF);    // disable smrtptr.h smrtassert() if active
-  headed_new_file_ptr += strlen(headed_new_file_ptr);
-  if(*SMRT_PTRS)     sprintf(headed_new_file_ptr,"%s", DC_SMART_POINTER_H_);  // include smrtptr.h if active
-  headed_new_file_ptr += strlen(headed_new_file_ptr);
-  sprintf(headed_new_file_ptr,"\n\n%s", NEW_FILE);
-
+  sb_printf(HEADED_NEW_FILE, "/* DECLASSIFIED: %s\n * %s\n", filename, DC->EXTERNAL_RUNTIME ? DC_SUPPORT_EMAIL : DC_SUPPORT_CONTACT);
+  if(*DC->IMMORTALITY)   sb_append(HEADED_NEW_FILE, IMMORTAL_KEYWORD_DEF); // include "immortal" keyword if active
+  if(DC->NO_SMRTASSERT) sb_append(HEADED_NEW_FILE, NDEBUG_SMRTPTR_DEF);    // disable smrtptr.h smrtassert() if active
+  if(DC->THREADSAFE_SMRTPTR && !DC->EXTERNAL_RUNTIME)                        // lock smrtptr.h's garbage collector if active
+    sb_append(HEADED_NEW_FILE, THREADSAFE_SMRTPTR_DEF);
+  if(DC->EXTERNAL_RUNTIME) {                                                 // or declare it & "DC__NDTR" from "declass_rt.c"
+    sb_append(HEADED_NEW_FILE, "#include \"" DECLASS_RT_H "\"");
+    if(*DC->SMRT_PTRS && *DC->NOISY_SMRTPTR)
+      fprintf(DC_STDERR, "\033[1mdeclass.c:%03d: \033[33mWARNING:\033[0m\033[1m \"DECLASS_NOISYSMRTPTR\" ONLY ALERTS W/ \"--runtime=inline\"!\033[0m\n", __LINE__);
+  } else if(*DC->SMRT_PTRS) {                                                // include smrtptr.h if active
+    long smrtptr_h = HEADED_NEW_FILE->len;
+    sb_append(HEADED_NEW_FILE, DC_SMART_POINTER_H_);
+    // uncomment smrtptr.h's alerts if user included "#define DECLASS_NOISYSMRTPTR"
+    if(*DC->NOISY_SMRTPTR) enable_smrtptr_alerts(&HEADED_NEW_FILE->str[smrtptr_h]);
+  }
+  sb_append(HEADED_NEW_FILE, "\n\n");
+  for(i = 0; i < DC->total_header_segments; ++i) { // spans in "HEADED_NEW_FILE" for cola.c, w/o the whitespace
+    struct header_segment *seg = &DC->header_segments[i];   // trimmed together w/ the text around them
+    while(seg->start < seg->end && IS_WHITESPACE(NEW_FILE.str[seg->start])) ++seg->start;
+    while(seg->end > seg->start && IS_WHITESPACE(NEW_FILE.str[seg->end - 1])) --seg->end;
+    seg->start += HEADED_NEW_FILE->len, seg->end += HEADED_NEW_FILE->len;
+  }
+  if(NEW_FILE.len > 0) sb_appendn(HEADED_NEW_FILE, NEW_FILE.str, NEW_FILE.len);
+  sb_free(&NEW_FILE);
+}
 
-  // notify user declassification conversion completed
-  declass_DECLASSIFIED_ascii_art();
-  printf("%s \033[1m==DECLASSIFIED=>\033[0m ", filename);
-  if(NO_COLA_PARSER) 
-    NEW_EXTENSION(filename, "_DECLASS.c");
-  else
-    NEW_EXTENSION(filename, "_DECLASS_PRECOLA.c");
-  printf("%s", filename);
-  if(show_class_info || !NO_COLA_PARSER || NO_COMPILE) 
-    printf("\n=================================================================================");
-  if(show_class_info || !NO_COLA_PARSER) printf("\n");
+/******************************************************************************
+* DECLASSIFICATION STATE & EXIT FUNCTIONS
+******************************************************************************/
 
-  // write newly converted/declassified file & notify user as to whether passing to "COLA.C" or not
-  FPUT(HEADED_NEW_FILE,filename);
+// allocates a declassification state w/ every table empty & flag at its default (NULL if out of memory)
+static struct declass_state *new_declass_state() {
+  struct declass_state *state = calloc(1, sizeof(struct declass_state)); // (untouched pages are never committed)
+  if(state == NULL) return NULL;
+  state->DEFNS = DEFAULT_DEFNS;
+  state->NO_DECLASS    = &state->DEFNS.defaults[0];
+  state->STRICT_MODE   = &state->DEFNS.defaults[1];
+  state->SMRT_PTRS     = &state->DEFNS.defaults[2];
+  state->IMMORTALITY   = &state->DEFNS.defaults[3];
+  state->DTOR_RETURN   = &state->DEFNS.defaults[4];
+  state->NOISY_SMRTPTR = &state->DEFNS.defaults[5];
+  state->max_classes = state->max_objects = state->max_alloc_fcns = 16; // grown geometrically as parsed
+  state->classes = calloc(state->max_classes, sizeof(struct class_info));
+  state->objects = calloc(state->max_objects, sizeof(struct objNames));
+  state->ALLOC_FCNS = calloc(state->max_alloc_fcns, sizeof(state->ALLOC_FCNS[0]));
+  if(state->classes == NULL || state->objects == NULL || state->ALLOC_FCNS == NULL) {
+    free(state->classes), free(state->objects), free(state->ALLOC_FCNS), free(state);
+    return NULL;
+  }
+  state->TOTAL_ALLOC_FCNS = 4; // increases if user defines their own allocation fcns
+  memcpy(state->ALLOC_FCNS, DEFAULT_ALLOC_FCNS, sizeof(DEFAULT_ALLOC_FCNS));
+  state->out = stdout, state->err = stderr;
+  return state;
+}
 
-  // if passing to "cola.c"
-  if(!NO_COLA_PARSER) {
-    printf("\033[1m >> RUNNING COLA.C:\033[0m\n=================================================================================\n");
-    found_COLA_overloads = COLA_C_main_execution(show_class_info, filename);
-    if(!save_temp_files && found_COLA_overloads) remove(filename); // remove temporary "precola" file if overloads were found
-  } 
+// frees "state" & every table it allocated
+static void free_declass_state(struct declass_state *state) {
+  int i;
+  free(state->fmacs);
+  for(i = 0; i < state->overload_fmacs_max; ++i)
+    free(state->overload_fmacs[i].arg_sizes), free(state->overload_fmacs[i].is_a_macro);
+  free(state->overload_fmacs);
+  for(i = 0; i < state->all_dflt_fcns_max; ++i)
+    free(state->all_dflt_fcns[i].dflt_idxs), free(state->all_dflt_fcns[i].dflt_vals);
+  free(state->all_dflt_fcns);
+  for(i = 0; i < state->unique_dflt_fcns_max; ++i) { // idxs & values are shared w/ "all_dflt_fcns"
+    free(state->unique_dflt_fcns[i].arg_sizes), free(state->unique_dflt_fcns[i].total_dflts);
+    free(state->unique_dflt_fcns[i].dflt_idxs), free(state->unique_dflt_fcns[i].dflt_vals);
+  }
+  free(state->unique_dflt_fcns);
+  free(state->cola_names);
+  for(i = 0; i < state->DFLT_VALUES.max; ++i) free(state->DFLT_VALUES.strs[i]);
+  free(state->DFLT_VALUES.strs);
+  for(i = 0; i < state->max_classes; ++i) free_name_index(&state->classes[i].method_index);
+  free(state->classes), free(state->objects), free(state->ALLOC_FCNS);
+  free_name_index(&state->CLASS_INDEX);
+  free_name_index(&state->IDENTIFIER_INDEX);
+  free_name_index(&state->OBJECT_INDEX);
+  for(i = 0; i < state->total_dtor_splices; ++i) free(state->DTOR_SPLICES[i].dtor);
+  free(state->DTOR_SPLICES);
+  for(i = 0; i < state->total_header_segments; ++i)
+    if(state->header_segments[i].parsed != NULL) release_parsed_DECLASS_H_header(state->header_segments[i].parsed);
+  free(state->header_segments);
+  for(i = 0; i < state->total_precompiled_headers; ++i) release_parsed_DECLASS_H_header(state->precompiled_headers[i]);
+  free(state->precompiled_headers);
+  free(state);
+}
 
-  // if compiling & cola-overloaded
-  if(!NO_COLA_PARSER && !NO_COMPILE) {
-    // cola.c creates a new file w/ the original filename + "_DECLASS.c" on success
-    FLOOD_ZEROS(filename, MAX_TOKEN_NAME_LENGTH);
-    sprintf(filename, "%s_DECLASS.c", original_filename_executable);
+// ends the current declassification w/ "status": returns to its "fatal_error_exit" if set (libdeclass & batch mode), else exits
+static void declass_exit(int status) {
+  if(DC != NULL && DC->fatal_error_exit != NULL) {
+    DC->exit_status = status;
+    longjmp(*DC->fatal_error_exit, 1);
   }
+  exit(status);
+}
+
+/******************************************************************************
+* LIBDECLASS API (SEE "declass.h")
+******************************************************************************/
+
+declass_ctx *declass_new(const struct declass_options *opts) {
+  declass_ctx *ctx = calloc(1, sizeof(declass_ctx));
+  if(ctx != NULL && opts != NULL) ctx->options = *opts;
+  return ctx;
+}
 
-  // show "-l" flag class info & (if applicable/able) compile program
-  if(show_class_info) show_l_flag_data();
+// declassifies (& COLA overloads) the "len" chars at "src" into "output", under the current thread's "DC" state
+static void transpile_source(declass_ctx *ctx, const char *src, size_t len, struct string_builder *output) {
+  struct string_builder source = {NULL, 0, 0}, FILE_BUFFER = {NULL, 0, 0}, HEADED_NEW_FILE = {NULL, 0, 0};
+  char *filename = (ctx->options.filename != NULL) ? (char *)ctx->options.filename : "declass_input.c";
+  if(len > 0) sb_appendn(&source, (char *)src, len);
+  sb_zero_pad(&source, FILE_BUFFER_PADDING);
+  include_all_DECLASS_H_headers(source.str, &FILE_BUFFER);
+  sb_free(&source);
+  declassify(&FILE_BUFFER, filename, &HEADED_NEW_FILE);
+  sb_free(&FILE_BUFFER);
+  if(!DC->NO_COLA_PARSER && COLA_C_overload(HEADED_NEW_FILE.str, output)) {
+    sb_free(&HEADED_NEW_FILE);
+  } else { // nothing overloaded: the declassified file is the output
+    sb_free(output);
+    *output = HEADED_NEW_FILE;
+  }
+}
 
-  // generate compilation cmd
-  char compile_cmd[(MAX_TOKEN_NAME_LENGTH * 2) + 10];
-  FLOOD_ZEROS(compile_cmd, (MAX_TOKEN_NAME_LENGTH * 2) + 10);
-  if(!NO_COMPILE && NO_C11_COMPILE_FLAG)
-    sprintf(compile_cmd, "gcc -o %s %s", original_filename_executable, filename);
-  else if(!NO_COMPILE)
-    sprintf(compile_cmd, "gcc -std=c11 -o %s %s", original_filename_executable, filename);
-  if(!NO_COMPILE) {
-    printf("\n=================================================================================\n");
-    printf("%s \033[1m=GCC=COMPILES=TO=>\033[0m %s", filename, original_filename_executable);
-    printf("\n=================================================================================\n");
+int declass_transpile(declass_ctx *ctx, const char *src, size_t len, char **out, size_t *outlen) {
+  jmp_buf fatal_error_exit;
+  struct declass_state *state = new_declass_state();
+  struct string_builder *output = calloc(1, sizeof(struct string_builder)); // (heap-held to outlive a "longjmp")
+  *out = NULL, *outlen = 0;
+  if(state == NULL || output == NULL) {
+    if(state != NULL) free_declass_state(state);
+    free(output);
+    return DECLASS_ERROR;
   }
-  if(!NO_COMPILE) { 
-    printf("\033[1mCOMPILING CONVERTED CODE:\033[0m\n  $ %s", compile_cmd);
-    printf("\n=================================================================================\n");
-    system(compile_cmd); // compile the declassified/converted code
+  state->fatal_error_exit = &fatal_error_exit;
+  state->NO_COMPILE = true;
+  state->NO_COLA_PARSER = ctx->options.no_cola;
+  state->EXTERNAL_RUNTIME = ctx->options.external_runtime;
+  DC = state;
+  if(setjmp(fatal_error_exit) == 0) {
+    transpile_source(ctx, src, len, output);
+    *out = output->str, *outlen = output->len;
+  } else { // fatal error: buffers of the interrupted pass itself aren't recovered
+    sb_free(output);
   }
-  
-  // Based on prior '=' sign divider output
-  if((NO_COMPILE && show_class_info) || (NO_COMPILE && !show_class_info && !found_COLA_overloads && !NO_COLA_PARSER)) 
-    printf("\n=============================\n");
-  else if(NO_COMPILE && !show_class_info && !found_COLA_overloads && NO_COLA_PARSER)
-    printf("\n");
-  printf(" >> Terminating Declassifier.\n");
-  printf("=============================\n\n");
+  DC = NULL;
+  free_declass_state(state);
+  free(output);
+  return (*out != NULL) ? DECLASS_OK : DECLASS_ERROR;
+}
 
-  return 0;
+void declass_free(declass_ctx *ctx) {
+  free(ctx);
 }
 
 /******************************************************************************
 * BRACE-ADDITION FUNCTION
 ******************************************************************************/
 
-// detect & register "smrtassert" & "no C11"/"no compile" macro flags
-bool at_smrtassert_or_compile_or_cola_macro_flag(char *p) {
+// detect & register "smrtassert"/"threadsafe" & "no C11"/"no compile" macro flags
+static bool at_smrtassert_or_compile_or_cola_macro_flag(char *p) {
   bool found_macro = false;
   if(is_at_substring(p, "DECLASS_NDEBUG") && !VARCHAR(*(p+strlen("DECLASS_NDEBUG")))) 
-    NO_SMRTASSERT = true, found_macro = true;
+    DC->NO_SMRTASSERT = true, found_macro = true;
   else if(is_at_substring(p, "DECLASS_NC11") && !VARCHAR(*(p+strlen("DECLASS_NC11")))) 
-    NO_C11_COMPILE_FLAG = true, found_macro = true;
+    DC->NO_C11_COMPILE_FLAG = true, found_macro = true;
   else if(is_at_substring(p, "DECLASS_NCOMPILE") && !VARCHAR(*(p+strlen("DECLASS_NCOMPILE")))) 
-    NO_COMPILE = true, found_macro = true;
+    DC->NO_COMPILE = true, found_macro = true;
   else if(is_at_substring(p, "DECLASS_NCOLA") && !VARCHAR(*(p+strlen("DECLASS_NCOLA"))))
-    NO_COLA_PARSER = true, found_macro = true;
+    DC->NO_COLA_PARSER = true, found_macro = true;
+  else if(is_at_substring(p, "DECLASS_THREADSAFE") && !VARCHAR(*(p+strlen("DECLASS_THREADSAFE"))))
+    DC->THREADSAFE_SMRTPTR = true, found_macro = true;
   return found_macro;
 }
 
 // add braces around any "braceless" single-line conditionals & while/for loops 
 // and detects any "#define"'d flags by the user to guide this interpreter's course
-void add_braces(char file_contents[]) {
-  char BRACED_FILE[MAX_FILESIZE];
-  int k, i = 0, j = 0, in_brace_args = 0;
-  FLOOD_ZEROS(BRACED_FILE, MAX_FILESIZE);
-  BRACED_FILE[j++] = file_contents[i++]; // so "file_contents[i-1]" won't throw error
+static void add_braces(struct string_builder *cleaned_file, struct string_builder *BRACED_FILE) {
+  char *file_contents = cleaned_file->str;
+  long i = 0;
+  int k, in_brace_args = 0;
+  if(cleaned_file->len == 0) return;
+  sb_reserve(BRACED_FILE, BRACED_FILE->len + cleaned_file->len + cleaned_file->len / 8); // braces added are sparse
+  sb_putc(BRACED_FILE, file_contents[i++]); // so "file_contents[i-1]" won't throw error
   bool in_a_string = false, in_a_char = false, in_token_scope = true;
 
   while(file_contents[i] != '\0') {
     account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, &file_contents[i]);
     // check whether user defined any of the flags in the "DEFN" struct, (STRICT_MODE supersedes all)
-    if(in_token_scope && file_contents[i] == '\n' && !(*STRICT_MODE) && !(*NO_DECLASS)) {
-      int l = i;
+    if(in_token_scope && file_contents[i] == '\n' && !(*DC->STRICT_MODE) && !(*DC->NO_DECLASS)) {
+      long l = i;
       while(IS_WHITESPACE(file_contents[l])) ++l;
       if(file_contents[l] == '#') {
         ++l;
@@ -840,11 +3041,10 @@ void add_braces(char file_contents[]) {
           if(at_smrtassert_or_compile_or_cola_macro_flag(&file_contents[l]))
             while(file_contents[l] != '\0' && (file_contents[l] != '\n' || file_contents[l-1] == '\\')) ++l;
           for(; flag < TOTAL_FLAGS; ++flag)
-            if(is_at_substring(&file_contents[l], DEFNS.flags[flag]) 
-              && !VARCHAR(file_contents[l+strlen(DEFNS.flags[flag])])) {               
-              DEFNS.defaults[flag] = DEFNS.non_dflt[flag], i = l + strlen(DEFNS.flags[flag]);
-              sprintf(&BRACED_FILE[j], "\n#define %s", DEFNS.flags[flag]);
-              j = strlen(BRACED_FILE);
+            if(is_at_substring(&file_contents[l], DC->DEFNS.flags[flag]) 
+              && !VARCHAR(file_contents[l+strlen(DC->DEFNS.flags[flag])])) {               
+              DC->DEFNS.defaults[flag] = DC->DEFNS.non_dflt[flag], i = l + strlen(DC->DEFNS.flags[flag]);
+              sb_printf(BRACED_FILE, "\n#define %s", DC->DEFNS.flags[flag]);
               break;
             }
           if(flag < TOTAL_FLAGS) continue; // check for consecutive flags
@@ -853,10 +3053,10 @@ void add_braces(char file_contents[]) {
     }
 
     // confirm "#define DECLASS_IGNORE" not found
-    if(*NO_DECLASS) throw_DECLASS_IGNORE_message_and_terminate();
-    if(*STRICT_MODE) {
-      *SMRT_PTRS = *IMMORTALITY = false;
-      *DTOR_RETURN = true;
+    if(*DC->NO_DECLASS) throw_DECLASS_IGNORE_message_and_terminate();
+    if(*DC->STRICT_MODE) {
+      *DC->SMRT_PTRS = *DC->IMMORTALITY = false;
+      *DC->DTOR_RETURN = true;
     }
 
     // check for else if, if, else, while, & for
@@ -864,178 +3064,419 @@ void add_braces(char file_contents[]) {
       if(is_at_substring(&file_contents[i],brace_keywords[k]) && !VARCHAR(file_contents[i-1]) && file_contents[i-1] != '#' 
         && !VARCHAR(file_contents[i+strlen(brace_keywords[k])])) {                    // at a "brace keyword"
         for(int l = 0, len = strlen(brace_keywords[k]); l < len; ++l)                 // skip brace keyword
-          BRACED_FILE[j++] = file_contents[i++]; 
+          sb_putc(BRACED_FILE, file_contents[i++]); 
         while(IS_WHITESPACE(file_contents[i]))                      // skip optional space btwn keyword & '('
-          BRACED_FILE[j++] = file_contents[i++];
+          sb_putc(BRACED_FILE, file_contents[i++]);
         if(file_contents[i] == '(' || strcmp(brace_keywords[k], "else") == 0) {       // actual brace keyword
           if(file_contents[i] == '(') {                                               // not else
-            BRACED_FILE[j++] = file_contents[i++];                                    // move past '('
+            sb_putc(BRACED_FILE, file_contents[i++]);                                    // move past '('
             in_brace_args = 1;
             while(file_contents[i] != '\0' && in_brace_args > 0) {                    // copy brace keywords args
               account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, &file_contents[i]);
               if(file_contents[i] == '(')      ++in_brace_args;
               else if(file_contents[i] == ')') --in_brace_args;
-              BRACED_FILE[j++] = file_contents[i++]; 
+              sb_putc(BRACED_FILE, file_contents[i++]); 
             }
           }
           while(file_contents[i] != '\0' && IS_WHITESPACE(file_contents[i])) { // skip to 1st st8ment after brace keyword
             account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, &file_contents[i]);
-            BRACED_FILE[j++] = file_contents[i++]; 
+            sb_putc(BRACED_FILE, file_contents[i++]); 
           }
           if(file_contents[i] == ';' || file_contents[i] == '{'                // braced keyword or do-while loop
           ||(file_contents[i]=='d'&&file_contents[i+1]=='o'&&!VARCHAR(file_contents[i+2]))) break;
-          BRACED_FILE[j++] = '{';                                              // add brace
+          sb_putc(BRACED_FILE, '{');                                              // add brace
           while(file_contents[i] != '\0' && file_contents[i-1] != ';') {       // copy single-line conditional
             account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, &file_contents[i]);
-            BRACED_FILE[j++] = file_contents[i++]; 
+            sb_putc(BRACED_FILE, file_contents[i++]); 
           }
-          BRACED_FILE[j++] = '}';                                              // add brace
+          sb_putc(BRACED_FILE, '}');                                              // add brace
         }
         break;                                                                 // found brace keyword, don't check others
       }
-    BRACED_FILE[j++] = file_contents[i++];
+    sb_putc(BRACED_FILE, file_contents[i++]);
   }
-  BRACED_FILE[j] = '\0';
-  FLOOD_ZEROS(file_contents, MAX_FILESIZE);
-  strcpy(file_contents, BRACED_FILE); // use "braced" file variant as official file
 }
 
 /******************************************************************************
 * "DECLASS_H_" HEADER FILE LINKING FUNCTIONS
 ******************************************************************************/
 
-// parses the file for any "DECLASS_H_" header files & splices them in to the front of the "file_buffer"
-void scrape_and_include_all_DECLASS_H_headers(char *file_buffer) {
-  int original_declass_header_file_count = 0, i;
-  char header_file_contents[MAX_FILESIZE];
-  while(true) { // in case "DECLASS_H_" header files included their own other "DECLASS_H_" header files
-    original_declass_header_file_count = TOTAL_DECLASS_HEADER_FILES;
-    parse_file_for_DECLASS_H_header_files(file_buffer);
-    // if new "DECLASS_H_" header files not found
-    if(TOTAL_DECLASS_HEADER_FILES <= original_declass_header_file_count) break;
-    for(i = original_declass_header_file_count; i < TOTAL_DECLASS_HEADER_FILES; ++i)
-      if(is_valid_DECLASS_H_header_file(DECLASS_HEADER_FILE_NAMES[i])) {
-        // if valid file to scrape & prepend to current file buffer, 
-        // scrape header file contents & prepend to current file buffer
-        FLOOD_ZEROS(header_file_contents, MAX_FILESIZE);
-        FSCRAPE(header_file_contents, DECLASS_HEADER_FILE_NAMES[i]);
-        sprintf(&header_file_contents[strlen(header_file_contents)], "%s\n", file_buffer);
-        FLOOD_ZEROS(file_buffer, MAX_FILESIZE);
-        strcpy(file_buffer, header_file_contents);
-        // remove all new potential comments, trime redundant whitespaces, & check for the reserved "DC_" prefix
-        whitespace_all_comments(file_buffer);
-        trim_sequential_spaces(file_buffer);
-        confirm_no_reserved_DC_prefix(file_buffer);
+#ifndef DECLASS_LIBRARY
+// scrapes "filename" & includes its "DECLASS_H_" header files into "file_buffer" (see below)
+static void scrape_and_include_all_DECLASS_H_headers(char *filename, struct string_builder *file_buffer) {
+  struct string_builder source = {NULL, 0, 0};
+  scrape_file(filename, &source);
+  include_all_DECLASS_H_headers(source.str, file_buffer);
+  sb_free(&source);
+}
+#endif
+
+// cleans "file_source" & every "DECLASS_H_" header file it (transitively) includes once each, then adds braces
+// to them all into "file_buffer" w/ the headers spliced in front (each new header found prepended in turn)
+static void include_all_DECLASS_H_headers(char *file_source, struct string_builder *file_buffer) {
+  struct string_builder source = {NULL, 0, 0}, cleaned_file = {NULL, 0, 0}, cleaned_headers = {NULL, 0, 0};
+  struct string_builder *header_files = calloc(MAX_DECLASS_HEADER_FILES, sizeof(struct string_builder));
+  bool include_header_file[MAX_DECLASS_HEADER_FILES];
+  int round_start = 0, round_end, i;
+  if(header_files == NULL) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR DECLASS HEADER FILES!\033[0m\n\n", __LINE__);
+    declass_exit(EXIT_FAILURE);
+  }
+  if(DC->hash_sources) cache_key_add(file_source, strlen(file_source));
+  clean_source(file_source, &cleaned_file); // registers the file's "DECLASS_H_" header files
+  // in case "DECLASS_H_" header files included their own other "DECLASS_H_" header files
+  while(round_start < DC->TOTAL_DECLASS_HEADER_FILES) {
+    round_end = DC->TOTAL_DECLASS_HEADER_FILES;
+    for(i = round_start; i < round_end; ++i)
+      include_header_file[i] = is_valid_DECLASS_H_header_file(DC->DECLASS_HEADER_FILE_NAMES[i]);
+    for(i = round_end - 1; i >= round_start; --i) { // clean in the order they'd sit in the file once prepended
+      if(!include_header_file[i]) continue;
+      sb_truncate(&source, 0);
+      bool cleaned = fetch_precompiled_header(DC->DECLASS_HEADER_FILE_NAMES[i], &header_files[i]);
+      if(!cleaned && SERVED_HEADERS.serving) // fills "source" unless cached & unneeded
+        cleaned = fetch_served_header(DC->DECLASS_HEADER_FILE_NAMES[i], &source, &header_files[i]);
+      else if(!cleaned || DC->hash_sources)
+        scrape_file(DC->DECLASS_HEADER_FILE_NAMES[i], &source);
+      if(DC->hash_sources) {
+        cache_key_add(DC->DECLASS_HEADER_FILE_NAMES[i], strlen(DC->DECLASS_HEADER_FILE_NAMES[i]));
+        cache_key_add(source.str, source.len);
       }
+      if(!cleaned && SERVED_HEADERS.serving)
+        clean_and_serve_header(DC->DECLASS_HEADER_FILE_NAMES[i], &source, &header_files[i]);
+      else if(!cleaned)
+        clean_source(source.str, &header_files[i]);
+    }
+    round_start = round_end;
+  }
+  sb_free(&source);
+  // splice the headers in front of the file, latest found 1st, & add braces to the result
+  if(DC->TOTAL_DECLASS_HEADER_FILES > 0) {
+    for(i = DC->TOTAL_DECLASS_HEADER_FILES - 1; i >= 0; --i)
+      if(include_header_file[i]) {
+        sb_printf(&cleaned_headers, DECLASS_H_SEGMENT_START "%s\"\n", DC->DECLASS_HEADER_FILE_NAMES[i]);
+        sb_appendn(&cleaned_headers, header_files[i].str, header_files[i].len);
+        sb_putc(&cleaned_headers, '\n');
+        sb_append(&cleaned_headers, DECLASS_H_SEGMENT_END);
+        sb_free(&header_files[i]);
+      }
+    sb_appendn(&cleaned_headers, cleaned_file.str, cleaned_file.len);
+    sb_free(&cleaned_file);
+    cleaned_file = cleaned_headers;
   }
+  free(header_files);
+  add_braces(&cleaned_file, file_buffer);
+  sb_free(&cleaned_file);
 }
 
 // confirms "DECLASS_H_" header file exists & returns (if "quit" not chosen by user)
 // whether to include the header file's contents (if valid) or not (if user chose "continue")
-bool is_valid_DECLASS_H_header_file(char *filename) {
+static bool is_valid_DECLASS_H_header_file(char *filename) {
   struct stat buf;
+  char resolved[PATH_MAX];
   bool parse_header_file = true;
-  if(stat(filename, &buf)) {
-    fprintf(stderr, "\033[1mdeclass.c:%03d: \033[33mWARNING:\033[0m\033[1m DECLASS HEADER FILE \"%s\" WAS NOT FOUND!\033[0m\n", __LINE__, filename);
+  if(stat(resolve_path(filename, resolved), &buf)) {
+    fprintf(DC_STDERR, "\033[1mdeclass.c:%03d: \033[33mWARNING:\033[0m\033[1m DECLASS HEADER FILE \"%s\" WAS NOT FOUND!\033[0m\n", __LINE__, filename);
+    ask_user_whether_to_quit_or_continue_declassification();
+    parse_header_file = false;
+  } else if(buf.st_size == 0) {
+    fprintf(DC_STDERR, "\033[1mdeclass.c:%03d: \033[33mWARNING:\033[0m\033[1m CAN'T DECLASSIFY AN EMPTY FILE!\033[0m\n", __LINE__); 
     ask_user_whether_to_quit_or_continue_declassification();
     parse_header_file = false;
-  } else {
-    CUMULATIVE_FILESIZE += (buf.st_size + 1); // +1 for '\n' btwn files
-    if(CUMULATIVE_FILESIZE > MAX_FILESIZE || buf.st_size == 0) {
-      if(CUMULATIVE_FILESIZE > MAX_FILESIZE) {
-        fprintf(stderr, "\033[1mdeclass.c:%03d: \033[33mWARNING:\033[0m\033[1m CUMULATIVE FILESIZE %lld EXCEEDED!\033[0m\n", __LINE__, CUMULATIVE_FILESIZE);
-        fprintf(stderr, " >> DECLASS HEADER FILE \"%s\" SIZE %lld BYTES, IN ADDITION TO THE MAIN PROGRAM &\n", filename, buf.st_size);
-        fprintf(stderr, "    ITS SPLICED-IN \"declass_\" HEADER FILES, EXCEEDED THE %d BYTE CAP!\n", MAX_FILESIZE); 
-        fprintf(stderr, " >> RAISE 'MAX_FILESIZE' MACRO LIMIT!\n");
-      } else fprintf(stderr, "\033[1mdeclass.c:%03d: \033[33mWARNING:\033[0m\033[1m CAN'T DECLASSIFY AN EMPTY FILE!\033[0m\n", __LINE__); 
-      ask_user_whether_to_quit_or_continue_declassification();
-      parse_header_file = false;
-    }
   }
   return parse_header_file;
 }
 
 // confirms declass header not already stored (prevents duplicate inclusions/splicing in)
-bool is_unique_DECLASS_H_header(char *scraped_declass_header_name) {
-  for(int i = 0; i < TOTAL_DECLASS_HEADER_FILES; ++i)
-    if(strcmp(DECLASS_HEADER_FILE_NAMES[i], scraped_declass_header_name) == 0)
+static bool is_unique_DECLASS_H_header(char *scraped_declass_header_name) {
+  for(int i = 0; i < DC->TOTAL_DECLASS_HEADER_FILES; ++i)
+    if(strcmp(DC->DECLASS_HEADER_FILE_NAMES[i], scraped_declass_header_name) == 0)
       return false;
   return true;
 }
 
-// parses file to scrape any "DECLASS_H_" prefixed header files 
-// & whitespaces them out of the buffer
-void parse_file_for_DECLASS_H_header_files(char *file_buffer) {
-  bool in_a_string = false, in_a_char = false, in_token_scope = true;
-  char *p = file_buffer, *q, *scout, *include_start, scraped_declass_header_name[MAX_TOKEN_NAME_LENGTH + 8];
-  char bad_code_buffer[BAD_CODE_BUFFER_LENGTH];
-  int include_lowercased_declass_header_file = 0;
-  while(*p != '\0') {
-    account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, p);
-    if(in_token_scope && is_at_substring(p, "#include") && !VARCHAR(*(p + 8))) { // at a potential "DECLASS_H_" header file
-      include_start = p;
-      scout = p - (p != file_buffer);               // confirm at a valid "#include"
-      // skip optional whitespace prior "#include"
-      while(IS_WHITESPACE(*scout) && *scout != '\n' && scout != file_buffer) --scout; 
-      // if invalid #include
-      if(scout != file_buffer && *scout != '\n') { 
-        ++p; 
-        continue;
-      }
-      p += 8;
-      // skip optional whitespace after "#include"
-      while(*p != '\0' && IS_WHITESPACE(*p)) ++p; 
-      ++p; // skip '"' or '<' (a bit presumptuous someone might have a "DECLASS_H_" header in their sys files but hey its called future proofing)
-      // if not a declass header
-      if(!is_at_substring(p, "DECLASS_H_") && !is_at_substring(p, "declass_h_")) continue;
-      scout = p; // check for ".h" extension
-      while(VARCHAR(*scout)) ++scout;
-      // if at a valid declass header file!
-      if(is_at_substring(scout, ".h")) { 
-        FLOOD_ZEROS(scraped_declass_header_name, MAX_TOKEN_NAME_LENGTH + 8);
-        q = scraped_declass_header_name;
-        // copy declass header file name
-        while(*p != '\0' && no_overlap(*p, "\">")) *q++ = *p++; 
-        *q = '\0', ++p;
-        // white-out "DECLASS_H_" header's inclusion
-        while(*include_start != '\0' && include_start != p)
-          *include_start++ = ' '; 
-        // add "DECLASS_H_" header filename if not already found earlier (prevents double inclusion)
-        if(is_unique_DECLASS_H_header(scraped_declass_header_name)) {
-          strcpy(DECLASS_HEADER_FILE_NAMES[TOTAL_DECLASS_HEADER_FILES], scraped_declass_header_name);
-          ++TOTAL_DECLASS_HEADER_FILES;
-        }
+// if 'p' is at the "#include" of a "DECLASS_H_" header file, registers the header (unless already found,
+// preventing double inclusion), copies its name to "scraped_declass_header_name", & returns a ptr past
+// its inclusion, else returns NULL
+static char *register_DECLASS_H_header_inclusion(char *p, char *scraped_declass_header_name) {
+  char *q, *scout;
+  if(!is_at_substring(p, "#include") || VARCHAR(*(p + 8))) return NULL;
+  p += 8;
+  // skip optional whitespace after "#include"
+  while(*p != '\0' && IS_WHITESPACE(*p)) ++p;
+  if(*p == '\0') return NULL;
+  ++p; // skip '"' or '<' (a bit presumptuous someone might have a "DECLASS_H_" header in their sys files but hey its called future proofing)
+  // if not a declass header
+  if(!is_at_substring(p, "DECLASS_H_") && !is_at_substring(p, "declass_h_")) return NULL;
+  scout = p; // check for ".h" extension
+  while(VARCHAR(*scout)) ++scout;
+  if(!is_at_substring(scout, ".h")) return NULL;
+  // at a valid declass header file! copy its name
+  FLOOD_ZEROS(scraped_declass_header_name, MAX_TOKEN_NAME_LENGTH + 8);
+  q = scraped_declass_header_name;
+  while(*p != '\0' && no_overlap(*p, "\">")) *q++ = *p++;
+  *q = '\0';
+  if(*p != '\0') ++p;
+  register_DECLASS_H_header(scraped_declass_header_name);
+  return p;
+}
+
+// adds "DECLASS_H_" header filename if not already found earlier (prevents double inclusion)
+static void register_DECLASS_H_header(char *declass_header_name) {
+  if(DC->header_inclusions != NULL) {
+    sb_append(DC->header_inclusions, declass_header_name);
+    sb_putc(DC->header_inclusions, '\n');
+  }
+  if(is_unique_DECLASS_H_header(declass_header_name)) {
+    strcpy(DC->DECLASS_HEADER_FILE_NAMES[DC->TOTAL_DECLASS_HEADER_FILES], declass_header_name);
+    ++DC->TOTAL_DECLASS_HEADER_FILES;
+  }
+}
+
+/******************************************************************************
+* "--split-headers" SHARED HEADER SPLITTING FUNCTIONS
+******************************************************************************/
+
+// copies "header_name" into "split_name" w/ its ".h" extension swapped for "suffix"
+// (IE "DECLASS_H_stack.h" => "DECLASS_H_stack_DECLASS.h", never clashing w/ a main "stack_DECLASS.c")
+static void split_DECLASS_H_filename(char *header_name, char *suffix, char *split_name) {
+  strcpy(split_name, header_name);
+  NEW_EXTENSION(split_name, suffix);
+}
+
+#ifndef DECLASS_LIBRARY
+// moves each "DECLASS_H_" header's declassified text out of "declass_filename" (which, like any header
+// including it, keeps an "#include" of its split-out ".h") into "<header>_DECLASS.h" (declarations) &
+// "<header>_DECLASS.c" (fcn definitions), appending each ".c" to "split_sources" to compile w/ the file
+static void split_out_DECLASS_H_headers(char *declass_filename, struct string_builder *split_sources) {
+  struct string_builder file = {NULL, 0, 0}, main_file = {NULL, 0, 0}, split_file = {NULL, 0, 0};
+  struct string_builder decls = {NULL, 0, 0}, defns = {NULL, 0, 0};
+  char header_name[MAX_TOKEN_NAME_LENGTH + 8], split_h[MAX_TOKEN_NAME_LENGTH + 24];
+  char split_c[MAX_TOKEN_NAME_LENGTH + 24], guard[MAX_TOKEN_NAME_LENGTH + 24];
+  char resolved[PATH_MAX], *p, *q, *r, *segment, *segment_end;
+  if(access(resolve_path(declass_filename, resolved), R_OK) != 0) return; // nothing declassified to split
+  scrape_file(declass_filename, &file);
+  p = file.str;
+  while((segment = strstr(p, DECLASS_H_SEGMENT_START)) != NULL) {
+    sb_appendn(&main_file, p, segment - p);
+    segment += strlen(DECLASS_H_SEGMENT_START);
+    for(q = header_name; *segment != '\0' && *segment != '"'; ++segment) *q++ = *segment;
+    *q = '\0';
+    while(*segment != '\0' && *segment++ != '\n'); // skip to the header's text
+    if((segment_end = strstr(segment, DECLASS_H_SEGMENT_END)) == NULL) segment_end = &file.str[file.len];
+    split_DECLASS_H_filename(header_name, "_DECLASS.h", split_h);
+    split_DECLASS_H_filename(header_name, "_DECLASS.c", split_c);
+    for(q = guard, r = split_h; *r != '\0'; ++q, ++r) // "DECLASS_H_stack_DECLASS.h" => "DECLASS_H_STACK_DECLASS_H_"
+      *q = !VARCHAR(*r) ? '_' : (*r >= 'a' && *r <= 'z') ? *r - 'a' + 'A' : *r;
+    strcpy(q, "_");
+    sb_truncate(&decls, 0), sb_truncate(&defns, 0);
+    split_DECLASS_H_segment(segment, segment_end - segment, &decls, &defns);
+
+    // header declarations: guarded, w/ the runtime the main file defines declared
+    sb_truncate(&split_file, 0);
+    sb_printf(&split_file, "/* DECLASSIFIED: %s\n * %s\n#ifndef %s\n#define %s\n", header_name, DC_SUPPORT_EMAIL, guard, guard);
+    if(*DC->IMMORTALITY)  sb_append(&split_file, IMMORTAL_KEYWORD_DEF);
+    if(DC->NO_SMRTASSERT) sb_append(&split_file, NDEBUG_SMRTPTR_DEF);
+    if(DC->EXTERNAL_RUNTIME) {
+      sb_append(&split_file, "#include \"" DECLASS_RT_H "\"\n");
+    } else {
+      sb_append(&split_file, "extern int DC__NDTR;\n");
+      if(*DC->SMRT_PTRS) sb_append(&split_file, (char *)DC_SMART_POINTER_DECLS_);
+    }
+    if(decls.len > 0) sb_appendn(&split_file, decls.str, decls.len);
+    sb_append(&split_file, "\n#endif\n");
+    write_if_changed(split_h, &split_file);
+
+    // header fcn definitions
+    sb_truncate(&split_file, 0);
+    sb_printf(&split_file, "/* DECLASSIFIED: %s\n * %s\n#include \"%s\"\n", header_name, DC_SUPPORT_EMAIL, split_h);
+    if(defns.len > 0) sb_appendn(&split_file, defns.str, defns.len);
+    write_if_changed(split_c, &split_file);
+    sb_printf(split_sources, " %s", split_c);
+    p = (*segment_end != '\0') ? segment_end + strlen(DECLASS_H_SEGMENT_END) : segment_end;
+  }
+  sb_append(&main_file, p);
+  FPUT(main_file.str, main_file.len, declass_filename);
+  sb_free(&file);
+  sb_free(&main_file);
+  sb_free(&split_file);
+  sb_free(&decls);
+  sb_free(&defns);
+}
+
+// splits the declassified header text "segment" ("len" chars) into "decls" (all but its global fcn bodies,
+// each non-static/inline fcn definition cut to its prototype) & "defns" (those fcn definitions)
+static void split_DECLASS_H_segment(char *segment, long len, struct string_builder *decls, struct string_builder *defns) {
+  long i = 0, j, decl_start = 0, last_token = -1; // "last_token": idx of the last global non-whitespace char
+  int depth = 0;
+  bool at_line_start = true;
+  while(i < len) {
+    if((j = skip_literal_or_comment(segment, i, len)) > i) { // strings & chars are tokens, comments aren't
+      if(segment[i] == '"' || segment[i] == '\'') last_token = j - 1, at_line_start = false;
+      i = j;
+      continue;
+    }
+    if(segment[i] == '#' && depth == 0 && at_line_start) { // directives are declarations
+      while(i < len && (segment[i] != '\n' || segment[i-1] == '\\')) ++i;
+      sb_appendn(decls, &segment[decl_start], i - decl_start);
+      decl_start = i;
+      continue;
+    }
+    if(segment[i] == '{' && depth == 0 && last_token >= decl_start && segment[last_token] == ')'
+      && is_extern_fcn_definition(&segment[decl_start], last_token - decl_start)) {
+      for(j = i, depth = 0; j < len;) { // find the end of the fcn's body
+        long past_literal = skip_literal_or_comment(segment, j, len);
+        if(past_literal > j) { j = past_literal; continue; }
+        if(segment[j] == '{') ++depth;
+        else if(segment[j] == '}' && --depth == 0) { ++j; break; }
+        ++j;
       }
+      sb_appendn(decls, &segment[decl_start], last_token + 1 - decl_start);
+      sb_putc(decls, ';');
+      sb_appendn(defns, &segment[decl_start], j - decl_start);
+      sb_putc(defns, '\n');
+      decl_start = i = j, depth = 0;
+      continue;
     }
-    ++p;
+    if(segment[i] == '{') ++depth;
+    else if(segment[i] == '}') --depth;
+    if((segment[i] == ';' || segment[i] == '}') && depth == 0) { // end of a global declaration (or static fcn)
+      sb_appendn(decls, &segment[decl_start], i + 1 - decl_start);
+      decl_start = i + 1;
+    }
+    if(segment[i] == '\n')            at_line_start = true;
+    else if(!IS_WHITESPACE(segment[i])) at_line_start = false, last_token = i;
+    ++i;
+  }
+  if(len > decl_start) sb_appendn(decls, &segment[decl_start], len - decl_start);
+}
+
+// returns the idx past the string/char literal or comment at "segment[i]" (or 'i' if not at one)
+static long skip_literal_or_comment(char *segment, long i, long len) {
+  char quote = segment[i];
+  if(quote == '"' || quote == '\'') {
+    for(++i; i < len && segment[i] != quote; ++i) if(segment[i] == '\\') ++i;
+    return (i < len) ? i + 1 : len;
+  }
+  if(quote == '/' && i + 1 < len && segment[i+1] == '*') {
+    for(i += 2; i + 1 < len && (segment[i] != '*' || segment[i+1] != '/'); ++i);
+    return (i + 1 < len) ? i + 2 : len;
+  }
+  if(quote == '/' && i + 1 < len && segment[i+1] == '/')
+    while(i < len && segment[i] != '\n') ++i;
+  return i;
+}
+
+// whether the "len"-char global declaration at "decl" (ending in ')' before a '{') is a fcn definition
+// w/ external linkage (static/inline fcns stay in the header, & '=' means a compound literal initializer)
+static bool is_extern_fcn_definition(char *decl, long len) {
+  for(long i = 0; i < len; ++i) {
+    if(decl[i] == '=') return false;
+    if((i == 0 || !VARCHAR(decl[i-1])) && ((is_at_substring(&decl[i], "static") && !VARCHAR(decl[i+6]))
+      || (is_at_substring(&decl[i], "inline") && !VARCHAR(decl[i+6])) || is_at_substring(&decl[i], "__inline")))
+      return false;
   }
+  return true;
+}
+
+// writes "contents" to "filename" unless it already holds them (keeping its timestamp for make), via a
+// temp file renamed into place so concurrent declassifications sharing the header never see a partial file
+static void write_if_changed(char *filename, struct string_builder *contents) {
+  struct string_builder existing = {NULL, 0, 0}, temp = {NULL, 0, 0};
+  struct stat buf;
+  char resolved[PATH_MAX];
+  FILE *fptr = NULL;
+  int fd;
+  char *path = resolve_path(filename, resolved);
+  if(stat(path, &buf) == 0 && buf.st_size == contents->len) {
+    scrape_file(filename, &existing);
+    bool unchanged = (memcmp(existing.str, contents->str, contents->len) == 0);
+    sb_free(&existing);
+    if(unchanged) return;
+  }
+  sb_printf(&temp, "%s.XXXXXX", path);
+  if((fd = mkstemp(temp.str)) < 0 || (fptr = fdopen(fd, "w")) == NULL) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T WRITE FILE \"%s\"!\033[0m\n\n", __LINE__, filename);
+    declass_exit(EXIT_FAILURE);
+  }
+  fchmod(fd, 0644);
+  fwrite(contents->str, 1, contents->len, fptr);
+  if(fclose(fptr) != 0 || rename(temp.str, path) != 0) remove(temp.str);
+  sb_free(&temp);
+}
+#endif
+
+/******************************************************************************
+* "--runtime=external" SHARED RUNTIME FUNCTIONS
+******************************************************************************/
+
+#ifndef DECLASS_LIBRARY
+// writes smrtptr.h's declarations to "declass_rt.h" & its definitions (w/ "DC__NDTR") to "declass_rt.c",
+// generated from the same text inlined by "--runtime=inline" so the two never drift apart
+static void emit_declass_runtime() {
+  struct string_builder rt_file = {NULL, 0, 0};
+  sb_printf(&rt_file, "/* DECLASS RUNTIME %s: %s\n * %s\n", DECLASS_VERSION, DECLASS_RT_H, DC_SUPPORT_EMAIL);
+  sb_append(&rt_file, "// build once: $ gcc -std=c11 -c " DECLASS_RT_C " && ar rcs " DECLASS_RT_LIB " declass_rt.o\n");
+  sb_append(&rt_file, "// (for threads, also w/ \"-DDECLASS_THREADSAFE -pthread\")\n");
+  sb_append(&rt_file, "#ifndef DECLASS_RT_H_\n#define DECLASS_RT_H_\nextern int DC__NDTR;\n");
+  sb_append(&rt_file, (char *)DC_SMART_POINTER_DECLS_);
+  sb_append(&rt_file, "#endif\n");
+  write_if_changed(DECLASS_RT_H, &rt_file);
+  sb_truncate(&rt_file, 0);
+  sb_printf(&rt_file, "/* DECLASS RUNTIME %s: %s\n * %s\n", DECLASS_VERSION, DECLASS_RT_C, DC_SUPPORT_EMAIL);
+  sb_append(&rt_file, (char *)DC_SMART_POINTER_H_);
+  sb_append(&rt_file, "\nint DC__NDTR = 1;\n");
+  write_if_changed(DECLASS_RT_C, &rt_file);
+  sb_free(&rt_file);
+}
+
+// appends the runtime to "extra_sources" for compiling: "libdeclass_rt.a" if prebuilt, else "declass_rt.c"
+// (emitting the runtime first if it's missing from the working directory)
+static void link_declass_runtime(struct string_builder *extra_sources) {
+  char resolved[PATH_MAX];
+  if(access(resolve_path(DECLASS_RT_H, resolved), F_OK) != 0 || access(resolve_path(DECLASS_RT_C, resolved), F_OK) != 0) emit_declass_runtime();
+  sb_append(extra_sources, access(resolve_path(DECLASS_RT_LIB, resolved), F_OK) == 0 ? " " DECLASS_RT_LIB : " " DECLASS_RT_C);
 }
+#endif
 
 /******************************************************************************
 * MESSAGE FUNCTIONS
 ******************************************************************************/
 
-// confirm (& adjust the appropriate flags) for possible "-l", "-no-compile",
-// "-mortal-errors", &/or "-save-temps" cmd-line flags
+#ifndef DECLASS_LIBRARY
+// confirm (& adjust the appropriate flags) for possible "-l", "-no-compile", "-mortal-errors",
+// "-MD", "--split-headers", "--runtime=", "--emit-runtime", &/or "-save-temps" cmd-line flags ("-j N", "-MF FILE", & "--cache-dir DIR" handled by "main()")
 // (throws error if any other invalid flag found)
-void process_cmd_flag(char *flag, bool *show_class_info, bool *save_temp_files) {
+static bool process_cmd_flag(char *flag, struct cmd_flags *flags) {
+  int i;
   if(strcmp(flag, "-l") == 0)
-    *show_class_info = true;
+    flags->show_class_info = true;
   else if(strcmp(flag, "-no-compile") == 0)
-    NO_COMPILE = true;
+    flags->no_compile = true;
   else if(strcmp(flag, "-save-temps") == 0)
-    *save_temp_files = true;
+    flags->save_temp_files = true;
   else if(strcmp(flag, "-mortal-errors") == 0)
-    MORTAL_ERRORS = true;
-  else 
-    declass_missing_Cfile_alert(); // Invalid cmd-line flag: != "-l" nor "-no-compile" nor "-save-temps"
+    flags->mortal_errors = true;
+  else if(strcmp(flag, "-MD") == 0)
+    flags->make_deps = true;
+  else if(strcmp(flag, "--split-headers") == 0)
+    flags->split_headers = true;
+  else if(strcmp(flag, "--runtime=external") == 0 || strcmp(flag, "--runtime=inline") == 0)
+    flags->external_runtime = (strcmp(flag, "--runtime=external") == 0);
+  else if(strcmp(flag, "--emit-runtime") == 0)
+    flags->emit_runtime = true;
+  else if(strncmp(flag, "--profile=", 10) == 0) {
+    for(flags->profile = NULL, i = 0; i < TOTAL_BUILD_PROFILES && flags->profile == NULL; ++i)
+      if(strcmp(&flag[10], BUILD_PROFILES[i].name) == 0) flags->profile = &BUILD_PROFILES[i];
+    return flags->profile != NULL;
+  } else 
+    return false; // Invalid cmd-line flag: != "-l" nor "-no-compile" nor "-save-temps"
+  return true;
 }
+#endif
 
-// uncomments smrtptr.h's alerts, invoked if detected "#define DECLASS_NOISYSMRTPTR"
-void enable_smrtptr_alerts() {
-  char *p = DC_SMART_POINTER_H_;
-  while(*p != '\0' && !is_at_substring(p, 
-    "// if(SMRTPTR_GC.len > 0) printf(\"FREED %ld SMART POINTERS!\\n\"")) ++p;
+// uncomments the alerts of the smrtptr.h copy at 'p', invoked if detected "#define DECLASS_NOISYSMRTPTR"
+static void enable_smrtptr_alerts(char *p) {
+  while(*p != '\0' && !is_at_substring(p, "// if(len > 0) printf(\"FREED %ld SMART POINTERS!\\n\"")) ++p;
   *p++ = ' '; *p++ = ' '; // uncomment smrtptr.h's garbage-collector alert
   while(*p != '\0' && !is_at_substring(p, "// printf(\"SMART POINTER #%ld STORED!\\n\"")) ++p;
   *p++ = ' '; *p++ = ' '; // uncomment smrt-m/calloc alert
@@ -1045,205 +3486,206 @@ void enable_smrtptr_alerts() {
   *p++ = ' '; *p++ = ' '; // uncomment smrtfree alert
 }
 
-// parses file to confirm reserved "DC_" prefix was not used to name any token
-void confirm_no_reserved_DC_prefix(char *file_buffer) {
-  bool in_a_string = false, in_a_char = false, in_token_scope = true, found_reserved_prefix = false;
-  char *p = file_buffer, bad_code_buffer[BAD_CODE_BUFFER_LENGTH];
-  if(is_at_substring(p, "DC_")) found_reserved_prefix = true;
+// alerts user that the reserved "DC_" prefix was used to name a token at 'p' in "file_buffer"
+static void reserved_DC_prefix_alert(char *file_buffer, char *p) {
+  char bad_code_buffer[BAD_CODE_BUFFER_LENGTH];
+  fprintf(DC_STDERR, "\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m DETECTED RESERVED \"DC_\" PREFIX IN FILE!\033[0m\n >> FOUND HERE:", __LINE__);
+  FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
+  get_invalid_code_snippet(file_buffer, p, bad_code_buffer);
+  fprintf(DC_STDERR, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
+  fprintf(DC_STDERR, " >> REMOVE THE RESERVED PREFIX FROM FILE (AS PER CAVEAT #0 SO WAY TO GO READING THE DOCUMENTATION) TO DECLASSIFY FILE!\n");
+  if(DC->MORTAL_ERRORS) ask_user_whether_to_quit_or_continue_declassification();
   else {
-    ++p;
-    while(*p != '\0') {
-      account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, p);
-      if(in_token_scope && !VARCHAR(*(p - 1)) && is_at_substring(p, "DC_")) {
-        found_reserved_prefix = true;
-        break;
-      }
-      ++p;
-    }
-  }
-  if(found_reserved_prefix) {
-    fprintf(stderr, "\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m DETECTED RESERVED \"DC_\" PREFIX IN FILE!\033[0m\n >> FOUND HERE:", __LINE__);
-    FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
-    get_invalid_code_snippet(file_buffer, p, bad_code_buffer);
-    fprintf(stderr, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
-    fprintf(stderr, " >> REMOVE THE RESERVED PREFIX FROM FILE (AS PER CAVEAT #0 SO WAY TO GO READING THE DOCUMENTATION) TO DECLASSIFY FILE!\n");
-    if(MORTAL_ERRORS) ask_user_whether_to_quit_or_continue_declassification();
-    else {
-      fprintf(stderr, " >> Terminating Declassifier.\n");
-      exit(EXIT_FAILURE);
-    }
+    fprintf(DC_STDERR, " >> Terminating Declassifier.\n");
+    declass_exit(EXIT_FAILURE);
   }
 }
 
-// confirms file exists, non-empty, & takes less memory than MAX_FILESIZE
-void confirm_valid_file(char *filename) {
+#ifndef DECLASS_LIBRARY
+// confirms file exists & is non-empty
+static void confirm_valid_file(char *filename) {
   struct stat buf;
-  if(stat(filename, &buf)) {
+  char resolved[PATH_MAX];
+  if(stat(resolve_path(filename, resolved), &buf)) {
     declass_ERROR_ascii_art();
-    fprintf(stderr, "\033[1m >> FILE \"%s\" DOES NOT EXIST!\033[0m\n", filename);
-    fprintf(stderr, ">> Terminating Declassifier.\n\n");
-    exit(EXIT_FAILURE);
+    fprintf(DC_STDERR, "\033[1m >> FILE \"%s\" DOES NOT EXIST!\033[0m\n", filename);
+    fprintf(DC_STDERR, ">> Terminating Declassifier.\n\n");
+    declass_exit(EXIT_FAILURE);
   }
-  CUMULATIVE_FILESIZE += buf.st_size;
-  if(buf.st_size > MAX_FILESIZE || buf.st_size == 0) {
+  if(buf.st_size == 0) {
     declass_ERROR_ascii_art();
-    if(buf.st_size > MAX_FILESIZE) {
-      fprintf(stderr, "\033[1m >> FILE \"%s\" SIZE %lld BYTES EXCEEDS %d BYTE CAP!\033[0m\n", filename, buf.st_size, MAX_FILESIZE); 
-      fprintf(stderr, " >> RAISE 'MAX_FILESIZE' MACRO LIMIT!\n");
-    } else fprintf(stderr, "\033[1m >> CAN'T DECLASSIFY AN EMPTY FILE!\033[0m\n"); 
-    fprintf(stderr, " >> Terminating Declassifier.\n\n");
-    exit(EXIT_FAILURE);
+    fprintf(DC_STDERR, "\033[1m >> CAN'T DECLASSIFY AN EMPTY FILE!\033[0m\n"); 
+    fprintf(DC_STDERR, " >> Terminating Declassifier.\n\n");
+    declass_exit(EXIT_FAILURE);
   }
 }
 
 // confirms command processor exists to compile declassified code autonomously via "system()":
 // if DNE declass.c only converts the file w/o compiling, as if "#define DECLASS_NCOMPILE" were found
-void confirm_command_processor_exists_for_autonomous_compilation(int line_No) {
-  if(!NO_COMPILE && !system(NULL)) { // no need to show if client already disabled auto-compilation
-    fprintf(stderr, "\033[1mdeclass.c:%03d: \033[33mWARNING\033[0m\033[1m, Command Processor Does Not Exist!\033[0m\n", line_No);
-    fprintf(stderr, " >> Declassifying File Without Compiling.\n >> Client Must Manually Compile Converted Code.\n");
-    NO_COMPILE = true;
+static void confirm_command_processor_exists_for_autonomous_compilation(int line_No) {
+  if(!DC->NO_COMPILE && !system(NULL)) { // no need to show if client already disabled auto-compilation
+    fprintf(DC_STDERR, "\033[1mdeclass.c:%03d: \033[33mWARNING\033[0m\033[1m, Command Processor Does Not Exist!\033[0m\n", line_No);
+    fprintf(DC_STDERR, " >> Declassifying File Without Compiling.\n >> Client Must Manually Compile Converted Code.\n");
+    DC->NO_COMPILE = true;
   }
 }
 
 // 'declassified' in spaces with the background & "text" colors reversed
-void declass_DECLASSIFIED_ascii_art() {
+static void declass_DECLASSIFIED_ascii_art() {
   const char *rev  = "\033[7m", *not  = "\033[0m";
-  printf("\n=================================================================================\n");
-  printf("%s   %s    %s    %s   %s    %s  %s  %s     %s   %s     %s    %s   %s    %s  %s   %s  %s     %s %s   %s  %s    %s  %s   %s   %s     %s\n", 
+  fprintf(DC_STDOUT, "\n=================================================================================\n");
+  fprintf(DC_STDOUT, "%s   %s    %s    %s   %s    %s  %s  %s     %s   %s     %s    %s   %s    %s  %s   %s  %s     %s %s   %s  %s    %s  %s   %s   %s     %s\n", 
     rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not);
-  printf("%s %s %s  %s  %s  %s  %s  %s %s  %s  %s  %s  %s %s     %s %s %s %s    %s  %s  %s",
+  fprintf(DC_STDOUT, "%s %s %s  %s  %s  %s  %s  %s %s  %s  %s  %s  %s %s     %s %s %s %s    %s  %s  %s",
     rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev);
-  printf("  %s %s  %s  %s  %s  %s %s   %s %s   %s %s  %s %s  %s  %s  %s  %s %s %s %s  %s   %s   %s \n", 
+  fprintf(DC_STDOUT, "  %s %s  %s  %s  %s  %s %s   %s %s   %s %s  %s %s  %s  %s  %s  %s %s %s %s  %s   %s   %s \n", 
     not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not);
-  printf("%s %s  %s  %s %s   %s    %s  %s      %s %s     %s   %s     %s  %s     %s  %s    ",
+  fprintf(DC_STDOUT, "%s %s  %s  %s %s   %s    %s  %s      %s %s     %s   %s     %s  %s     %s  %s    ",
     rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not);
-  printf(" %s %s   %s   %s    %s %s  %s   %s    %s %s  %s  %s   %s %s  \n", 
+  fprintf(DC_STDOUT, " %s %s   %s   %s    %s %s  %s   %s    %s %s  %s  %s   %s %s  \n", 
     rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not);
-  printf("%s %s %s  %s  %s  %s  %s  %s %s  %s  %s  %s  %s %s %s  %s  %s %s %s %s  %s  %s  %s  %s %s  ",
+  fprintf(DC_STDOUT, "%s %s %s  %s  %s  %s  %s  %s %s  %s  %s  %s  %s %s %s  %s  %s %s %s %s  %s  %s  %s  %s %s  ",
     rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev);
-  printf("%s  %s  %s    %s %s   %s %s      %s %s  %s  %s  %s  %s %s %s %s  %s       \n", 
+  fprintf(DC_STDOUT, "%s  %s  %s    %s %s   %s %s      %s %s  %s  %s  %s  %s %s %s %s  %s       \n", 
     not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not);
-  printf("%s   %s    %s    %s   %s    %s   %s   %s  %s  %s %s  %s  %s    %s   %s    %s    %s   %s %s  %s     %s   %s  %s    %s  %s   %s    %s   %s ", 
+  fprintf(DC_STDOUT, "%s   %s    %s    %s   %s    %s   %s   %s  %s  %s %s  %s  %s    %s   %s    %s    %s   %s %s  %s     %s   %s  %s    %s  %s   %s    %s   %s ", 
     rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not, rev, not);
-  printf("\n=================================================================================\n");
+  fprintf(DC_STDOUT, "\n=================================================================================\n");
 }
 
 // 'error' in ascii
-void declass_ERROR_ascii_art() {
-  printf("\n========================================\n\033[1m\033[31m");
-  printf("  /|===\\ ||^\\\\ ||^\\\\ //==\\\\ ||^\\\\   //\n");
-  printf("  ||==   ||_// ||_// ||  || ||_//  //\n");
-  printf("  \\|===/ || \\\\ || \\\\ \\\\==// || \\\\ <*>");
-  printf("\033[0m\n========================================\n");
+static void declass_ERROR_ascii_art() {
+  fprintf(DC_STDOUT, "\n========================================\n\033[1m\033[31m");
+  fprintf(DC_STDOUT, "  /|===\\ ||^\\\\ ||^\\\\ //==\\\\ ||^\\\\   //\n");
+  fprintf(DC_STDOUT, "  ||==   ||_// ||_// ||  || ||_//  //\n");
+  fprintf(DC_STDOUT, "  \\|===/ || \\\\ || \\\\ \\\\==// || \\\\ <*>");
+  fprintf(DC_STDOUT, "\033[0m\n========================================\n");
 }
 
 // error & how-to-execute message
-void declass_missing_Cfile_alert() {
+static void declass_missing_Cfile_alert() {
   declass_ERROR_ascii_art();
-  printf("** Missing .c File Cmd Line Argument! **\n");
-  printf("Exe: $ gcc -std=c99 -o declass declass.c\n     $ ./declass yourFile.c");
-  printf("\n========================================");
-  printf("\n*** Or Else Misused A Cmd Line Flag! ***\n");
-  printf("* Can Be Combined! (end w/ \"yourFile.c\")\n");
-  printf("Info: $ ./declass -l yourFile.c\n");
-  printf("File: $ ./declass -save-temps yourFile.c\n");
-  printf("!GCC: $ ./declass -no-compile yourFile.c");
-  printf("\n========================================");
-  printf("\n********* Filename Conversion: *********\n"); 
-  printf("    yourFile.c => yourFile_DECLASS.c    ");
-  printf("\n========================================\n");
-  printf(" >> Terminating Declassifier.");
-  printf("\n=============================\n\n");
-  exit(EXIT_FAILURE);
+  fprintf(DC_STDOUT, "** Missing .c File Cmd Line Argument! **\n");
+  fprintf(DC_STDOUT, "Exe: $ gcc -std=c99 -o declass declass.c\n     $ ./declass yourFile.c");
+  fprintf(DC_STDOUT, "\n========================================");
+  fprintf(DC_STDOUT, "\n*** Or Else Misused A Cmd Line Flag! ***\n");
+  fprintf(DC_STDOUT, "* Can Be Combined! (w/ 1+ \".c\" files) *\n");
+  fprintf(DC_STDOUT, "Info: $ ./declass -l yourFile.c\n");
+  fprintf(DC_STDOUT, "File: $ ./declass -save-temps yourFile.c\n");
+  fprintf(DC_STDOUT, "!GCC: $ ./declass -no-compile yourFile.c\n");
+  fprintf(DC_STDOUT, "Jobs: $ ./declass -j 8 a.c b.c dir/*.c\n");
+  fprintf(DC_STDOUT, "Keep: $ ./declass --cache-dir DIR a.c\n");
+  fprintf(DC_STDOUT, "Deps: $ ./declass -MD yourFile.c\n");
+  fprintf(DC_STDOUT, "Hdrs: $ ./declass --split-headers a.c\n");
+  fprintf(DC_STDOUT, "Rtlb: $ ./declass --runtime=external a.c\n");
+  fprintf(DC_STDOUT, "Serv: $ ./declass --serve SOCK &\n");
+  fprintf(DC_STDOUT, "      $ ./declass --connect SOCK a.c\n");
+  fprintf(DC_STDOUT, "Pchd: $ ./declass --precompile DECLASS_H_x.h\n");
+  fprintf(DC_STDOUT, "Pipe: $ ./declass - < a.c | gcc -x c - -o a\n");
+  fprintf(DC_STDOUT, "Opts: $ ./declass --profile=release a.c\n");
+  fprintf(DC_STDOUT, "      $ ./declass --pgo \"./a < in.txt\" a.c");
+  fprintf(DC_STDOUT, "\n========================================");
+  fprintf(DC_STDOUT, "\n********* Filename Conversion: *********\n"); 
+  fprintf(DC_STDOUT, "    yourFile.c => yourFile_DECLASS.c    ");
+  fprintf(DC_STDOUT, "\n========================================\n");
+  fprintf(DC_STDOUT, " >> Terminating Declassifier.");
+  fprintf(DC_STDOUT, "\n=============================\n\n");
+  declass_exit(EXIT_FAILURE);
 }
+#endif
 
 // thrown if "#define DECLASS_IGNORE" was detected, terminates program
-void throw_DECLASS_IGNORE_message_and_terminate() {
-  fprintf(stderr, "\n >> \033[1mdeclass.c: \033[33mWARNING\033[0m\033[1m \"#define DECLASS_IGNORE\" Was Detected!\033[0m");
-  fprintf(stderr, "\n\033[1m >> Terminating Declassifier.\033[0m\n\n");
-  exit(EXIT_FAILURE);
+static void throw_DECLASS_IGNORE_message_and_terminate() {
+  fprintf(DC_STDERR, "\n >> \033[1mdeclass.c: \033[33mWARNING\033[0m\033[1m \"#define DECLASS_IGNORE\" Was Detected!\033[0m");
+  fprintf(DC_STDERR, "\n\033[1m >> Terminating Declassifier.\033[0m\n\n");
+  declass_exit(EXIT_FAILURE);
 }
 
+#ifndef DECLASS_LIBRARY
 // output class data if argv[1] == '-l' flag
-void show_l_flag_data() {
-  if(total_classes > 0) printf("\n\033[1m--=[ TOTAL CLASSES: %d ]=--", total_classes);
-  (total_objects > 0) ? printf("=[ TOTAL OBJECTS: %d ]=--\033[0m\n", total_objects) : printf("\033[0m\n");
-  for(int i = 0; i < total_classes; ++i) {
+static void show_l_flag_data() {
+  if(DC->total_classes > 0) fprintf(DC_STDOUT, "\n\033[1m--=[ TOTAL CLASSES: %d ]=--", DC->total_classes);
+  (DC->total_objects > 0) ? fprintf(DC_STDOUT, "=[ TOTAL OBJECTS: %d ]=--\033[0m\n", DC->total_objects) : fprintf(DC_STDOUT, "\033[0m\n");
+  for(int i = 0; i < DC->total_classes; ++i) {
     int class_objects_sum = 0;
-    for(int j = 0; j < total_objects; ++j) 
-      if(strcmp(classes[i].class_name, objects[j].class_name) == 0) class_objects_sum++;
-    printf("\n\033[1mCLASS No%d, %s:\033[0m\n", i + 1, classes[i].class_name);
+    for(int j = 0; j < DC->total_objects; ++j) 
+      if(strcmp(DC->classes[i].class_name, DC->objects[j].class_name) == 0) class_objects_sum++;
+    fprintf(DC_STDOUT, "\n\033[1mCLASS No%d, %s:\033[0m%s\n", i + 1, DC->classes[i].class_name, DC->classes[i].class_is_pooled ? " (( POOLED ))" : "");
 
-    int total_members = classes[i].total_members; // differentiate between class struct member members & class members
-    for(int j = 0; j < classes[i].total_members; ++j) if(classes[i].member_names[j][0] == 0) --total_members;
+    int total_members = DC->classes[i].total_members; // differentiate between class struct member members & class members
+    for(int j = 0; j < DC->classes[i].total_members; ++j) if(DC->classes[i].member_names[j][0] == 0) --total_members;
     if(total_members > 0) {
-      printf(" L_ \033[1mMEMBERS: %d\033[0m\n", total_members);
-      for(int j = 0; j < classes[i].total_members; ++j) {
-        if(classes[i].member_names[j][0] == 0) continue;
-        char bar = (classes[i].total_methods > 0) ? '|' : ' ';
-        if(classes[i].member_is_pointer[j])    printf(" %c  L_ *%s", bar, classes[i].member_names[j]);
-        else if(classes[i].member_is_array[j]) printf(" %c  L_ %s[]", bar, classes[i].member_names[j]);
-        else printf(" %c  L_ %s", bar, classes[i].member_names[j]);
-        if(classes[i].member_value_is_alloc[j]) printf(" (( ALLOCATED MEMORY ))");
-        if(classes[i].member_is_immortal[j]) printf(" (( IMMORTAL ))");
-        printf("\n");
+      fprintf(DC_STDOUT, " L_ \033[1mMEMBERS: %d\033[0m\n", total_members);
+      for(int j = 0; j < DC->classes[i].total_members; ++j) {
+        if(DC->classes[i].member_names[j][0] == 0) continue;
+        char bar = (DC->classes[i].total_methods > 0) ? '|' : ' ';
+        if(DC->classes[i].member_is_pointer[j])    fprintf(DC_STDOUT, " %c  L_ *%s", bar, DC->classes[i].member_names[j]);
+        else if(DC->classes[i].member_is_array[j]) fprintf(DC_STDOUT, " %c  L_ %s[]", bar, DC->classes[i].member_names[j]);
+        else fprintf(DC_STDOUT, " %c  L_ %s", bar, DC->classes[i].member_names[j]);
+        if(DC->classes[i].member_value_is_alloc[j]) fprintf(DC_STDOUT, " (( ALLOCATED MEMORY ))");
+        if(DC->classes[i].member_is_immortal[j]) fprintf(DC_STDOUT, " (( IMMORTAL ))");
+        fprintf(DC_STDOUT, "\n");
       }
     }
 
     char method_name[MAX_TOKEN_NAME_LENGTH];
-    if(classes[i].total_methods > 0) {
-        printf(" L_ \033[1mMETHODS: %d\033[0m\n", classes[i].total_methods);
-      for(int j = 0; j < classes[i].total_methods; ++j) {
+    if(DC->classes[i].total_methods > 0) {
+        fprintf(DC_STDOUT, " L_ \033[1mMETHODS: %d\033[0m\n", DC->classes[i].total_methods);
+      for(int j = 0; j < DC->classes[i].total_methods; ++j) {
         FLOOD_ZEROS(method_name, MAX_TOKEN_NAME_LENGTH);
-        if(strcmp(classes[i].method_names[j], "DC__constructor") == 0)
-          sprintf(method_name, "%s() (( CONSTRUCTOR ))", classes[i].class_name);
-        else if(strcmp(classes[i].method_names[j], "DC__destructor") == 0)
-          sprintf(method_name, "~%s() (( DESTRUCTOR ))", classes[i].class_name);
-        else sprintf(method_name, "%s()", classes[i].method_names[j]);
-        (class_objects_sum > 0) ? printf(" | L_ %s\n", method_name) : printf("   L_ %s\n", method_name);
+        if(strcmp(DC->classes[i].method_names[j], "DC__constructor") == 0)
+          sprintf(method_name, "%s() (( CONSTRUCTOR ))", DC->classes[i].class_name);
+        else if(strcmp(DC->classes[i].method_names[j], "DC__destructor") == 0)
+          sprintf(method_name, "~%s() (( DESTRUCTOR ))", DC->classes[i].class_name);
+        else sprintf(method_name, "%s()", DC->classes[i].method_names[j]);
+        (class_objects_sum > 0) ? fprintf(DC_STDOUT, " | L_ %s\n", method_name) : fprintf(DC_STDOUT, "   L_ %s\n", method_name);
       }
     }
 
     if(class_objects_sum > 0) {
-      printf(" L_ \033[1mOBJECTS: %d\033[0m\n", class_objects_sum);
-      for(int j = 0; j < total_objects; ++j) 
-        if(strcmp(classes[i].class_name, objects[j].class_name) == 0) {
-          if(objects[j].is_class_pointer)    printf("   L_ *%s", objects[j].object_name);
-          else if(objects[j].is_class_array) printf("   L_ %s[]", objects[j].object_name);
-          else printf("   L_ %s", objects[j].object_name);
-          if(objects[j].is_immortal) printf(" (( IMMORTAL ))");
-          printf("\n");
+      fprintf(DC_STDOUT, " L_ \033[1mOBJECTS: %d\033[0m\n", class_objects_sum);
+      for(int j = 0; j < DC->total_objects; ++j) 
+        if(strcmp(DC->classes[i].class_name, DC->objects[j].class_name) == 0) {
+          if(DC->objects[j].is_class_pointer)    fprintf(DC_STDOUT, "   L_ *%s", DC->objects[j].object_name);
+          else if(DC->objects[j].is_class_array) fprintf(DC_STDOUT, "   L_ %s[]", DC->objects[j].object_name);
+          else fprintf(DC_STDOUT, "   L_ %s", DC->objects[j].object_name);
+          if(DC->objects[j].is_immortal) fprintf(DC_STDOUT, " (( IMMORTAL ))");
+          fprintf(DC_STDOUT, "\n");
         }
     }
   }
 }
+#endif
 
 // confirms w/ user as to whether declass.c ought to terminate it's parsing (generally
 // recommended) or to continue attempting declassification
-void ask_user_whether_to_quit_or_continue_declassification() {
-  printf(" >> CONTINUE DECLASSIFICATION PROCESS? ENTER 1 FOR YES & 0 FOR NO\n\n>>> ");
+static void ask_user_whether_to_quit_or_continue_declassification() {
+  if(!DC->interactive) { // no user to ask (libdeclass), so quit
+    fprintf(DC_STDERR, " >> Terminating Declassifier.\n");
+    declass_exit(EXIT_FAILURE);
+  }
+  fprintf(DC_STDOUT, " >> CONTINUE DECLASSIFICATION PROCESS? ENTER 1 FOR YES & 0 FOR NO\n\n>>> ");
   int continueDeclassification;
   scanf("%d", &continueDeclassification);
   if(continueDeclassification == 1)
-    printf("\n\n-:- CONTINUING DECLASSIFICATION PROCESS - \033[1mI HOPE YOU KNOW WHAT YOU'RE DOING\033[0m -:-\n\n");
+    ++DC->continued_errors, fprintf(DC_STDOUT, "\n\n-:- CONTINUING DECLASSIFICATION PROCESS - \033[1mI HOPE YOU KNOW WHAT YOU'RE DOING\033[0m -:-\n\n");
   else {
-    printf("\n\n >> Terminating Declassifier.\n\n");
-    exit(EXIT_SUCCESS); // having been intentionally terminated
+    fprintf(DC_STDOUT, "\n\n >> Terminating Declassifier.\n\n");
+    declass_exit(EXIT_SUCCESS); // having been intentionally terminated
   }
 }
 
 // triggered when a potential dummy ctor was found as an arg in a method
 // (highly unlikely but still a corner case) either continues declassifying
 // or terminates declass.c's conversion as per user's input
-void POSSIBLE_DUMMY_CTOR_METHOD_ARG_ERROR_MESSAGE(const char fcn[12],int line,int class_idx) {
-  fprintf(stderr, 
+static void POSSIBLE_DUMMY_CTOR_METHOD_ARG_ERROR_MESSAGE(const char fcn[12],int line,int class_idx) {
+  fprintf(DC_STDERR, 
     "\033[1mdeclass.c: \033[33mWARNING\033[0m\033[1m UNDEFINED BEHAVIOR IN FCN: \"%s\", LINE: %d\033[0m\n", fcn, line);
-  fprintf(stderr, 
+  fprintf(DC_STDERR, 
     " >> DETECTED \"%s(\" POTENTIAL \"DUMMY\" CTOR INVOCATION IN ARGS OF METHOD: \"%s\" IN CLASS: \"%s\"\n", 
-    classes[class_idx].class_name, classes[total_classes].method_names[classes[total_classes].total_methods-1], 
-    classes[class_idx].class_name);
-  fprintf(stderr, " >> DUMMY CTORS CAN RETURN OBJECTS, BUT NEVER REPRESENT THEM AS A VARIABLE!\n");
+    DC->classes[class_idx].class_name, DC->classes[DC->total_classes].method_names[DC->classes[DC->total_classes].total_methods-1], 
+    DC->classes[class_idx].class_name);
+  fprintf(DC_STDERR, " >> DUMMY CTORS CAN RETURN OBJECTS, BUT NEVER REPRESENT THEM AS A VARIABLE!\n");
   ask_user_whether_to_quit_or_continue_declassification();
 }
 
@@ -1251,25 +3693,25 @@ void POSSIBLE_DUMMY_CTOR_METHOD_ARG_ERROR_MESSAGE(const char fcn[12],int line,in
 // value not prefixed w/ "DC_" was detected (thus not a prefixed ctor as had been expected) 
 // (such being only instance where a valid double assignment could occur, and even then it's 
 // generated by declass.c not the user)
-void throw_potential_invalid_double_dflt_assignment(const char fcn[12], int line, char *class_name) {
-  fprintf(stderr, "\033[1mdeclass.c: \033[33mWARNING\033[0m\033[1m UNDEFINED BEHAVIOR IN FCN: \"%s\", LINE: %d\033[0m\n", fcn, line);
-  fprintf(stderr, 
+static void throw_potential_invalid_double_dflt_assignment(const char fcn[12], int line, char *class_name) {
+  fprintf(DC_STDERR, "\033[1mdeclass.c: \033[33mWARNING\033[0m\033[1m UNDEFINED BEHAVIOR IN FCN: \"%s\", LINE: %d\033[0m\n", fcn, line);
+  fprintf(DC_STDERR, 
     " >> DETECTED POTENTIAL DOUBLE DEFAULT-VALUE ASSINGMENT IN CLASS \"%s\" MEMBER DECLARATIONS\n", class_name);
-  fprintf(stderr, " >> NORMALLY OCCURS WHEN ALLOCATING & CONSTRUCTING A POINTER MEMBER AT ONCE\n");
-  fprintf(stderr, " >> IE: \"ClassName *objectName(args) = smrtmalloc(sizeof(className));\"\n");
+  fprintf(DC_STDERR, " >> NORMALLY OCCURS WHEN ALLOCATING & CONSTRUCTING A POINTER MEMBER AT ONCE\n");
+  fprintf(DC_STDERR, " >> IE: \"ClassName *objectName(args) = smrtmalloc(sizeof(className));\"\n");
   ask_user_whether_to_quit_or_continue_declassification();
 }
 
 // thrown if a user-defined an invalid DTOR that took args was detected
-void throw_fatal_error_dtor_has_args(char *class_name, int line_No, char *bad_code_buffer) {
-  fprintf(stderr, "\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m FOUND INVALID DTOR THAT ACCEPTS ARGS IN CLASS: \"%s\"!\033[0m\n >> FOUND HERE:\n", 
+static void throw_fatal_error_dtor_has_args(char *class_name, int line_No, char *bad_code_buffer) {
+  fprintf(DC_STDERR, "\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m FOUND INVALID DTOR THAT ACCEPTS ARGS IN CLASS: \"%s\"!\033[0m\n >> FOUND HERE:\n", 
     line_No, class_name);
-  fprintf(stderr, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
-  fprintf(stderr, " >> RMV ARGS FROM DTOR IN ORDER TO BE VALID FOR DECLASSIFICATION! DTORS CAN \033[1mNEVER\033[0m TAKE ARGS!\n");
-  if(MORTAL_ERRORS) ask_user_whether_to_quit_or_continue_declassification();
+  fprintf(DC_STDERR, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
+  fprintf(DC_STDERR, " >> RMV ARGS FROM DTOR IN ORDER TO BE VALID FOR DECLASSIFICATION! DTORS CAN \033[1mNEVER\033[0m TAKE ARGS!\n");
+  if(DC->MORTAL_ERRORS) ask_user_whether_to_quit_or_continue_declassification();
   else {
-    fprintf(stderr, " >> Terminating Declassifier.\n");
-    exit(EXIT_FAILURE);
+    fprintf(DC_STDERR, " >> Terminating Declassifier.\n");
+    declass_exit(EXIT_FAILURE);
   }
 }
 
@@ -1278,16 +3720,16 @@ void throw_fatal_error_dtor_has_args(char *class_name, int line_No, char *bad_co
 ******************************************************************************/
 
 // returns whether at a substring with either an stdlib.h, smrtptr.h, or user-defined allocation fcn
-bool is_an_alloc_fcn(char *str) {
-  for(int i = 0; i < TOTAL_ALLOC_FCNS; ++i) 
-    if(is_at_substring(str, ALLOC_FCNS[i]) && !VARCHAR(*(str + strlen(ALLOC_FCNS[i]))))
+static bool is_an_alloc_fcn(char *str) {
+  for(int i = 0; i < DC->TOTAL_ALLOC_FCNS; ++i) 
+    if(is_at_substring(str, DC->ALLOC_FCNS[i]) && !VARCHAR(*(str + strlen(DC->ALLOC_FCNS[i]))))
       return true;
   return false;
 }
 
 // given a line prefixed with "#define DECLASS_ALLOC_FCNS" parses out any user-defined
 // allocation fcns subsequently following
-void register_user_defined_alloc_fcns(char *s) { 
+static void register_user_defined_alloc_fcns(char *s) { 
   // alloc fcns must be seperate & on the same line, aside from that use spaces, commas,
   // etc. (whatever floats your boat aesthetically)
   int row = 0;
@@ -1297,8 +3739,9 @@ void register_user_defined_alloc_fcns(char *s) {
   while(*p != '\0' && (*p != '\n' || *(p-1) == '\\')) { // while still more user-defined alloc fcns
     if(VARCHAR(*p)) { // copy the current user-defined alloc fcn
       row = 0;
-      while(VARCHAR(*p)) ALLOC_FCNS[TOTAL_ALLOC_FCNS][row++] = *p++;
-      ALLOC_FCNS[TOTAL_ALLOC_FCNS++][row] = '\0';
+      reserve_class_tables(0, 0, 1);
+      while(VARCHAR(*p)) DC->ALLOC_FCNS[DC->TOTAL_ALLOC_FCNS][row++] = *p++;
+      DC->ALLOC_FCNS[DC->TOTAL_ALLOC_FCNS++][row] = '\0';
     }
     if(*p != '\n' || *(p-1) == '\\') ++p; // skip past non alloc fcns
   }
@@ -1308,34 +3751,84 @@ void register_user_defined_alloc_fcns(char *s) {
 * COMMENT & BLANK LINE SKIPPING FUNCTIONS
 ******************************************************************************/
 
-// replaces all comments inside of a class instance with spaces
-void whitespace_all_comments(char *end) { // end = 1 past 1st '{'
-  int in_class_scope = 1;
-  bool in_a_string = false, in_a_char = false, in_token_scope = true;
-  while(*end != '\0' && in_class_scope > 0) {
-    // confirm in class' scope
-    if(*end == '{') in_class_scope++;
-    else if(*end == '}') in_class_scope--;
-    account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, end);
-    if(in_class_scope < 0) break;
-    if(in_token_scope && *end == '/' && *(end + 1) == '/') {
-      while(*end != '\0' && *end != '\n') *end++ = ' ';
-    } else if(in_token_scope && *end == '/' && *(end + 1) == '*') {
-      *end++ = ' ', *end++ = ' ';
-      while(*end != '\0' && (*end != '*' || *(end + 1) != '/')) *end++ = ' ';
-      *end++ = ' ', *end++ = ' ';
+// cleans "source" into "cleaned_file" in 1 forward pass: comments are removed (trimmed like a space),
+// spaces ended by ('\n' || ';') are trimmed (down to 1 if ended by '='), sequences of '\n' are trimmed
+// to a max of 3, "DECLASS_H_" header inclusions are removed & registered (or include their split-out ".h"
+// w/ "--split-headers"), & "DC_" token names alerted
+static void clean_source(char *source, struct string_builder *cleaned_file) {
+  bool in_a_string = false, in_a_char = false, in_token_scope = true, at_line_start = true, found_reserved_prefix = false;
+  char *p = source, *w, *past_inclusion, header_name[MAX_TOKEN_NAME_LENGTH + 8], split_header_name[MAX_TOKEN_NAME_LENGTH + 24];
+  long spaces = 0, newlines = 0; // pending whitespace, written once the next char shows how to trim it
+  sb_reserve(cleaned_file, cleaned_file->len + strlen(source));
+  w = &cleaned_file->str[cleaned_file->len];
+  while(*p != '\0') {
+    if(p == source) // nothing precedes the 1st char to escape it
+      in_a_string = (*p == '"'), in_a_char = (*p == '\''), in_token_scope = !in_a_string && !in_a_char;
+    else
+      account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, p);
+    if(in_token_scope) {
+      if(*p == '/' && *(p + 1) == '/') {        // single-line comment
+        while(*p != '\0' && *p != '\n') ++p;
+        ++spaces;
+        continue;
+      } else if(*p == '/' && *(p + 1) == '*') { // block comment
+        for(p += 2; *p != '\0' && (*p != '*' || *(p + 1) != '/'); ++p);
+        if(*p != '\0') p += 2;
+        ++spaces;
+        continue;
+      } else if(*p == ' ') {
+        ++spaces, ++p;
+        continue;
+      } else if(*p == '\n') {                   // spaces ended by '\n' are trimmed
+        spaces = 0, ++newlines, ++p;
+        at_line_start = true;
+        continue;
+      } else if(*p == '#' && at_line_start && (past_inclusion = register_DECLASS_H_header_inclusion(p, header_name)) != NULL) {
+        p = past_inclusion;                     // rmv "DECLASS_H_" header's inclusion
+        if(DC->SPLIT_HEADERS) {                 // or include its split-out ".h" in its place
+          split_DECLASS_H_filename(header_name, "_DECLASS.h", split_header_name);
+          w = sb_reserve_at(cleaned_file, w, spaces + strlen(split_header_name) + 16);
+          for(newlines = (newlines > 3) ? 3 : newlines; newlines > 0; --newlines) *w++ = '\n';
+          for(; spaces > 0; --spaces) *w++ = ' ';
+          w += sprintf(w, "#include \"%s\"", split_header_name);
+          at_line_start = false;
+        }
+        continue;
+      } else if(*p == 'D' && !found_reserved_prefix && is_at_substring(p, "DC_") && (p == source || !VARCHAR(*(p-1)))) {
+        found_reserved_prefix = true;           // confirm user didn't use "DC_" to prefix any token names
+        reserved_DC_prefix_alert(source, p);
+      }
+      if(*p == ';') spaces = 0;                 // spaces ended by ';' are trimmed
+      else if(*p == '=' && spaces > 0) spaces = 1;
     }
-    end++;
+    // write pending whitespace & the current char
+    w = sb_reserve_at(cleaned_file, w, spaces + 4);
+    for(newlines = (newlines > 3) ? 3 : newlines; newlines > 0; --newlines) *w++ = '\n';
+    for(; spaces > 0; --spaces) *w++ = ' ';
+    if(!IS_WHITESPACE(*p)) at_line_start = false;
+    *w++ = *p++;
   }
+  w = sb_reserve_at(cleaned_file, w, spaces + 4);
+  for(newlines = (newlines > 3) ? 3 : newlines; newlines > 0; --newlines) *w++ = '\n';
+  for(; spaces > 0; --spaces) *w++ = ' ';
+  *w = '\0';
+  cleaned_file->len = w - cleaned_file->str;
 }
 
-// trims any sequences of spaces ended by ('\n' || ';' || '=') to just ('\n' || ';' || '=') 
-// in "OLD_BUFFER" -- also trims any sequence of '\n' down to a max of 3 '\n'
-void trim_sequential_spaces(char OLD_BUFFER[]) {
-  char *read = OLD_BUFFER, NEW_BUFFER[MAX_FILESIZE], *scout, *write;
-  FLOOD_ZEROS(NEW_BUFFER, MAX_FILESIZE);
+// trims any sequences of spaces ended by ('\n' || ';' || '=') to just ('\n' || ';' || '=')
+// in "OLD_BUFFER" -- also trims any sequence of '\n' down to a max of 3 '\n', returns new length.
+// the spans of the "total_segments" header "segments" in "OLD_BUFFER" are moved w/ their text
+static long trim_sequential_spaces(char OLD_BUFFER[], struct header_segment *segments, int total_segments) {
+  char *read = OLD_BUFFER, *NEW_BUFFER = malloc(strlen(OLD_BUFFER) + 1), *scout, *write;
+  int moved = 0;
+  if(NEW_BUFFER == NULL) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY TO TRIM SPACES!\033[0m\n\n", __LINE__);
+    declass_exit(EXIT_FAILURE);
+  }
   bool in_a_string = false, in_a_char = false, in_token_scope = true;
   write = NEW_BUFFER;
+  if(*read == '\0') { free(NEW_BUFFER); return 0; }
+  move_segment_spans(segments, total_segments, &moved, 0, 0);
   *write++ = *read++;                                   // so first string check doesn't check garbage memory
   while(*read != '\0') {
     account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, read);
@@ -1349,16 +3842,32 @@ void trim_sequential_spaces(char OLD_BUFFER[]) {
       scout = read;
       while(*scout != '\0' && *scout == '\n') ++scout;
       read = scout;
+      if(*read == '\0') break; // trailing '\n's ended the file
     }
+    move_segment_spans(segments, total_segments, &moved, read - OLD_BUFFER, write - NEW_BUFFER);
     *write++ = *read++;
   }
   *write = '\0';
-  FLOOD_ZEROS(OLD_BUFFER, MAX_FILESIZE);
-  strcpy(OLD_BUFFER, NEW_BUFFER);
+  long new_length = write - NEW_BUFFER;
+  move_segment_spans(segments, total_segments, &moved, LONG_MAX, new_length);
+  memcpy(OLD_BUFFER, NEW_BUFFER, new_length);
+  memset(&OLD_BUFFER[new_length], 0, (read - OLD_BUFFER) - new_length + 1); // zero trimmed-off tail
+  free(NEW_BUFFER);
+  return new_length;
+}
+
+// moves each of the "total_segments" "segments"' span offsets (each's start, then end, in ascending order) from
+// the '*moved'th on that's at or before "old_offset" to "new_offset"
+static void move_segment_spans(struct header_segment *segments, int total_segments, int *moved, long old_offset, long new_offset) {
+  for(; *moved < 2 * total_segments; ++*moved) {
+    long *offset = (*moved % 2 == 0) ? &segments[*moved / 2].start : &segments[*moved / 2].end;
+    if(*offset > old_offset) return;
+    *offset = new_offset;
+  }
 }
 
 // gives size to skip of lines composed solely of whitespaces with '\n's at either end
-int remove_blank_lines(char *end) {
+static int remove_blank_lines(char *end) {
   char *blank_char = end + 1;               // 'end' starts at '\n'
   int total_blank_chars = 0;
   while(true) {                             // while still more blank lines
@@ -1377,22 +3886,380 @@ int remove_blank_lines(char *end) {
 ******************************************************************************/
 
 // returns whether c exists in '*bad_chars'
-bool no_overlap(char c, char *bad_chars) {
+static bool no_overlap(char c, char *bad_chars) {
   while(*bad_chars != '\0') if(*bad_chars++ == c) return false;
   return true;
 }
 
 // returns if 'p' points to the particular substring 'substr'
-bool is_at_substring(char *p, char *substr) {
+static bool is_at_substring(char *p, char *substr) {
   while(*substr != '\0' && *p != '\0' && *p == *substr) ++p, ++substr;
   return (*substr == '\0');
 }
 
-// checks if p is in a string or char, assigning the respective "bool" ptrs accordingly
-void account_for_string_char_scopes(bool *in_a_string, bool *in_a_char, bool *in_token_scope, char *p) {
-  if(!(*in_a_char)   && *p == '"'  && (*(p-1) != '\\' || *(p-2) == '\\')) *in_a_string = !(*in_a_string);
-  if(!(*in_a_string) && *p == '\'' && (*(p-1) != '\\' || *(p-2) == '\\')) *in_a_char   = !(*in_a_char);
-  *in_token_scope = (!(*in_a_string) && !(*in_a_char));
+// checks if p is in a string or char, assigning the respective "bool" ptrs accordingly
+static void account_for_string_char_scopes(bool *in_a_string, bool *in_a_char, bool *in_token_scope, char *p) {
+  if(!(*in_a_char)   && *p == '"'  && !is_escaped(p)) *in_a_string = !(*in_a_string);
+  if(!(*in_a_string) && *p == '\'' && !is_escaped(p)) *in_a_char   = !(*in_a_char);
+  *in_token_scope = (!(*in_a_string) && !(*in_a_char));
+}
+
+// returns whether the char at 'p' is escaped (preceded by an odd # of consecutive backslashes)
+static bool is_escaped(char *p) {
+  bool escaped = false;
+  while(*(--p) == '\\') escaped = !escaped;
+  return escaped;
+}
+
+/******************************************************************************
+* STRING BUILDER FUNCTIONS
+******************************************************************************/
+
+// grows 'sb' geometrically until it can hold 'len' chars + '\0'
+static void sb_reserve(struct string_builder *sb, long len) {
+  if(len < sb->max) return;
+  long max = (sb->max == 0) ? 256 : sb->max;
+  while(max <= len) max *= 2;
+  char *str = realloc(sb->str, max);
+  if(str == NULL) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR STRING BUFFER!\033[0m\n\n", __LINE__);
+    declass_exit(EXIT_FAILURE);
+  }
+  if(sb->max == 0) str[0] = '\0';
+  sb->str = str, sb->max = max;
+}
+
+// reserves 'n' chars past 'cursor' (a raw write position in 'sb'), returning 'cursor' relocated to 'sb's memory
+static char *sb_reserve_at(struct string_builder *sb, char *cursor, long n) {
+  long offset = cursor - sb->str;
+  sb_reserve(sb, offset + n);
+  return &sb->str[offset];
+}
+
+// reserves & zeros 'n' chars past 'sb's end: room to splice into & to read past '\0' w/o hitting garbage
+static void sb_zero_pad(struct string_builder *sb, long n) {
+  sb_reserve(sb, sb->len + n);
+  memset(&sb->str[sb->len], 0, n + 1);
+}
+
+// appends the 1st 'n' chars of 'str' to 'sb'
+static void sb_appendn(struct string_builder *sb, char *str, long n) {
+  sb_reserve(sb, sb->len + n);
+  memcpy(&sb->str[sb->len], str, n);
+  sb->len += n;
+  sb->str[sb->len] = '\0';
+}
+
+// appends 'str' to 'sb'
+static void sb_append(struct string_builder *sb, char *str) {
+  sb_appendn(sb, str, strlen(str));
+}
+
+// appends 'c' to 'sb'
+static void sb_putc(struct string_builder *sb, char c) {
+  sb_reserve(sb, sb->len + 1);
+  sb->str[sb->len++] = c;
+  sb->str[sb->len] = '\0';
+}
+
+// appends the formatted string to 'sb' (same as sprintf at 'sb's end)
+static void sb_printf(struct string_builder *sb, const char *format, ...) {
+  va_list args, args_copy;
+  va_start(args, format);
+  va_copy(args_copy, args);
+  int n = vsnprintf(NULL, 0, format, args);
+  va_end(args);
+  sb_reserve(sb, sb->len + n);
+  vsnprintf(&sb->str[sb->len], n + 1, format, args_copy);
+  va_end(args_copy);
+  sb->len += n;
+}
+
+// shortens 'sb' to its 1st 'len' chars
+static void sb_truncate(struct string_builder *sb, long len) {
+  if(len < 0) len = 0;
+  if(len >= sb->len) return;
+  sb->len = len;
+  sb->str[len] = '\0';
+}
+
+// frees 'sb's contents & empties it
+static void sb_free(struct string_builder *sb) {
+  free(sb->str);
+  sb->str = NULL, sb->len = sb->max = 0;
+}
+
+/******************************************************************************
+* FILE SCRAPING FUNCTIONS
+******************************************************************************/
+
+// returns "path" as seen from the working directory of the file being declassified: w/ "--serve", each
+// request's own (as the server's threads share 1 process-wide cwd), written into "resolved" ("PATH_MAX")
+static char *resolve_path(char *path, char *resolved) {
+  if(DC == NULL || DC->working_dir == NULL || *path == '/') return path;
+  snprintf(resolved, PATH_MAX, "%s/%s", DC->working_dir, path);
+  return resolved;
+}
+
+// appends 'filename's contents to 'sb': maps the file read-only & copies it in 1 pass
+// (no line-by-line reads nor size cap), leaving "FILE_BUFFER_PADDING" zero'd chars past its end
+static void scrape_file(char *filename, struct string_builder *sb) {
+  struct stat buf;
+  char resolved[PATH_MAX], *mapped = NULL;
+  int fd = open(resolve_path(filename, resolved), O_RDONLY);
+  if(fd < 0 || fstat(fd, &buf)) {
+    if(fd >= 0) close(fd); // (fatal errors may return to a long-lived caller rather than exit)
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T READ FILE \"%s\"!\033[0m\n\n", __LINE__, filename);
+    declass_exit(EXIT_FAILURE);
+  }
+  long size = buf.st_size;
+  if(size > 0) mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // the mapping outlives its descriptor
+  if(mapped == MAP_FAILED) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T MAP FILE \"%s\" INTO MEMORY!\033[0m\n\n", __LINE__, filename);
+    declass_exit(EXIT_FAILURE);
+  }
+  sb_reserve(sb, sb->len + size + FILE_BUFFER_PADDING);
+  if(size > 0) {
+    posix_madvise(mapped, size, POSIX_MADV_SEQUENTIAL);
+    memcpy(&sb->str[sb->len], mapped, size);
+    munmap(mapped, size);
+  }
+  sb->len += size;
+  sb_zero_pad(sb, FILE_BUFFER_PADDING);
+}
+
+/******************************************************************************
+* HASHED NAME INDEX FUNCTIONS
+******************************************************************************/
+
+// FNV-1a hash of the 1st 'len' chars of 'token'
+static unsigned long hash_token(char *token, int len) {
+  unsigned long hash = 2166136261UL;
+  for(int i = 0; i < len; ++i) hash = (hash ^ (unsigned char)token[i]) * 16777619UL;
+  return hash;
+}
+
+// adds 'name' to 'index' as referring to idx 'id' (shadows any prior entries of the same name)
+static void name_index_add(struct name_index *index, char *name, int id) {
+  if(index->total_entries == index->max_entries) { // grow entries geometrically
+    index->max_entries = (index->max_entries == 0) ? 64 : index->max_entries * 2;
+    index->entries = realloc(index->entries, sizeof(struct name_index_entry) * index->max_entries);
+    if(index->entries == NULL) {
+      fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR NAME INDEX!\033[0m\n\n", __LINE__);
+      declass_exit(EXIT_FAILURE);
+    }
+  }
+  if(index->total_entries >= index->total_buckets) { // rehash w/ twice the buckets, keeping newest entries 1st
+    index->total_buckets = (index->total_buckets == 0) ? 128 : index->total_buckets * 2;
+    index->buckets = realloc(index->buckets, sizeof(int) * index->total_buckets);
+    if(index->buckets == NULL) {
+      fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR NAME INDEX!\033[0m\n\n", __LINE__);
+      declass_exit(EXIT_FAILURE);
+    }
+    for(int i = 0; i < index->total_buckets; ++i) index->buckets[i] = -1;
+    for(int i = 0; i < index->total_entries; ++i) {
+      int bucket = index->entries[i].hash & (index->total_buckets - 1);
+      index->entries[i].next = index->buckets[bucket], index->buckets[bucket] = i;
+    }
+  }
+  struct name_index_entry *entry = &index->entries[index->total_entries];
+  FLOOD_ZEROS(entry->name, MAX_TOKEN_NAME_LENGTH);
+  strcpy(entry->name, name);
+  entry->hash = hash_token(name, strlen(name)), entry->id = id;
+  int bucket = entry->hash & (index->total_buckets - 1);
+  entry->next = index->buckets[bucket], index->buckets[bucket] = index->total_entries++;
+}
+
+// returns entry position of newest entry named by the 1st 'len' chars of 'name' (-1 if none),
+// passing a prior returned position as 'from' continues the search onto older entries of the same name
+static int name_index_find(struct name_index *index, char *name, int len, int from) {
+  if(index->total_buckets == 0 || len >= MAX_TOKEN_NAME_LENGTH) return -1;
+  unsigned long hash = hash_token(name, len);
+  int pos = (from < 0) ? index->buckets[hash & (index->total_buckets - 1)] : index->entries[from].next;
+  for(; pos != -1; pos = index->entries[pos].next)
+    if(index->entries[pos].hash == hash && strncmp(index->entries[pos].name, name, len) == 0 
+      && index->entries[pos].name[len] == '\0') 
+      return pos;
+  return -1;
+}
+
+// removes all entries added after the index held 'total_entries' entries
+static void name_index_truncate(struct name_index *index, int total_entries) {
+  // newer entries always head their bucket chain, so unlink from newest to oldest
+  while(index->total_entries > total_entries) {
+    struct name_index_entry *entry = &index->entries[--index->total_entries];
+    index->buckets[entry->hash & (index->total_buckets - 1)] = entry->next;
+  }
+}
+
+// frees an index's buckets & entries
+static void free_name_index(struct name_index *index) {
+  free(index->buckets);
+  free(index->entries);
+}
+
+// returns "classes" idx of the class named by the 1st 'len' chars of 'name' (-1 if not 1 of the 1st 'total' classes)
+static int class_named(char *name, int len, int total) {
+  for(int pos = name_index_find(&DC->CLASS_INDEX, name, len, -1); pos != -1; pos = name_index_find(&DC->CLASS_INDEX, name, len, pos))
+    if(DC->CLASS_INDEX.entries[pos].id < total) return DC->CLASS_INDEX.entries[pos].id;
+  return -1;
+}
+
+// returns "classes" idx of the class named by the identifier starting at 'p' 
+// (-1 if not at the start of an identifier naming 1 of the 1st 'total' classes)
+static int class_at(char *p, int total) {
+  int len = 0;
+  if(total == 0 || !VARCHAR(*p) || VARCHAR(*(p-1))) return -1;
+  while(VARCHAR(p[len])) ++len;
+  return class_named(p, len, total);
+}
+
+/******************************************************************************
+* LEXER FUNCTIONS
+******************************************************************************/
+
+// returns id of the identifier made of the 1st 'len' chars of 'name' (-1 if never interned)
+static int identifier_id(char *name, int len) {
+  int pos = name_index_find(&DC->IDENTIFIER_INDEX, name, len, -1);
+  return (pos == -1) ? -1 : DC->IDENTIFIER_INDEX.entries[pos].id;
+}
+
+// returns id of the identifier made of the 1st 'len' chars of 'name', interning it if new
+// (-1 if too long to intern) -- every id has a "cola_names" entry, w/o any table entries if new
+static int intern_identifier(char *name, int len) {
+  char identifier[MAX_TOKEN_NAME_LENGTH];
+  int id = identifier_id(name, len);
+  if(id != -1 || len >= MAX_TOKEN_NAME_LENGTH) return id;
+  memcpy(identifier, name, len);
+  identifier[len] = '\0';
+  if(DC->cola_names_size == DC->cola_names_max) { // grow "cola_names" geometrically
+    DC->cola_names_max = (DC->cola_names_max == 0) ? 64 : DC->cola_names_max * 2;
+    DC->cola_names = realloc(DC->cola_names, sizeof(struct cola_name_entries) * DC->cola_names_max);
+    if(DC->cola_names == NULL) {
+      fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR IDENTIFIER INDEX!\033[0m\n\n", __LINE__);
+      declass_exit(EXIT_FAILURE);
+    }
+  }
+  id = DC->cola_names_size++;
+  DC->cola_names[id].newest_fmac = DC->cola_names[id].overload_idx = DC->cola_names[id].dflt_idx = -1;
+  name_index_add(&DC->IDENTIFIER_INDEX, identifier, id);
+  return id;
+}
+
+// lexes '\0'-terminated 'buf' in 1 pass into 'stream': comments, string/char literals (skipping 
+// any escaped char), identifiers (interned), pp-numbers, & 1-char punctuators w/ their brace depth
+// ('block_only' stops at the '}' closing the brace block 'buf' starts in)
+static void lex_tokens(char *buf, struct token_stream *stream, bool block_only) {
+  char *p = buf, *start;
+  int depth = 0, kind;
+  bool block_closed = false;
+  stream->total = 0;
+  while(*p != '\0' && !block_closed) {
+    if(IS_WHITESPACE(*p)) { ++p; continue; }
+    start = p;
+    if(*p == '/' && *(p + 1) == '/') {             // single-line comment (w/ '\' line continuations)
+      kind = TOKEN_COMMENT;
+      for(p += 2; *p != '\0' && (*p != '\n' || *(p-1) == '\\'); ++p);
+    } else if(*p == '/' && *(p + 1) == '*') {      // block comment
+      kind = TOKEN_COMMENT;
+      for(p += 2; *p != '\0' && (*p != '*' || *(p + 1) != '/'); ++p);
+      if(*p != '\0') p += 2;
+    } else if(*p == '"' || *p == '\'') {           // string or char literal
+      kind = (*p == '"') ? TOKEN_STRING : TOKEN_CHAR;
+      for(++p; *p != '\0' && *p != *start; ++p)
+        if(*p == '\\' && *(p + 1) != '\0') ++p;    // skip escaped char
+      if(*p != '\0') ++p;
+    } else if(VARCHAR(*p) && !(*p >= '0' && *p <= '9')) { // identifier
+      kind = TOKEN_IDENTIFIER;
+      while(VARCHAR(*p)) ++p;
+    } else if((*p >= '0' && *p <= '9') || (*p == '.' && *(p + 1) >= '0' && *(p + 1) <= '9')) { // pp-number
+      kind = TOKEN_NUMBER;
+      for(++p; VARCHAR(*p) || *p == '.' || ((*p == '+' || *p == '-') && strchr("eEpP", *(p-1)) != NULL); ++p);
+    } else {                                       // punctuator
+      kind = TOKEN_PUNCTUATOR;
+      if(*p == '}' && depth > 0) --depth;
+      else if(*p == '}')         block_closed = block_only;
+      ++p;
+    }
+    if(stream->total == stream->max) {
+      stream->max = (stream->max == 0) ? 1024 : stream->max * 2;
+      stream->tokens = realloc(stream->tokens, sizeof(struct token) * stream->max);
+      if(stream->tokens == NULL) {
+        fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR TOKEN STREAM!\033[0m\n\n", __LINE__);
+        declass_exit(EXIT_FAILURE);
+      }
+    }
+    struct token *token = &stream->tokens[stream->total++];
+    token->offset = start - buf, token->length = p - start;
+    token->id = (kind == TOKEN_IDENTIFIER) ? intern_identifier(start, p - start) : -1;
+    token->kind = kind, token->depth = depth;
+    if(kind == TOKEN_PUNCTUATOR && *start == '{') ++depth;
+  }
+}
+
+// frees 'stream's tokens
+static void free_token_stream(struct token_stream *stream) {
+  free(stream->tokens);
+  stream->tokens = NULL;
+  stream->total = stream->max = 0;
+}
+
+// returns the 1st char at or past 'p' a pass walking 'stream' (lexed from 'buf') acts on, moving "*next" past
+// the tokens before it: identifiers & the char before them (where objects are declared & methods invoked),
+// their last char if 'word_ends', & the punctuators in 'punctuators' ('#' only at a line's start).
+// NULL if none left, as everything else (literals, numbers, & other punctuators) is copied as is
+static char *next_token_stop(char *buf, struct token_stream *stream, int *next, char *p, char *punctuators, bool word_ends) {
+  for(; *next < stream->total; ++*next) {
+    struct token *token = &stream->tokens[*next];
+    char *start = &buf[token->offset];
+    if(token->kind == TOKEN_IDENTIFIER) {
+      if(token->offset > 0 && start - 1 >= p)         return start - 1;
+      if(start >= p)                                  return start;
+      if(word_ends && start + token->length - 1 >= p) return start + token->length - 1;
+    } else if(token->kind == TOKEN_PUNCTUATOR && start >= p && strchr(punctuators, *start) != NULL
+      && (*start != '#' || token->offset == 0 || *(start - 1) == '\n')) {
+      return start;
+    }
+  }
+  return NULL;
+}
+
+// returns whether the '(' at 'p' (lexed into 'stream' from 'buf') opens a fcn definition's parameter list,
+// IE its ')' is directly followed by a '{'
+static bool opens_fcn_definition_params(char *buf, struct token_stream *stream, char *p) {
+  int lo = 0, hi = stream->total - 1, t = -1, parens = 0;
+  while(lo <= hi) { // binary search for the '(' token (tokens are in offset order)
+    int mid = lo + (hi - lo) / 2;
+    if(&buf[stream->tokens[mid].offset] == p) { t = mid; break; }
+    if(&buf[stream->tokens[mid].offset] < p) lo = mid + 1; else hi = mid - 1;
+  }
+  if(t == -1 || stream->tokens[t].kind != TOKEN_PUNCTUATOR) return false;
+  for(; t < stream->total; ++t) {
+    char c = buf[stream->tokens[t].offset];
+    if(stream->tokens[t].kind != TOKEN_PUNCTUATOR) continue;
+    if(c == '(') ++parens;
+    else if(c == ')' && --parens == 0)
+      return t + 1 < stream->total && stream->tokens[t + 1].kind == TOKEN_PUNCTUATOR && buf[stream->tokens[t + 1].offset] == '{';
+    else if(c == ';' || c == '{' || c == '}') return false;
+  }
+  return false;
+}
+
+/******************************************************************************
+* OBJECT SYMBOL TABLE SCOPE FUNCTIONS
+******************************************************************************/
+
+// enter a new brace scope: objects declared from here on are dropped upon its "pop"
+static void push_object_scope() {
+  if(DC->OBJECT_SCOPE_DEPTH < MAX_OBJECT_SCOPE_DEPTH) DC->OBJECT_SCOPE_MARKS[DC->OBJECT_SCOPE_DEPTH] = DC->OBJECT_INDEX.total_entries;
+  ++DC->OBJECT_SCOPE_DEPTH;
+}
+
+// leave the current brace scope: its objects' names no longer resolve to them
+static void pop_object_scope() {
+  if(DC->OBJECT_SCOPE_DEPTH == 0) return;
+  if(--DC->OBJECT_SCOPE_DEPTH < MAX_OBJECT_SCOPE_DEPTH) name_index_truncate(&DC->OBJECT_INDEX, DC->OBJECT_SCOPE_MARKS[DC->OBJECT_SCOPE_DEPTH]);
 }
 
 /******************************************************************************
@@ -1402,7 +4269,7 @@ void account_for_string_char_scopes(bool *in_a_string, bool *in_a_char, bool *in
 // given "read" ptr @ 1st letter of dummy ctor's class name, fills the "invoking CHAIN"
 // string, assigns whether or not the invoking NAME is an object ptr, & assigns whether object being redefined
 // (thus not declared).
-void get_dummy_ctor_invoking_object_chain(char *read, char *invoking_chain, int class_idx, bool *invoked_by_ptr, bool *is_redefined) {
+static void get_dummy_ctor_invoking_object_chain(char *read, char *invoking_chain, int class_idx, bool *invoked_by_ptr, bool *is_redefined) {
   // suppose object o1 (of class c1) contains object o2 (of class c2). 
   // Initializing "o2" w/ its class' dummy ctor "c2()": "o1.o2 = c2();"
   // INVOKING CHAIN: "o1.o2" -- INVOKING NAME:  "o2"
@@ -1437,7 +4304,7 @@ void get_dummy_ctor_invoking_object_chain(char *read, char *invoking_chain, int
       if(VARCHAR(*scout)) {             // check if a declaration (ie NOT a redefinition)
         while(VARCHAR(*scout)) --scout; // move to the just prior the preceding word (or class name if declaration)
         ++scout;                        // move to first letter of the preceding word 
-        *is_redefined = !is_at_substring(scout, classes[class_idx].class_name);
+        *is_redefined = !is_at_substring(scout, DC->classes[class_idx].class_name);
         break;
       }
     }
@@ -1456,9 +4323,9 @@ void get_dummy_ctor_invoking_object_chain(char *read, char *invoking_chain, int
     *q = '\0';
   } else strcpy(invoking_name, invoking_chain);
 
-  for(int i = 0; i < total_objects; ++i)
-    if(strcmp(objects[i].object_name, invoking_name) == 0 && strcmp(objects[i].class_name, classes[class_idx].class_name) == 0) {
-      *invoked_by_ptr = objects[i].is_class_pointer;
+  for(int i = 0; i < DC->total_objects; ++i)
+    if(strcmp(DC->objects[i].object_name, invoking_name) == 0 && strcmp(DC->objects[i].class_name, DC->classes[class_idx].class_name) == 0) {
+      *invoked_by_ptr = DC->objects[i].is_class_pointer;
       return;
     }
 }
@@ -1468,181 +4335,160 @@ void get_dummy_ctor_invoking_object_chain(char *read, char *invoking_chain, int
 ******************************************************************************/
 
 // returns whether member value is a dummy ctor -- ie a class name
-bool is_a_dummy_ctor(char *member_value) {
-  for(int i = 0; i < total_classes; ++i)
-    if(is_at_substring(member_value, classes[i].class_name) 
-      && !VARCHAR(*(member_value + strlen(classes[i].class_name))))
-      return true;
-  return false;
+static bool is_a_dummy_ctor(char *member_value) {
+  int len = 0;
+  while(VARCHAR(member_value[len])) ++len;
+  return len > 0 && class_named(member_value, len, DC->total_classes) != -1;
 }
 
-// given a class index, returns an initialization brace for it's member values
-void mk_initialization_brace(char brace[], int class_index) {
-  char *p = brace;
-  strcpy(p, "{&DC__NDTR,");
-  p += strlen(p);
-  for(int j = 1; j < classes[class_index].total_members; ++j) { // 1 not 0 to skip over dflt included "object has been dtor'd flag" member
-    if(classes[class_index].member_values[j][0] == 0) { // empty value
+// given a class index, appends an initialization brace for it's member values to 'brace'
+static void mk_initialization_brace(struct string_builder *brace, int class_index) {
+  sb_append(brace, "{&DC__NDTR,");
+  for(int j = 1; j < DC->classes[class_index].total_members; ++j) { // 1 not 0 to skip over dflt included "object has been dtor'd flag" member
+    if(DC->classes[class_index].member_values[j][0] == 0) { // empty value
       // if struct's member (struct inner members' name = value = 0), skip
-      if(classes[class_index].member_names[j][0] == 0) continue;
-      else if(classes[class_index].member_is_array[j] || (j > 1 && classes[class_index].member_names[j-1][0] == 0)
-        || (classes[class_index].member_object_class_name[j][0] != 0 && !classes[class_index].member_is_pointer[j]))
-          sprintf(p, "{0},"); // wrap empty (non-ptr) array/object/struct value in braces
-      else if((j > 1 && classes[class_index].member_names[j-1][0] != 0) || j == 1) 
-        sprintf(p, "0,"); 
+      if(DC->classes[class_index].member_names[j][0] == 0) continue;
+      else if(DC->classes[class_index].member_is_array[j] || (j > 1 && DC->classes[class_index].member_names[j-1][0] == 0)
+        || (DC->classes[class_index].member_object_class_name[j][0] != 0 && !DC->classes[class_index].member_is_pointer[j]))
+          sb_append(brace, "{0},"); // wrap empty (non-ptr) array/object/struct value in braces
+      else if((j > 1 && DC->classes[class_index].member_names[j-1][0] != 0) || j == 1) 
+        sb_append(brace, "0,"); 
     } else {
-      if(is_a_dummy_ctor(classes[class_index].member_values[j])) // prefix dummy ctor names as needed
-        sprintf(p, "DC__DUMMY_"), p += strlen(p); 
-      sprintf(p, "%s,", classes[class_index].member_values[j]);  // non-empty value
+      if(is_a_dummy_ctor(DC->classes[class_index].member_values[j])) // prefix dummy ctor names as needed
+        sb_append(brace, "DC__DUMMY_"); 
+      sb_printf(brace, "%s,", DC->classes[class_index].member_values[j]); // non-empty value
     }
-    p += strlen(p);
   }
-  *p++ = '}';
-  *p = '\0';
+  sb_putc(brace, '}');
 }
 
 // appends ctor-macros for object arrays to the "ctor_macros" string
-void mk_object_array_ctor_macros(char ctor_macros[], char *class_name) {
-  char *p = ctor_macros;
-  if(classes[total_classes].total_uctors == 0) { 
+static void mk_object_array_ctor_macros(struct string_builder *ctor_macros, char *class_name) {
+  if(DC->classes[DC->total_classes].total_uctors == 0) { 
     // add a macro to invoke the dflt ctor for object arrays
-    sprintf(p, "\n#define DC__%s_UCTOR_ARR(DC_ARR) ({\\\n\
+    sb_printf(ctor_macros, "\n#define DC__%s_UCTOR_ARR(DC_ARR) ({\\\n\
   for(int DC__%s_UCTOR_IDX=0;DC__%s_UCTOR_IDX<(sizeof(DC_ARR)/sizeof(DC_ARR[0]));\
 ++DC__%s_UCTOR_IDX)\\\nDC_%s_(&DC_ARR[DC__%s_UCTOR_IDX]);\\\n})", class_name, class_name, class_name, class_name, class_name, class_name);
   } else { 
 
     // add macros to invoke user-defined ctors for object arrays
-    for(int i = 0, j, number_of_args; i < classes[total_classes].total_uctors; ++i) {
-      number_of_args = classes[total_classes].class_uctor_arg_lengths[i];
+    for(int i = 0, j, number_of_args; i < DC->classes[DC->total_classes].total_uctors; ++i) {
+      number_of_args = DC->classes[DC->total_classes].class_uctor_arg_lengths[i];
       // no-arg user-def'd ctor object array macro
       if(number_of_args == 0) { 
-        sprintf(p, "\n#define DC__%s_UCTOR_ARR(DC_ARR) ({\\\n\
+        sb_printf(ctor_macros, "\n#define DC__%s_UCTOR_ARR(DC_ARR) ({\\\n\
   for(int DC__%s_UCTOR_IDX=0;DC__%s_UCTOR_IDX<(sizeof(DC_ARR)/sizeof(DC_ARR[0]));\
 ++DC__%s_UCTOR_IDX)\\\nDC_%s_(&DC_ARR[DC__%s_UCTOR_IDX]);\\\n})", class_name, class_name, class_name, class_name, class_name, class_name);
 
       // has-arg(s) user-def'd ctor object array macro
       } else {
-        sprintf(p, "\n#define DC__%s_UCTOR_ARR(DC_ARR", class_name), p += strlen(p);
-        // sprintf args variables
+        sb_printf(ctor_macros, "\n#define DC__%s_UCTOR_ARR(DC_ARR", class_name);
+        // append args variables
         for(j = 0; j < number_of_args; ++j)
-          sprintf(p, ", DC___A%d_%s", j + 1, class_name), p += strlen(p);
-        // sprintf loop to iterate over object array's individual objects
-        sprintf(p, ") ({\\\n\
+          sb_printf(ctor_macros, ", DC___A%d_%s", j + 1, class_name);
+        // append loop to iterate over object array's individual objects
+        sb_printf(ctor_macros, ") ({\\\n\
   for(int DC__%s_UCTOR_IDX=0;DC__%s_UCTOR_IDX<(sizeof(DC_ARR)/sizeof(DC_ARR[0]));\
 ++DC__%s_UCTOR_IDX)\\\n    DC_%s_(", class_name, class_name, class_name, class_name);
-        p += strlen(p);
-        // sprintf args in user-def'd ctor invocation per object in array loop-iteration
+        // append args in user-def'd ctor invocation per object in array loop-iteration
         for(j = 0; j < number_of_args; ++j)
-          sprintf(p, "DC___A%d_%s, ", j + 1, class_name), p += strlen(p);
+          sb_printf(ctor_macros, "DC___A%d_%s, ", j + 1, class_name);
         // pass object in object array to user-defined ctor
-        sprintf(p, "&DC_ARR[DC__%s_UCTOR_IDX]);\\\n})", class_name);
+        sb_printf(ctor_macros, "&DC_ARR[DC__%s_UCTOR_IDX]);\\\n})", class_name);
       }
-      p += strlen(p);
     }
   }
-  p += strlen(p);
-  *p = '\0';
 }
 
 // fills "ctor_macros" string w/ macros for both single & array object constructions/initializations
-void mk_ctor_macros(char ctor_macros[], char *class_name) {
-  char *p = ctor_macros;
+static void mk_ctor_macros(struct string_builder *ctor_macros, char *class_name) {
   // add macro for a single object construction instance
-  sprintf(p, "#define DC__%s_CTOR(DC_THIS) ({DC_THIS = DC__%s_DFLT();", class_name, class_name);
-  p += strlen(p);
+  sb_printf(ctor_macros, "#define DC__%s_CTOR(DC_THIS) ({DC_THIS = DC__%s_DFLT();", class_name, class_name);
   // search for members that are also other class objects
-  for(int l = 0; l < classes[total_classes].total_members; ++l) {
-    if(classes[total_classes].member_object_class_name[l][0] != 0) { // member = class object
+  for(int l = 0; l < DC->classes[DC->total_classes].total_members; ++l) {
+    if(DC->classes[DC->total_classes].member_object_class_name[l][0] != 0) { // member = class object
       // append macros to initialize any members that are class objects
-      if(classes[total_classes].member_is_array[l]) // append arr ctor
-        sprintf(p, "\\\n\tDC__%s_ARR(DC_THIS.%s);",     classes[total_classes].member_object_class_name[l], classes[total_classes].member_names[l]);
-      else if(classes[total_classes].member_value_is_alloc[l]) // append 1 obj ctor
-        sprintf(p, "\\\n\tDC__%s_CTOR(*(DC_THIS.%s));", classes[total_classes].member_object_class_name[l], classes[total_classes].member_names[l]);
-      else if(!classes[total_classes].member_is_pointer[l])    // append 1 obj ctor
-        sprintf(p, "\\\n\tDC__%s_CTOR(DC_THIS.%s);",    classes[total_classes].member_object_class_name[l], classes[total_classes].member_names[l]);
-      p += strlen(p);
+      if(DC->classes[DC->total_classes].member_is_array[l]) // append arr ctor
+        sb_printf(ctor_macros, "\\\n\tDC__%s_ARR(DC_THIS.%s);",     DC->classes[DC->total_classes].member_object_class_name[l], DC->classes[DC->total_classes].member_names[l]);
+      else if(DC->classes[DC->total_classes].member_value_is_alloc[l]) // append 1 obj ctor
+        sb_printf(ctor_macros, "\\\n\tDC__%s_CTOR(*(DC_THIS.%s));", DC->classes[DC->total_classes].member_object_class_name[l], DC->classes[DC->total_classes].member_names[l]);
+      else if(!DC->classes[DC->total_classes].member_is_pointer[l])    // append 1 obj ctor
+        sb_printf(ctor_macros, "\\\n\tDC__%s_CTOR(DC_THIS.%s);",    DC->classes[DC->total_classes].member_object_class_name[l], DC->classes[DC->total_classes].member_names[l]);
       // check for any user-defined array ctors (all macros by default) that ought to be invoked
       // to be invoked outside of the brace initialization
-      if(classes[total_classes].member_value_user_ctor[l][0] != 0)
-        sprintf(p, "\\\n\t%s;", classes[total_classes].member_value_user_ctor[l]), p += strlen(p);
+      if(DC->classes[DC->total_classes].member_value_user_ctor[l][0] != 0)
+        sb_printf(ctor_macros, "\\\n\t%s;", DC->classes[DC->total_classes].member_value_user_ctor[l]);
     }
   }
-  sprintf(p, "})"), p += strlen(p);
+  sb_append(ctor_macros, "})");
 
   // add macro for a an array of object constructions
-  sprintf(p, "\n#define DC__%s_ARR(DC_ARR) ({\\\n\
+  sb_printf(ctor_macros, "\n#define DC__%s_ARR(DC_ARR) ({\\\n\
   for(int DC__%s_IDX=0;DC__%s_IDX<(sizeof(DC_ARR)/sizeof(DC_ARR[0]));++DC__%s_IDX)\\\n\
     DC__%s_CTOR(DC_ARR[DC__%s_IDX]);\\\n})", 
     class_name, class_name, class_name, class_name, class_name, class_name);
-  p += strlen(p);
 
   // add macros for arrays of user-defined object construction(s (plural if overloaded))
-  mk_object_array_ctor_macros(p, class_name);
+  mk_object_array_ctor_macros(ctor_macros, class_name);
 }
 
 // make global initializing function to assign default values
-void mk_class_global_initializer(char *class_global_initializer, char *class_name, char *initial_values_brace) {
-  sprintf(class_global_initializer, "\n%s DC__%s_DFLT(){\n\t%s this=%s;\n\treturn this;\n}", 
+static void mk_class_global_initializer(struct string_builder *class_global_initializer, char *class_name, char *initial_values_brace) {
+  sb_printf(class_global_initializer, "\n%s DC__%s_DFLT(){\n\t%s this=%s;\n\treturn this;\n}", 
     class_name, class_name, class_name, initial_values_brace);
 }
 
 // prefixes any user invocations of a "dummy" class constructor w/ "DC__DUMMY_"
-int prefix_dummy_ctor_with_DC__DUMMY_(char *write, char *read) {
+static int prefix_dummy_ctor_with_DC__DUMMY_(struct string_builder *write, char *read) {
   int dummy_ctor_len = 0, in_dummy_args_scope = 1;
   bool in_a_string = false, in_a_char = false, in_token_scope = true;
-  sprintf(write, "DC__DUMMY_");
-  write += strlen(write);
-  while(*read != '(') *write++ = *read++, ++dummy_ctor_len;
-  *write++ = *read++, ++dummy_ctor_len; // copy '('
+  sb_append(write, "DC__DUMMY_");
+  while(*read != '(') sb_putc(write, *read++), ++dummy_ctor_len;
+  sb_putc(write, *read++), ++dummy_ctor_len; // copy '('
   while(*read != '\0' && in_dummy_args_scope > 0) { // copy dummy ctor args
     account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, read);
     if(in_token_scope && *read == '(')      ++in_dummy_args_scope; 
     else if(in_token_scope && *read == ')') --in_dummy_args_scope;
-    *write++ = *read++, ++dummy_ctor_len;
+    sb_putc(write, *read++), ++dummy_ctor_len;
   }
   return dummy_ctor_len;
 }
 
 // append dummy ctor(s) (for either dflt provided or user-def'd) macro(s) to the "default_cd" string
-void mk_dummy_ctor_macros(char *default_cd, char *class_name) {
-  if(classes[total_classes].total_uctors == 0) { 
+static void mk_dummy_ctor_macros(struct string_builder *default_cd, char *class_name) {
+  if(DC->classes[DC->total_classes].total_uctors == 0) { 
     // provide a dummy ctor for the default provided ctor
-    sprintf(default_cd, 
+    sb_printf(default_cd, 
     "\n#define DC__DUMMY_%s()({\\\n\t%s DC__%s__temp;\\\n\tDC__%s_CTOR(DC__%s__temp);\\\n\tDC_%s_(&DC__%s__temp);\\\n})", 
       class_name, class_name, class_name, class_name, class_name, class_name, class_name);
-    default_cd += strlen(default_cd);
   } else { 
 
     // provide a dummy ctor for each instance (overloaded or otherwise) of the user's own defined ctor
-    for(int i = 0, j, number_of_args; i < classes[total_classes].total_uctors; ++i) {
-      number_of_args = classes[total_classes].class_uctor_arg_lengths[i];
+    for(int i = 0, j, number_of_args; i < DC->classes[DC->total_classes].total_uctors; ++i) {
+      number_of_args = DC->classes[DC->total_classes].class_uctor_arg_lengths[i];
       // no-arg dummy ctor
       if(number_of_args == 0) { 
-        sprintf(default_cd, 
+        sb_printf(default_cd, 
           "\n#define DC__DUMMY_%s()({\\\n\t%s DC__%s__temp;\\\n\tDC__%s_CTOR(DC__%s__temp);\\\n\tDC_%s_(&DC__%s__temp);\\\n})", 
           class_name, class_name, class_name, class_name, class_name, class_name, class_name);
       
       // has-arg dummy ctor
       } else {
-        sprintf(default_cd, "\n#define DC__DUMMY_%s(", class_name);
-        default_cd += strlen(default_cd);
+        sb_printf(default_cd, "\n#define DC__DUMMY_%s(", class_name);
         // add "class_uctor_arg_lengths[i]" # of args to dummy uctor macro's arg list
         for(j = 0; j < number_of_args; ++j) {
-          sprintf(default_cd, "DC___D%d_%s", j + 1, class_name), default_cd += strlen(default_cd);
-          if(j < number_of_args - 1) sprintf(default_cd, ", "), default_cd += strlen(default_cd);
+          sb_printf(default_cd, "DC___D%d_%s", j + 1, class_name);
+          if(j < number_of_args - 1) sb_append(default_cd, ", ");
         }
-        sprintf(default_cd, ")({\\\n\t%s DC__%s__temp;\\\n\tDC__%s_CTOR(DC__%s__temp);\\\n\tDC_%s_(", 
+        sb_printf(default_cd, ")({\\\n\t%s DC__%s__temp;\\\n\tDC__%s_CTOR(DC__%s__temp);\\\n\tDC_%s_(", 
           class_name, class_name, class_name, class_name, class_name);
-        default_cd += strlen(default_cd);
         // add "class_uctor_arg_lengths[i]" # of args to the dflt-val assignment & declass.c-generated CTOR object initializer macro
         for(j = 0; j < number_of_args; ++j)
-          sprintf(default_cd, "DC___D%d_%s, ", j + 1, class_name), default_cd += strlen(default_cd);
-        sprintf(default_cd, " &DC__%s__temp);\\\n})", class_name);
+          sb_printf(default_cd, "DC___D%d_%s, ", j + 1, class_name);
+        sb_printf(default_cd, " &DC__%s__temp);\\\n})", class_name);
       }
-      default_cd += strlen(default_cd);
     }
   }
-  *default_cd = '\0';
 }
 
 /******************************************************************************
@@ -1652,7 +4498,7 @@ void mk_dummy_ctor_macros(char *default_cd, char *class_name) {
 // returns whether object declaration is invoking a user-defined constructor
 // & fills the "user_ctor" string w/ the invocation if so
 // USED FOR DECLARATIONS IN METHODS/FCNS
-bool get_user_ctor(char *p, char *user_ctor, char *class_name, bool *is_fcn_returning_obj) {
+static bool get_user_ctor(char *p, char *user_ctor, char *class_name, bool *is_fcn_returning_obj) {
   while(*p != '\0' && no_overlap(*p, "\n(;,=")) ++p;
   if(*p != '(') return false; // object not being constructed via user-defined ctor
   char ctor_vals[MAX_DEFAULT_VALUE_LENGTH]; FLOOD_ZEROS(ctor_vals, MAX_DEFAULT_VALUE_LENGTH);
@@ -1683,29 +4529,46 @@ bool get_user_ctor(char *p, char *user_ctor, char *class_name, bool *is_fcn_retu
   // not a fcn returning an obj, thus whiteout user's ctor args that're being spliced out
   while(whiteout_start != p) *whiteout_start++ = ' ';
   // create user-defined ctor invocation
-  if(objects[total_objects-1].is_class_array) { // invoke ctor for each object in object array declaration
+  if(DC->objects[DC->total_objects-1].is_class_array) { // invoke ctor for each object in object array declaration
     if(strlen(ctor_vals) > 0)
-      sprintf(user_ctor, "DC__%s_UCTOR_ARR(%s, %s);",class_name,objects[total_objects-1].object_name,ctor_vals);
-    else sprintf(user_ctor, "DC__%s_UCTOR_ARR(%s);", class_name, objects[total_objects-1].object_name);
-  } else if(objects[total_objects-1].is_class_pointer) { // invoke ctor for single object declaration
+      sprintf(user_ctor, "DC__%s_UCTOR_ARR(%s, %s);",class_name,DC->objects[DC->total_objects-1].object_name,ctor_vals);
+    else sprintf(user_ctor, "DC__%s_UCTOR_ARR(%s);", class_name, DC->objects[DC->total_objects-1].object_name);
+  } else if(DC->objects[DC->total_objects-1].is_class_pointer) { // invoke ctor for single object declaration
     if(strlen(ctor_vals) > 0)
-      sprintf(user_ctor, "DC_%s_(%s, %s);", class_name, ctor_vals, objects[total_objects-1].object_name);
-    else sprintf(user_ctor, "DC_%s_(%s);", class_name, objects[total_objects-1].object_name);
+      sprintf(user_ctor, "DC_%s_(%s, %s);", class_name, ctor_vals, DC->objects[DC->total_objects-1].object_name);
+    else sprintf(user_ctor, "DC_%s_(%s);", class_name, DC->objects[DC->total_objects-1].object_name);
   } else {                                      // invoke ctor for single object declaration
     if(strlen(ctor_vals) > 0)
-      sprintf(user_ctor, "DC_%s_(%s, &%s);", class_name, ctor_vals, objects[total_objects-1].object_name);
-    else sprintf(user_ctor, "DC_%s_(&%s);", class_name, objects[total_objects-1].object_name);
+      sprintf(user_ctor, "DC_%s_(%s, &%s);", class_name, ctor_vals, DC->objects[DC->total_objects-1].object_name);
+    else sprintf(user_ctor, "DC_%s_(&%s);", class_name, DC->objects[DC->total_objects-1].object_name);
   }
   return true;
 }
 
+// returns the most chars "check_for_ctor_obj" could splice into the class starting at 'class_start':
+// each of its member lines w/ a '(' may hold a ctor, which splices in at most both ctor buffers' lengths
+static long class_ctor_splice_headroom(char *class_start) {
+  char *p = class_start;
+  long ctor_candidates = 0;
+  int in_class_scope = 0;
+  bool in_a_string = false, in_a_char = false, in_token_scope = true;
+  while(*p != '\0' && *p != '{') ++p;
+  for(; *p != '\0'; ++p) {
+    account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, p);
+    if(!in_token_scope) continue;
+    if(*p == '{') ++in_class_scope;
+    else if(*p == '}' && --in_class_scope == 0) break;
+    else if(*p == '(' && in_class_scope == 1) ++ctor_candidates;
+  }
+  return ctor_candidates * MAX_TOKEN_NAME_LENGTH * 3;
+}
+
 // check for a user-defined constructor invocation
 // USED FOR DECLARATIONS IN CLASS PROTOTYPES
-char *check_for_ctor_obj(char*end,char*struct_buff_idx,int*class_size,int*struct_inc,bool*found_ctor){
+static char *check_for_ctor_obj(char*end,struct string_builder*struct_buff,int*class_size,bool*found_ctor){
   char *is_ctor = end;
   bool in_a_string = false, in_a_char = false, in_token_scope = true;
   *found_ctor = false;
-  *struct_inc = 0;
   // from initial '(', traverse the rest of the line & confirm ends w/ ';' not '{'
   while(*is_ctor != '\0' && *is_ctor != '\n') { 
     account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, is_ctor);
@@ -1727,7 +4590,7 @@ char *check_for_ctor_obj(char*end,char*struct_buff_idx,int*class_size,int*struct
     
     *ctored_class_ptr = '\0';
     // if at "immortal" prefix: empty "ctored_class" & re-scrape the class name again but AFTER the keyword
-    if(*IMMORTALITY && strcmp(ctored_class, "immortal") == 0) { 
+    if(*DC->IMMORTALITY && strcmp(ctored_class, "immortal") == 0) { 
       FLOOD_ZEROS(ctored_class, MAX_TOKEN_NAME_LENGTH); 
       ctored_class_ptr = ctored_class;
       while(!VARCHAR(*ctoring_invokers)) ++ctoring_invokers; // skip space between "immortal" & class name
@@ -1778,12 +4641,9 @@ char *check_for_ctor_obj(char*end,char*struct_buff_idx,int*class_size,int*struct
     char *LAST_ARG = check_no_ctor_args, *FIRST_ARG = end;
     
     // confirm class of object with default ctor value exists
-    int is_a_defined_class = 0;
-    for(; is_a_defined_class < total_classes + 1; ++is_a_defined_class)
-      if(strcmp(ctored_class, classes[is_a_defined_class].class_name) == 0) break;
-    if(is_a_defined_class == total_classes + 1) {
-      fprintf(stderr, "\033[1mdeclass.c: \033[33mWARNING\033[0m\033[1m UNDEFINED BEHAVIOR IN FCN: \"%s\", LINE: %d\033[0m\n", __func__, __LINE__);
-      fprintf(stderr, " >> EXPECTED OBJECT CTOR FOR MEMBER: \"%s\" IN CLASS: \"%s\"\n", ctored_obj, ctored_class);
+    if(class_named(ctored_class, strlen(ctored_class), DC->total_classes + 1) == -1) {
+      fprintf(DC_STDERR, "\033[1mdeclass.c: \033[33mWARNING\033[0m\033[1m UNDEFINED BEHAVIOR IN FCN: \"%s\", LINE: %d\033[0m\n", __func__, __LINE__);
+      fprintf(DC_STDERR, " >> EXPECTED OBJECT CTOR FOR MEMBER: \"%s\" IN CLASS: \"%s\"\n", ctored_obj, ctored_class);
       ask_user_whether_to_quit_or_continue_declassification();
       return end;
     }
@@ -1792,17 +4652,13 @@ char *check_for_ctor_obj(char*end,char*struct_buff_idx,int*class_size,int*struct
     char *ctor_fcn_assign_ptr = ctor_fcn_assignment, *ctor_append_ptr = appended_ctor_object;
     int ctor_fcn_assign_len   = strlen(ctor_fcn_assignment);
     int ctor_appened_arg_len  = strlen(appended_ctor_object);
-    char *endOfFile = end + strlen(end) + ctor_fcn_assign_len; // end of the file + fcnal ctor assign length
-    *(endOfFile + 1) = '\0';
 
-    // shift file up then splice in functional ctor invocation by assignment
-    // "+ 1" to also shift over the 1st '(' preceding ctor's args
-    while(endOfFile - ctor_fcn_assign_len + 1 != end) { 
-      *endOfFile = *(endOfFile - ctor_fcn_assign_len); --endOfFile;
-    }
+    // shift file up (main reserved room past its end) then splice in functional ctor invocation by assignment
+    // also shifts over the 1st '(' preceding ctor's args
+    memmove(end + ctor_fcn_assign_len, end, strlen(end) + 1);
     while(*ctor_fcn_assign_ptr != '\0') { // splice in ctor invocation
       *end++ = *ctor_fcn_assign_ptr, *class_size += 1;
-      *struct_buff_idx++ = *ctor_fcn_assign_ptr++, *struct_inc += 1;
+      sb_putc(struct_buff, *ctor_fcn_assign_ptr++);
     }
 
     // skip to where ought to splice in last "&DC_THIS.objName" ctor arg
@@ -1810,17 +4666,14 @@ char *check_for_ctor_obj(char*end,char*struct_buff_idx,int*class_size,int*struct
     // as whether is/isn't an object array ctor
     char *arg_position = (array_ctor) ? FIRST_ARG : LAST_ARG;
     while(end != arg_position + ctor_fcn_assign_len + 1) 
-      *struct_buff_idx++ = *end++, *class_size += 1, *struct_inc += 1;
-    endOfFile = end + strlen(end) + ctor_appened_arg_len; // end of the file + appended last arg
+      sb_putc(struct_buff, *end++), *class_size += 1;
 
     // shift file up then splice in last "&DC_THIS.objName" ctor arg
-    // + 1 to also shift over char currently in last arg's position to make room for splicing in "&DC_THIS.objName"
-    while(endOfFile - ctor_appened_arg_len + 1 != end) { 
-      *endOfFile = *(endOfFile - ctor_appened_arg_len); --endOfFile;
-    }
+    // also shifts over char currently in last arg's position to make room for splicing in "&DC_THIS.objName"
+    memmove(end + ctor_appened_arg_len, end, strlen(end) + 1);
     while(*ctor_append_ptr != '\0') { // splice in ctor's last "&DC_THIS.objName" arg
       *end++ = *ctor_append_ptr, *class_size += 1;
-      *struct_buff_idx++ = *ctor_append_ptr++, *struct_inc += 1;
+      sb_putc(struct_buff, *ctor_append_ptr++);
     }
   }
   return end;
@@ -1831,74 +4684,198 @@ char *check_for_ctor_obj(char*end,char*struct_buff_idx,int*class_size,int*struct
 ******************************************************************************/
 
 // fills 'dtor_array_macro' w/ macro for array object destruction via user's own defined dtor
-void mk_dtor_array_macro(char dtor_array_macro[], char *class_name) {
-  // sprintf loop to iterate over object array's individual objects to be dtor'd
-  sprintf(dtor_array_macro, "#define DC__%s_UDTOR_ARR(DC_ARR) ({\\\n\
+static void mk_dtor_array_macro(struct string_builder *dtor_array_macro, char *class_name) {
+  // append loop to iterate over object array's individual objects to be dtor'd
+  sb_printf(dtor_array_macro, "#define DC__%s_UDTOR_ARR(DC_ARR) ({\\\n\
   for(int DC__%s_UDTOR_IDX=0;DC__%s_UDTOR_IDX<(sizeof(DC_ARR)/sizeof(DC_ARR[0]));\
 ++DC__%s_UDTOR_IDX)\\\n\t\tif(DC_ARR[DC__%s_UDTOR_IDX].DC_DTR){DC__NOT_%s_(&DC_ARR[DC__%s_UDTOR_IDX]);DC_ARR[DC__%s_UDTOR_IDX].DC_DTR=NULL;}\\\n})",
   class_name, class_name, class_name, class_name, class_name, class_name, class_name, class_name);
 }
 
+/******************************************************************************
+* "pooled" CLASS OBJECT POOL CREATION FUNCTIONS
+******************************************************************************/
+
+// returns whether the class declared at 's' is tagged "pooled" btwn its name & '{' (ie "class cName pooled {")
+static bool class_is_pooled(char *s) {
+  char *p = s + strlen("class");
+  while(*p != '\0' && !VARCHAR(*p)) ++p; // skip to class name
+  while(VARCHAR(*p)) ++p;                 // skip class name
+  for(; *p != '\0' && *p != '{'; ++p)
+    if(is_at_substring(p, "pooled") && !VARCHAR(*(p-1)) && !VARCHAR(*(p + strlen("pooled")))) return true;
+  return false;
+}
+
+// registers "cName_pool_new" as an alloc fcn so its objs get dflt vals & dtor flags like any other
+static void register_class_pool_alloc_fcn(char *class_name) {
+  reserve_class_tables(0, 0, 1);
+  sprintf(DC->ALLOC_FCNS[DC->TOTAL_ALLOC_FCNS++], "%s_pool_new", class_name);
+}
+
+// declares a "pooled" class' pool fcns ahead of its methods, & aliases them to the user-facing
+// "cName_pool_new()" (an alloc fcn) & "cName_pool_del(objPtr)" (dtors & NULLs "objPtr" like "~objPtr();").
+// pools are static (inline, so unused ones go unwarned): each translation unit (IE each includer of a
+// "--split-headers" header) has its own
+static void mk_class_pool_decls(struct string_builder *pool_decls, char *class_name) {
+  sb_printf(pool_decls, "\nstatic inline %s *DC__%s_POOL_NEW();\nstatic inline void DC__%s_POOL_DEL(%s *this);", class_name, class_name, class_name, class_name);
+  sb_printf(pool_decls, "\n#define %s_pool_new DC__%s_POOL_NEW", class_name, class_name);
+  sb_printf(pool_decls, "\n#define %s_pool_del(DC_PTR) ({DC__%s_POOL_DEL(DC_PTR);DC_PTR=NULL;})", class_name, class_name);
+}
+
+// defines a "pooled" class' fixed-size obj pool: a free list of cells carved from 64-byte (cache-line)
+// aligned slabs of ~4KB, each slab registered by "smrtptr()" (bypassing any arena) to be freed atexit
+static void mk_class_pool_fcns(struct string_builder *pool_fcns, char *class_name) {
+  sb_printf(pool_fcns, "\ntypedef struct DC__%s_POOL_CELL {%s DC_OBJ; struct DC__%s_POOL_CELL *DC_NEXT;} DC__%s_POOL_CELL;", 
+    class_name, class_name, class_name, class_name);
+  sb_printf(pool_fcns, "\nstatic %sDC__%s_POOL_CELL *DC__%s_POOL_FREE = NULL;", DC->THREADSAFE_SMRTPTR ? "__thread " : "", class_name, class_name);
+  sb_printf(pool_fcns, "\nstatic inline %s *DC__%s_POOL_NEW() {\n\tDC__%s_POOL_CELL *DC_CELL = DC__%s_POOL_FREE;\n\tif(!DC_CELL) {", 
+    class_name, class_name, class_name, class_name);
+  sb_printf(pool_fcns, "\n\t\tlong DC_CELLS = 4096 / sizeof(DC__%s_POOL_CELL), DC_IDX;\n\t\tif(DC_CELLS < 1) DC_CELLS = 1;", class_name);
+  sb_printf(pool_fcns, "\n\t\tchar *DC_SLAB = malloc(DC_CELLS * sizeof(DC__%s_POOL_CELL) + 63);\n\t\tif(!DC_SLAB) return NULL;", class_name);
+  if(*DC->SMRT_PTRS) sb_append(pool_fcns, "\n\t\tsmrtptr(DC_SLAB);");
+  sb_printf(pool_fcns, "\n\t\tDC_CELL = (DC__%s_POOL_CELL *)(DC_SLAB + (64 - (unsigned long)DC_SLAB %% 64) %% 64);", class_name);
+  sb_append(pool_fcns, "\n\t\tfor(DC_IDX = 0; DC_IDX < DC_CELLS - 1; ++DC_IDX) DC_CELL[DC_IDX].DC_NEXT = &DC_CELL[DC_IDX + 1];");
+  sb_append(pool_fcns, "\n\t\tDC_CELL[DC_CELLS - 1].DC_NEXT = NULL;\n\t}");
+  sb_printf(pool_fcns, "\n\tDC__%s_POOL_FREE = DC_CELL->DC_NEXT;\n\treturn &DC_CELL->DC_OBJ;\n}", class_name);
+  sb_printf(pool_fcns, "\nstatic inline void DC__%s_POOL_DEL(%s *this) {\n\tif(!this) return;\n\tif(this->DC_DTR) DC__NOT_%s_(this);", 
+    class_name, class_name, class_name);
+  sb_printf(pool_fcns, "\n\tthis->DC_DTR = NULL;\n\t((DC__%s_POOL_CELL *)this)->DC_NEXT = DC__%s_POOL_FREE;", class_name, class_name);
+  sb_printf(pool_fcns, "\n\tDC__%s_POOL_FREE = (DC__%s_POOL_CELL *)this;\n}", class_name, class_name);
+}
+
 /******************************************************************************
 * USER-DEFINED OBJECT DESTRUCTOR (DTOR) PARSING & SPLICING FUNCTIONS
 ******************************************************************************/
 
-// shifts up buffer to "splice_here"'s position in order to splice in a dtor
-int shiftSplice_dtor_in_buffer(char *dtor, char *splice_here, bool redefined) {
-  // check whether object already dtored (prevents redundant dtors,
-  // generally occurs when user explicitly invokes a dtor then declass.c 
-  // to splice in one at the end of the scope)
+// returns idx of the 1st deferred dtor splice at "offset" (or past it if "past_offset")
+static int dtor_splice_bound(long offset, bool past_offset) {
+  int lo = 0, hi = DC->total_dtor_splices;
+  while(lo < hi) {
+    int mid = (lo + hi) / 2;
+    if(DC->DTOR_SPLICES[mid].offset < offset || (past_offset && DC->DTOR_SPLICES[mid].offset == offset)) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+// returns whether deferred splice "k" starts w/ "dtor" & isn't followed by a "return"
+static bool dtor_splice_matches(int k, char *dtor) {
+  if(!is_at_substring(DC->DTOR_SPLICES[k].dtor, dtor)) return false;
+  char *after_dtor = DC->DTOR_SPLICES[k].dtor + strlen(dtor);
+  if(*after_dtor == '\0') // followed by either the next splice at the same position or the buffer itself
+    after_dtor = (k + 1 < DC->total_dtor_splices && DC->DTOR_SPLICES[k + 1].offset == DC->DTOR_SPLICES[k].offset) 
+      ? DC->DTOR_SPLICES[k + 1].dtor : DC->DTOR_SPLICE_BUFFER + DC->DTOR_SPLICES[k].offset;
+  return !is_at_substring(after_dtor, "return");
+}
+
+// returns whether "dtor" is already deferred to be spliced in just before "p" is read
+static bool dtor_spliced_at(char *p, char *dtor) {
+  long offset = p - DC->DTOR_SPLICE_BUFFER;
+  for(int k = dtor_splice_bound(offset, false); k < DC->total_dtor_splices && DC->DTOR_SPLICES[k].offset == offset; ++k)
+    if(is_at_substring(DC->DTOR_SPLICES[k].dtor, dtor)) return true;
+  return false;
+}
+
+// check whether object already dtored (prevents redundant dtors, generally occurs 
+// when user explicitly invokes a dtor then declass.c to splice in one at the end of the scope)
+static bool dtor_already_in_scope(char *dtor, char *splice_here, bool ahead_of_splices) {
   int current_scope = 1;
+  long offset = splice_here - DC->DTOR_SPLICE_BUFFER;
+  int k = dtor_splice_bound(offset, !ahead_of_splices) - 1; // newest splice read prior "dtor"
   char *check_ifdef_already = splice_here;
   bool in_a_string = false, in_a_char = false, in_token_scope = true;
-  while(current_scope > 0 && !redefined) { // doesn't matter if dtor already in scope if object newly redefined
+  // when spliced ahead of other splices at "splice_here", the 1st of them is what follows "dtor"
+  if(ahead_of_splices && k + 1 < DC->total_dtor_splices && DC->DTOR_SPLICES[k + 1].offset == offset) {
+    if(dtor_splice_matches(k + 1, dtor)) return true;
+    --check_ifdef_already;
+  }
+  while(current_scope > 0 && k >= 0 && check_ifdef_already >= DC->DTOR_SPLICE_BUFFER) {
     account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, check_ifdef_already);
     if(in_token_scope) {
       if(*check_ifdef_already == '{')      --current_scope;
       else if(*check_ifdef_already == '}') ++current_scope;
       if(current_scope <= 0) break;
-      // check if dtor already defined in scope & not prior to a return 
-      // (return shouldn't play a factor if returning from the same scope but just in case)
-      if(current_scope == 1 && is_at_substring(check_ifdef_already, dtor)
-        && !is_at_substring(check_ifdef_already + strlen(dtor), "return"))
-        return 1; // returns 1 to get past '}' or 'r'eturn
     }
+    // check if dtor already defined in scope & not prior to a return 
+    // (return shouldn't play a factor if returning from the same scope but just in case)
+    for(; k >= 0 && DC->DTOR_SPLICES[k].offset == check_ifdef_already - DC->DTOR_SPLICE_BUFFER; --k)
+      if(current_scope == 1 && dtor_splice_matches(k, dtor)) return true;
     --check_ifdef_already;
   }
-  // if a redundant/duplicate DTOR, return 1 to get past '}' or 'r'eturn
-  if(is_at_substring(splice_here - strlen(dtor), dtor)) return 1; 
+  return false;
+}
+
+// defers splicing "dtor" into the buffer being read until the parser reads up to "splice_here":
+// rather than shifting up the rest of the buffer, the dtor is written out by "emit_dtor_splices()".
+// "ahead_of_splices" places "dtor" before any other dtors already at "splice_here" (else after them),
+// returns whether "dtor" was spliced (false if redundant/already in scope)
+static bool defer_dtor_splice(char *dtor, char *splice_here, bool redefined, bool ahead_of_splices) {
+  if(*dtor == '\0') return false;
+  // doesn't matter if dtor already in scope if object newly redefined
+  if(!redefined && dtor_already_in_scope(dtor, splice_here, ahead_of_splices)) return false;
+  long offset = splice_here - DC->DTOR_SPLICE_BUFFER;
+  int splice_idx = dtor_splice_bound(offset, !ahead_of_splices);
+  // if a redundant/duplicate DTOR immediately prior "splice_here"
+  if(splice_idx > 0 && DC->DTOR_SPLICES[splice_idx - 1].offset == offset) {
+    char *prior_dtor = DC->DTOR_SPLICES[splice_idx - 1].dtor;
+    int prior_len = strlen(prior_dtor), dtor_len = strlen(dtor);
+    if(prior_len >= dtor_len && strcmp(prior_dtor + prior_len - dtor_len, dtor) == 0) return false;
+  }
+  if(DC->total_dtor_splices == DC->max_dtor_splices) { // grow splice list geometrically
+    DC->max_dtor_splices = (DC->max_dtor_splices == 0) ? 64 : DC->max_dtor_splices * 2;
+    DC->DTOR_SPLICES = realloc(DC->DTOR_SPLICES, sizeof(struct dtor_splice) * DC->max_dtor_splices);
+    if(DC->DTOR_SPLICES == NULL) {
+      fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR DTOR SPLICES!\033[0m\n\n", __LINE__);
+      declass_exit(EXIT_FAILURE);
+    }
+  }
+  // keep splices sorted by offset (new splices are always ahead of the parser, thus near the list's end)
+  memmove(&DC->DTOR_SPLICES[splice_idx + 1], &DC->DTOR_SPLICES[splice_idx], sizeof(struct dtor_splice) * (DC->total_dtor_splices - splice_idx));
+  DC->DTOR_SPLICES[splice_idx].offset = offset;
+  DC->DTOR_SPLICES[splice_idx].dtor = malloc(strlen(dtor) + 1);
+  if(DC->DTOR_SPLICES[splice_idx].dtor == NULL) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR DTOR SPLICES!\033[0m\n\n", __LINE__);
+    declass_exit(EXIT_FAILURE);
+  }
+  strcpy(DC->DTOR_SPLICES[splice_idx].dtor, dtor);
+  ++DC->total_dtor_splices;
+  return true;
+}
 
-  // splice in dtor if not already defined in scope at the current position
-  char temp[MAX_FILESIZE];
-  FLOOD_ZEROS(temp, MAX_FILESIZE);
-  sprintf(temp, "%s%s", dtor, splice_here); // sprintf in dtor + buffer after scope ending
+// appends all deferred dtors to be spliced in prior "read" to "write"
+static void emit_dtor_splices(char *read, struct string_builder *write) {
+  long offset = read - DC->DTOR_SPLICE_BUFFER;
+  while(DC->next_dtor_splice < DC->total_dtor_splices && DC->DTOR_SPLICES[DC->next_dtor_splice].offset <= offset)
+    sb_append(write, DC->DTOR_SPLICES[DC->next_dtor_splice++].dtor);
+}
 
-  int length = strlen(splice_here);
-  FLOOD_ZEROS(splice_here, length); // wipe buffer after out-of-scope
-  sprintf(splice_here, "%s", temp); // splice in "dtor" + rest of "temp" buffer of string out of scope
-  return strlen(dtor) + 1;          // to get past '}' or "return"
+// returns 'stop', or where the next deferred dtor is spliced in if before it (to be written out there 1st)
+static char *before_next_dtor_splice(char *stop) {
+  if(DC->next_dtor_splice < DC->total_dtor_splices && DC->DTOR_SPLICE_BUFFER + DC->DTOR_SPLICES[DC->next_dtor_splice].offset < stop)
+    return DC->DTOR_SPLICE_BUFFER + DC->DTOR_SPLICES[DC->next_dtor_splice].offset;
+  return stop;
 }
 
 // checks whether returned item is the object in question (thus don't invoke class' dtor)
-bool object_is_returned(char *returnedItem) {
+static bool object_is_returned(char *returnedItem) {
   while(VARCHAR(*returnedItem))       ++returnedItem; // skip "return"
   while(IS_WHITESPACE(*returnedItem)) ++returnedItem; // skip space after "return" keyword
   if(*returnedItem == '*')            ++returnedItem; // skip over dereferencing operator
-  return (is_at_substring(returnedItem, objects[total_objects-1].object_name) 
-    && !VARCHAR(*(returnedItem+strlen(objects[total_objects-1].object_name))));
+  return (is_at_substring(returnedItem, DC->objects[DC->total_objects-1].object_name) 
+    && !VARCHAR(*(returnedItem+strlen(DC->objects[DC->total_objects-1].object_name))));
 }
 
 // searches for objects in the "?:" return condition results
 // "cond_idx" returns idx of object if found, & cond_idx = total_objects if not found
-void get_if_else_object_idxs(char *return_cond, int *cond_idx) {
-  for(*cond_idx = 0; *cond_idx < total_objects; *cond_idx += 1) {
+static void get_if_else_object_idxs(char *return_cond, int *cond_idx) {
+  for(*cond_idx = 0; *cond_idx < DC->total_objects; *cond_idx += 1) {
     char *find_obj = return_cond;
     while(*find_obj != '\0') {
-      if(is_at_substring(find_obj, objects[*cond_idx].object_name)
+      if(is_at_substring(find_obj, DC->objects[*cond_idx].object_name)
         && (find_obj == return_cond || !VARCHAR(*(find_obj-1))) 
-        && !VARCHAR(*(find_obj+strlen(objects[*cond_idx].object_name)))) {
+        && !VARCHAR(*(find_obj+strlen(DC->objects[*cond_idx].object_name)))) {
         // trigger invalid-object in calling function IF obj = immortal (all args default to immortal)
-        if(objects[*cond_idx].is_immortal) *cond_idx = total_objects;
+        if(DC->objects[*cond_idx].is_immortal) *cond_idx = DC->total_objects;
         return;
       }
      ++find_obj;
@@ -1907,22 +4884,26 @@ void get_if_else_object_idxs(char *return_cond, int *cond_idx) {
 }
 
 // returns whether "dtor condition" for when handling "?:" one-line conditionals has been spliced in earlier already
-bool unique_dtor_condition(char *returnFrom, char *dtor_condition) {
-  // if "max_iter" is hit some joker is writing their entire class without pressing "return",
-  // if that joker is you I sincerely hope the thought of undefined behavior gets you jazzed up because
-  // lord almighty if so you're in for quite a treat when your compiler gets a stroke trying to run this
-  int iterations = 0, max_iter = strlen(dtor_condition) * 4 + 10; 
-  while(*returnFrom != '\n' && iterations-- < max_iter) {
-    if(is_at_substring(returnFrom, dtor_condition)) return false; // don't splice in redundant dtor conditions
+static bool unique_dtor_condition(char *returnFrom, char *dtor_condition) {
+  // search back along the line, through the raw buffer & any dtors spliced into it
+  int k = dtor_splice_bound(returnFrom - DC->DTOR_SPLICE_BUFFER, true) - 1;
+  while(returnFrom >= DC->DTOR_SPLICE_BUFFER && *returnFrom != '\n') {
+    for(; k >= 0 && DC->DTOR_SPLICES[k].offset == returnFrom - DC->DTOR_SPLICE_BUFFER; --k) {
+      char *line_start = strrchr(DC->DTOR_SPLICES[k].dtor, '\n');
+      line_start = (line_start == NULL) ? DC->DTOR_SPLICES[k].dtor : line_start + 1;
+      if(strstr(line_start, dtor_condition) != NULL) return false; // don't splice in redundant dtor conditions
+      if(line_start != DC->DTOR_SPLICES[k].dtor) return true;          // splice ends a line
+    }
     --returnFrom;
   }
   return true;
 }
 
-// checks for "?:" conditional returning 2 different objects to determine which (if any) to dtor
-int one_line_conditional(char *cond, bool redefined) {
+// checks for "?:" conditional returning 2 different objects to determine which (if any) to dtor,
+// returns # of dtor conditions spliced in
+static int one_line_conditional(char *cond, bool redefined) {
   char *splice_here = cond;
-  int shift_total = 0;
+  int total_spliced = 0;
   while(VARCHAR(*cond)) ++cond; // skip "return"
   char condition[MAX_TOKEN_NAME_LENGTH * 2], return_if[MAX_TOKEN_NAME_LENGTH * 2];
   char return_else[MAX_TOKEN_NAME_LENGTH * 2], else_dtor[MAX_TOKEN_NAME_LENGTH * 2], if_dtor[MAX_TOKEN_NAME_LENGTH * 2];
@@ -1948,40 +4929,38 @@ int one_line_conditional(char *cond, bool redefined) {
     int if_idx = 0, else_idx = 0;
     get_if_else_object_idxs(return_if, &if_idx);
     get_if_else_object_idxs(return_else, &else_idx);
-    if(if_idx == total_objects && else_idx == total_objects) return 0; // no non-pointer mortal objects returned
+    if(if_idx == DC->total_objects && else_idx == DC->total_objects) return 0; // no non-pointer mortal objects returned
     // splice in reverse conditions invoking appropriate object destructors if object not being returned
-    if(if_idx < total_objects) { 
-      if(objects[if_idx].is_class_array)
+    if(if_idx < DC->total_objects) { 
+      if(DC->objects[if_idx].is_class_array)
         sprintf(if_dtor, "if(!(%s)){DC__%s_UDTOR_ARR(%s);}", 
-          condition, objects[if_idx].class_name, objects[if_idx].object_name);
-      else if(objects[if_idx].is_class_pointer) 
+          condition, DC->objects[if_idx].class_name, DC->objects[if_idx].object_name);
+      else if(DC->objects[if_idx].is_class_pointer) 
         sprintf(if_dtor, "if(!(%s)){DC__NOT_%s_(%s);}", 
-          condition, objects[if_idx].class_name, objects[if_idx].object_name);
+          condition, DC->objects[if_idx].class_name, DC->objects[if_idx].object_name);
       else sprintf(if_dtor, "if(!(%s)){DC__NOT_%s_(&%s);}", 
-            condition, objects[if_idx].class_name, objects[if_idx].object_name);
-      if(unique_dtor_condition(splice_here, if_dtor)) { // only splice in dtor conditional if not done so already
-        shift_total += (shiftSplice_dtor_in_buffer(if_dtor, splice_here, redefined) - 1);
-        splice_here += shift_total;
-      }
+            condition, DC->objects[if_idx].class_name, DC->objects[if_idx].object_name);
+      if(unique_dtor_condition(splice_here, if_dtor)) // only splice in dtor conditional if not done so already
+        total_spliced += defer_dtor_splice(if_dtor, splice_here, redefined, false);
     }
-    if(else_idx < total_objects) { 
-      if(objects[else_idx].is_class_array)
+    if(else_idx < DC->total_objects) { 
+      if(DC->objects[else_idx].is_class_array)
         sprintf(else_dtor, "if(%s){DC__%s_UDTOR_ARR(%s);}", 
-          condition, objects[else_idx].class_name, objects[else_idx].object_name);
-      else if(objects[else_idx].is_class_pointer) 
+          condition, DC->objects[else_idx].class_name, DC->objects[else_idx].object_name);
+      else if(DC->objects[else_idx].is_class_pointer) 
         sprintf(else_dtor, "if(%s){DC__NOT_%s_(%s);}", 
-          condition, objects[else_idx].class_name, objects[else_idx].object_name);
+          condition, DC->objects[else_idx].class_name, DC->objects[else_idx].object_name);
       else sprintf(else_dtor, "if(%s){DC__NOT_%s_(&%s);}", 
-            condition, objects[else_idx].class_name, objects[else_idx].object_name);
+            condition, DC->objects[else_idx].class_name, DC->objects[else_idx].object_name);
       if(unique_dtor_condition(splice_here, else_dtor)) // only splice in dtor conditional if not done so already
-        shift_total += (shiftSplice_dtor_in_buffer(else_dtor, splice_here, redefined) - 1);
+        total_spliced += defer_dtor_splice(else_dtor, splice_here, redefined, false);
     }
   }
-  return shift_total;
+  return total_spliced;
 }
 
 // don't add a dtor prior a '}' brace immdiately following a "return"
-int return_then_immediate_exit(char *immediate_exit) {
+static int return_then_immediate_exit(char *immediate_exit) {
   int increment = 0;
   while(*immediate_exit != '\0' && *immediate_exit != ';') ++immediate_exit, ++increment; // skip up to ';'
   ++immediate_exit, ++increment;                                                          // skip past ';'
@@ -1989,16 +4968,16 @@ int return_then_immediate_exit(char *immediate_exit) {
   return (*immediate_exit == '}') ? (increment + 1) : 0;                                  // "+1" to skip past '}'
 }
 
-// splices object dtor (once object created) into buffer being READ from (picked up later on)
-void add_object_dtor(char *splice_here, bool object_being_assigned, bool redefined) {
-  if(!objects[total_objects-1].class_has_dtor) return;
+// splices object dtor (once object created) into buffer being READ from (picked up later on, see "defer_dtor_splice()")
+static void add_object_dtor(char *splice_here, bool object_being_assigned, bool redefined) {
+  if(!DC->objects[DC->total_objects-1].class_has_dtor) return;
   bool in_a_string = false, in_a_char = false, in_token_scope = true;
   // immortal objects can only be explicitly dtor'd by user
-  bool immortal_object = objects[total_objects-1].is_immortal;
-  bool object_pointer = objects[total_objects-1].is_class_pointer;
-  bool object_alloced_ptr = objects[total_objects-1].is_alloced_class_pointer;
-  bool object_dangling_ctord_ptr = objects[total_objects-1].is_dangling_ctord_ptr;
-  bool object_array = objects[total_objects-1].is_class_array;
+  bool immortal_object = DC->objects[DC->total_objects-1].is_immortal;
+  bool object_pointer = DC->objects[DC->total_objects-1].is_class_pointer;
+  bool object_alloced_ptr = DC->objects[DC->total_objects-1].is_alloced_class_pointer;
+  bool object_dangling_ctord_ptr = DC->objects[DC->total_objects-1].is_dangling_ctord_ptr;
+  bool object_array = DC->objects[DC->total_objects-1].is_class_array;
   int in_scope = 0;
   char dtor[1000];
   FLOOD_ZEROS(dtor, 1000);
@@ -2018,28 +4997,32 @@ void add_object_dtor(char *splice_here, bool object_being_assigned, bool redefin
   // >> Thus ONLY flag non-allocated, non-assigned, & non-ctor'd ptrs here as initially being NULL, 
   //    & flag non-ctor'd ptrs' dflt "DC_DTR" member after being ctor'd (if they aren't NULL)
   if(!redefined && object_pointer && !object_alloced_ptr && !object_being_assigned && !object_dangling_ctord_ptr) {
-    sprintf(dtor_flag, " %s=NULL;", objects[total_objects-1].object_name);
+    sprintf(dtor_flag, " %s=NULL;", DC->objects[DC->total_objects-1].object_name);
   // if a ptr thats ctord but not allocated (allocated version of this taken care of in middle of "main()" & near bot of "parse_class()"")
   } else if(!redefined && object_pointer && object_dangling_ctord_ptr) {
-    sprintf(dtor_flag, " if(%s){%s->DC_DTR=&DC__NDTR;}", objects[total_objects-1].object_name, objects[total_objects-1].object_name);
+    sprintf(dtor_flag, " if(%s){%s->DC_DTR=&DC__NDTR;}", DC->objects[DC->total_objects-1].object_name, DC->objects[DC->total_objects-1].object_name);
   // non-array && non-ptr
   } else if(!redefined && !object_array && !object_pointer) {
-    sprintf(dtor_flag, " %s.DC_DTR=&DC__NDTR;", objects[total_objects-1].object_name);
+    sprintf(dtor_flag, " %s.DC_DTR=&DC__NDTR;", DC->objects[DC->total_objects-1].object_name);
   }
-  splice_here += shiftSplice_dtor_in_buffer(dtor_flag, splice_here, redefined);
+  defer_dtor_splice(dtor_flag, splice_here, redefined, true);
+  ++splice_here;
+  char *scope_start = splice_here;
 
   // determine which type of destructor to splice in (single, ptr, or array (array's indiv cells have their flags checked in the macro))
   if(object_array)
-    sprintf(dtor, "DC__%s_UDTOR_ARR(%s);\n", objects[total_objects-1].class_name, objects[total_objects-1].object_name);
+    sprintf(dtor, "DC__%s_UDTOR_ARR(%s);\n", DC->objects[DC->total_objects-1].class_name, DC->objects[DC->total_objects-1].object_name);
   else if(object_pointer) // "dangling" ptrs can't access members, thus dtors the entire ptr as NULL
-    sprintf(dtor, "if(%s&&%s->DC_DTR){DC__NOT_%s_(%s);%s=NULL;}\n", objects[total_objects-1].object_name, objects[total_objects-1].object_name,
-      objects[total_objects-1].class_name, objects[total_objects-1].object_name, objects[total_objects-1].object_name);
+    sprintf(dtor, "if(%s&&%s->DC_DTR){DC__NOT_%s_(%s);%s=NULL;}\n", DC->objects[DC->total_objects-1].object_name, DC->objects[DC->total_objects-1].object_name,
+      DC->objects[DC->total_objects-1].class_name, DC->objects[DC->total_objects-1].object_name, DC->objects[DC->total_objects-1].object_name);
   else 
-    sprintf(dtor, "if(%s.DC_DTR){DC__NOT_%s_(&%s);%s.DC_DTR=NULL;}\n", objects[total_objects-1].object_name,
-      objects[total_objects-1].class_name, objects[total_objects-1].object_name, objects[total_objects-1].object_name);
+    sprintf(dtor, "if(%s.DC_DTR){DC__NOT_%s_(&%s);%s.DC_DTR=NULL;}\n", DC->objects[DC->total_objects-1].object_name,
+      DC->objects[DC->total_objects-1].class_name, DC->objects[DC->total_objects-1].object_name, DC->objects[DC->total_objects-1].object_name);
 
   // find where current scope ends
   while(*splice_here != '\0' && in_scope >= 0) {
+    // no need to dtor if already in EXACT same scope as declaration
+    if(splice_here != scope_start && in_scope == 0 && dtor_spliced_at(splice_here, dtor)) return;
     account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, splice_here);
     // check whether entering/exiting a scope
     if(in_token_scope) {
@@ -2047,42 +5030,43 @@ void add_object_dtor(char *splice_here, bool object_being_assigned, bool redefin
       else if(*splice_here == '}') {
         --in_scope;
         if(in_scope < 0) {
-          if(!immortal_object) shiftSplice_dtor_in_buffer(dtor, splice_here, redefined);
+          if(!immortal_object) defer_dtor_splice(dtor, splice_here, redefined, false);
           return;
         }
       } else if(is_at_substring(splice_here,"return") && !immortal_object
         && !VARCHAR(*(splice_here-1)) && !VARCHAR(*(splice_here+strlen("return")))) {
         // if !*DTOR_RETURN, splice in dtors as needed if return case: "return (condition) ? object1 : object 2;"
-        int one_line_cond = (*DTOR_RETURN) ? 0 : one_line_conditional(splice_here, redefined);
+        int one_line_cond = (*DC->DTOR_RETURN) ? 0 : one_line_conditional(splice_here, redefined);
         if(one_line_cond > 0) {
-          splice_here += one_line_cond;
           int immediate_exit = return_then_immediate_exit(splice_here);
           if(immediate_exit > 0) { --in_scope; if(in_scope < 0) return; splice_here += immediate_exit; }
           ++splice_here;
           continue;
         }
         // if !*DTOR_RETURN, don't dtor an object being returned
-        if(!(*DTOR_RETURN) && object_is_returned(splice_here)) { 
+        if(!(*DC->DTOR_RETURN) && object_is_returned(splice_here)) { 
           int immediate_exit = return_then_immediate_exit(splice_here);
           if(immediate_exit > 0) { --in_scope; if(in_scope < 0) return; splice_here += immediate_exit; }
           ++splice_here; 
           continue; 
         } 
         // splice in DTOR prior to "return", NOT changing scope status
-        splice_here += shiftSplice_dtor_in_buffer(dtor, splice_here, redefined);
+        defer_dtor_splice(dtor, splice_here, redefined, false);
+        ++splice_here;
         // don't add a redundant dtor prior a '}' brace immediately following a "return"
         int immediate_exit = return_then_immediate_exit(splice_here);
         if(immediate_exit > 0) { --in_scope; if(in_scope < 0) return; splice_here += immediate_exit; }
       } else if(*splice_here == '~') { // check is user explicitly invoked destructor, ie: "~objName();"
-        if(is_at_substring(splice_here + 1, objects[total_objects-1].object_name)
-          && !VARCHAR(*(splice_here + 1 + strlen(objects[total_objects-1].object_name)))) { // user destroyed obj
+        if(is_at_substring(splice_here + 1, DC->objects[DC->total_objects-1].object_name)
+          && !VARCHAR(*(splice_here + 1 + strlen(DC->objects[DC->total_objects-1].object_name)))) { // user destroyed obj
           char *whiteout = splice_here;
           while(*whiteout != '\0' && *whiteout != ';' && *whiteout != ':')                  // whitespace dtor invocation
             *whiteout++ = ' ';
           if(*whiteout == ';') *whiteout = ' '; // whitespace last ';' (not ':' if in "?:" conditional)
-          splice_here += shiftSplice_dtor_in_buffer(dtor, splice_here, redefined);
+          defer_dtor_splice(dtor, splice_here, redefined, false);
+          ++splice_here;
         }
-      } else if(is_at_substring(splice_here, dtor) && in_scope == 0) return; // no need to dtor if already in EXACT same scope as declaration
+      }
     }
     ++splice_here;
   }
@@ -2093,42 +5077,43 @@ void add_object_dtor(char *splice_here, bool object_being_assigned, bool redefin
 ******************************************************************************/
 
 // parse object method invocations -- 'method_words' only meaningful when 'is_nested_method' == true
-int parse_method_invocation(char *s, char *NEW_FILE, int *j, bool is_nested_method, char method_words[][MAX_TOKEN_NAME_LENGTH]) {
+static int parse_method_invocation(char *s, struct string_builder *NEW_FILE, bool is_nested_method, char method_words[][MAX_TOKEN_NAME_LENGTH]) {
   char *p = s, first_char = *s, new_fcn_call[MAX_TOKEN_NAME_LENGTH];
   FLOOD_ZEROS(new_fcn_call, MAX_TOKEN_NAME_LENGTH);
   int method_name_size = 0;
   if(!(VARCHAR(*p)) && (VARCHAR(*(p + 1)))) {                                  // may be object
     p++;
-    for(int i = 0; i < total_objects; ++i) {                                   // check for each object
-      int len = strlen(objects[i].object_name);
-      if(strlen(p) > len && is_at_substring(p, objects[i].object_name)) {      // found object
-        int invoker_size = is_method_invocation(p + len);
-        if(invoker_size == 0) continue;                                        // no invocation notation (no '.' nor '->')
-        char invoked_member_name[MAX_TOKEN_NAME_LENGTH];
-        get_invoked_member_name(p + len + invoker_size, invoked_member_name);  // get member name
-        if(invoked_member_is_method(invoked_member_name, objects[i].class_name, is_nested_method)) { // member = method
-          while((invoker_size = is_method_invocation(p)) > 0 || VARCHAR(*p)) { // move p to after object & method names
-            if(invoker_size == 0) invoker_size = 1; // VARCHAR
-            p += invoker_size, method_name_size += invoker_size;
-          }
-          method_name_size++;                                                  // for 1st char ('%c' in sprintf below)
-          sprintf(new_fcn_call, "%cDC_%s_%s", first_char, objects[i].class_name, invoked_member_name);
-
-          // whether method is invoked within another method, but splice in either way
-          if(is_nested_method)
-            splice_in_prepended_NESTED_method_name(new_fcn_call, p, i, NEW_FILE, &method_name_size, method_words);
-          else
-            splice_in_prepended_method_name(new_fcn_call, p, i, NEW_FILE, j, &method_name_size, method_words);
-          break;
+    int len = 0;
+    while(VARCHAR(p[len])) ++len;
+    int invoker_size = is_method_invocation(p + len);
+    if(invoker_size == 0) return 0;                                            // no invocation notation (no '.' nor '->')
+    char invoked_member_name[MAX_TOKEN_NAME_LENGTH];
+    get_invoked_member_name(p + len + invoker_size, invoked_member_name);      // get member name
+    // check each in-scope object w/ the word's name, innermost declaration 1st
+    for(int pos = name_index_find(&DC->OBJECT_INDEX, p, len, -1); pos != -1; pos = name_index_find(&DC->OBJECT_INDEX, p, len, pos)) {
+      int i = DC->OBJECT_INDEX.entries[pos].id;                                    // found object
+      if(invoked_member_is_method(invoked_member_name, DC->objects[i].class_name, is_nested_method)) { // member = method
+        while((invoker_size = is_method_invocation(p)) > 0 || VARCHAR(*p)) { // move p to after object & method names
+          if(invoker_size == 0) invoker_size = 1; // VARCHAR
+          p += invoker_size, method_name_size += invoker_size;
         }
+        method_name_size++;                                                  // for 1st char ('%c' in sprintf below)
+        sprintf(new_fcn_call, "%cDC_%s_%s", first_char, DC->objects[i].class_name, invoked_member_name);
+
+        // whether method is invoked within another method, but splice in either way
+        if(is_nested_method)
+          splice_in_prepended_NESTED_method_name(new_fcn_call, p, i, NEW_FILE, &method_name_size, method_words);
+        else
+          splice_in_prepended_method_name(new_fcn_call, p, i, NEW_FILE, &method_name_size, method_words);
+        break;
       }
     }
   } else method_name_size = 0;
   return method_name_size;
 }
 
-// splice in prepended method name to buffer via an index subscript
-void splice_in_prepended_method_name(char*new_fcn_call,char*p,int i,char*NEW_FILE,int*j,
+// splice in prepended method name to the file buffer
+static void splice_in_prepended_method_name(char*new_fcn_call,char*p,int i,struct string_builder*NEW_FILE,
                                      int*method_name_size,char method_words[][MAX_TOKEN_NAME_LENGTH]) {
   char objectName[MAX_TOKEN_NAME_LENGTH * 2], objectChain[MAX_TOKEN_NAME_LENGTH * 2]; // 'objectName' refers to outermost object in 'objectChain
   bool objectName_is_pointer = false;
@@ -2136,39 +5121,34 @@ void splice_in_prepended_method_name(char*new_fcn_call,char*p,int i,char*NEW_FIL
   get_object_name(objectName, objectChain, p, i, method_words, false, &objectName_is_pointer);
 
   // remove invoking object's container object chain-prefix from 'NEWFILE' (if present)
-  char *rmv_buffer_objectChain = &NEW_FILE[*j];
-  rmv_excess_buffer_objectChain(objectName, objects[i].object_name, objectChain, rmv_buffer_objectChain, new_fcn_call);
-  *j = strlen(NEW_FILE);
+  rmv_excess_buffer_objectChain(objectName, DC->objects[i].object_name, objectChain, NEW_FILE, new_fcn_call);
 
   // splice in prefixed method name & add invoker's address to end of arguments
-  APPEND_STR_TO_NEW_FILE(new_fcn_call);
-  while(*p != '\0' && *p != ')') NEW_FILE[(*j)++] = *p++, (*method_name_size)++;
-  if(*(p - 1) != '(') NEW_FILE[(*j)++] = ',', NEW_FILE[(*j)++] = ' ';
-  if(objectName_is_pointer) sprintf(&NEW_FILE[*j], "%s", objectChain);  // splice in ptr obj address
-  else                      sprintf(&NEW_FILE[*j], "&%s", objectChain); // splice in val obj address
-  *j = strlen(NEW_FILE);
+  sb_append(NEW_FILE, new_fcn_call);
+  while(*p != '\0' && *p != ')') sb_putc(NEW_FILE, *p++), (*method_name_size)++;
+  if(*(p - 1) != '(') sb_append(NEW_FILE, ", ");
+  if(objectName_is_pointer) sb_printf(NEW_FILE, "%s", objectChain);  // splice in ptr obj address
+  else                      sb_printf(NEW_FILE, "&%s", objectChain); // splice in val obj address
 }
 
-// splice in prepended method name to buffer via a pointer
-void splice_in_prepended_NESTED_method_name(char*new_fcn_call,char*p,int i,char*method_buff_idx,
+// splice in prepended method name to the method buffer
+static void splice_in_prepended_NESTED_method_name(char*new_fcn_call,char*p,int i,struct string_builder*method_buff,
                                             int*method_name_size,char method_words[][MAX_TOKEN_NAME_LENGTH]){
   char objectName[MAX_TOKEN_NAME_LENGTH * 2], objectChain[MAX_TOKEN_NAME_LENGTH * 2]; // 'objectName' refers to outermost object in 'objectChain
   bool objectName_is_pointer = false;
   FLOOD_ZEROS(objectName, MAX_TOKEN_NAME_LENGTH * 2); FLOOD_ZEROS(objectChain, MAX_TOKEN_NAME_LENGTH * 2);
   get_object_name(objectName, objectChain, p, i, method_words, true, &objectName_is_pointer);
 
-  // remove invoking object's container object chain-prefix from 'method_buff_idx' (if present)
-  rmv_excess_buffer_objectChain(objectName, objects[i].object_name, objectChain, method_buff_idx, new_fcn_call);
-  while(*method_buff_idx == '\0') --method_buff_idx; // move back to 1st-'\0' sans-chain position
-  ++method_buff_idx;                                 // move up to '\0'
+  // remove invoking object's container object chain-prefix from 'method_buff' (if present)
+  rmv_excess_buffer_objectChain(objectName, DC->objects[i].object_name, objectChain, method_buff, new_fcn_call);
   // if still need to remove 'this->' prefix
-  if(is_at_substring(method_buff_idx - 6, "this->")) 
-    for(int k = 0; k < 6; ++k) *method_buff_idx-- = '\0';
+  if(method_buff->len >= 6 && is_at_substring(&method_buff->str[method_buff->len - 6], "this->")) 
+    sb_truncate(method_buff, method_buff->len - 6);
 
   // if the outermost 'objectName' object in 'objectChain' is itself also a member of the current class
-  for(int idx = 0; idx < classes[total_classes].total_members; ++idx) {
-    if(classes[total_classes].member_names[idx][0] == 0) continue; // struct member -- disregard
-    if(strcmp(classes[total_classes].member_names[idx], objectName) == 0) {
+  for(int idx = 0; idx < DC->classes[DC->total_classes].total_members; ++idx) {
+    if(DC->classes[DC->total_classes].member_names[idx][0] == 0) continue; // struct member -- disregard
+    if(strcmp(DC->classes[DC->total_classes].member_names[idx], objectName) == 0) {
       FLOOD_ZEROS(objectName, MAX_TOKEN_NAME_LENGTH * 2);                   // empty out object name
       sprintf(objectName, "(this->%s)", objectChain); // write prefixed-objectChain to objectName 
       FLOOD_ZEROS(objectChain, MAX_TOKEN_NAME_LENGTH * 2);                  // empty objectChain
@@ -2178,19 +5158,17 @@ void splice_in_prepended_NESTED_method_name(char*new_fcn_call,char*p,int i,char*
   }
 
   // add prefixed method name
-  sprintf(method_buff_idx, "%s", new_fcn_call); 
-  method_buff_idx += strlen(method_buff_idx);
+  sb_append(method_buff, new_fcn_call); 
   // copy method argument & prefix 'this->' for any local members w/in
-  p += prefix_local_members_and_cpy_method_args(p, method_buff_idx, method_words, method_name_size, ')');
-  method_buff_idx += strlen(method_buff_idx);
-  if(*(p - 1) != '(') *method_buff_idx++ = ',', *method_buff_idx++ = ' ';
-  if(objectName_is_pointer) sprintf(method_buff_idx, "%s", objectChain);  // splice in ptr obj address
-  else                      sprintf(method_buff_idx, "&%s", objectChain); // splice in val obj address
+  p += prefix_local_members_and_cpy_method_args(p, method_buff, method_words, method_name_size, ')');
+  if(*(p - 1) != '(') sb_append(method_buff, ", ");
+  if(objectName_is_pointer) sb_printf(method_buff, "%s", objectChain);  // splice in ptr obj address
+  else                      sb_printf(method_buff, "&%s", objectChain); // splice in val obj address
 }
 
 // removes the excess front of the objectChain from 'buffer', occuring if 
 // the object invoking method is also invoked by another container object
-void rmv_excess_buffer_objectChain(char*objectName,char*invokingObject,char*objectChain,char*buffer,char*new_fcn_call){
+static void rmv_excess_buffer_objectChain(char*objectName,char*invokingObject,char*objectChain,struct string_builder*buffer,char*new_fcn_call){
   if(strcmp(objectName, invokingObject) != 0) { // again, 'objectName' refers to outermost object in 'objectChain'
     // to get rid of "first_char" (possible method invoker) left in from "parse_method_invocation()"
     char *temp = new_fcn_call;
@@ -2204,8 +5182,7 @@ void rmv_excess_buffer_objectChain(char*objectName,char*invokingObject,char*obje
     while(VARCHAR(*excess_chain)) --excess_chain;                              // skip 'invokingObject' method invoker
     *excess_chain = '\0';
     int chain_length = strlen(objectChain_clone);                              // how many chars to rmv from 'buffer'
-    for(int k = 0; k < chain_length; ++k) *buffer-- = '\0';                    // rmv excess chained objects
-    *buffer = '\0';
+    sb_truncate(buffer, buffer->len - chain_length);                           // rmv excess chained objects
   }
 }
 
@@ -2215,7 +5192,7 @@ void rmv_excess_buffer_objectChain(char*objectName,char*invokingObject,char*obje
 
 // returns length of '.' or '->' invocation (0 if none) + length of array 
 // subscript (if present) for invocation by a class w/in a class array
-int is_method_invocation(char *p) {
+static int is_method_invocation(char *p) {
   #define after_arr(p) (p + array_arg_size)
   int invoker_size = 0, array_arg_size = 1;
   // has (or is in) an array subscript
@@ -2238,17 +5215,15 @@ int is_method_invocation(char *p) {
 }
 
 // return whether object's invoked member is a class method
-bool invoked_member_is_method(char *invoked_member_name, char *class_name, bool is_nested_method) {
+static bool invoked_member_is_method(char *invoked_member_name, char *class_name, bool is_nested_method) {
   // '+ is_nested_method' b/c nested methods processed prior to total_classes++
-  for(int i = 0; i < total_classes + is_nested_method; ++i) 
-    if(strcmp(classes[i].class_name, class_name) == 0)
-      for(int j = 0; j < classes[i].total_methods; ++j)
-        if(strcmp(classes[i].method_names[j], invoked_member_name) == 0) return true;
-  return false;
+  int class_idx = class_named(class_name, strlen(class_name), DC->total_classes + is_nested_method);
+  return class_idx != -1 
+    && name_index_find(&DC->classes[class_idx].method_index, invoked_member_name, strlen(invoked_member_name), -1) != -1;
 }
 
  // return object's invoked 'class' member
-void get_invoked_member_name(char *member_ptr, char *invoked_member_name) {
+static void get_invoked_member_name(char *member_ptr, char *invoked_member_name) {
   int i = 0;
   while(*member_ptr != '\0' && VARCHAR(*member_ptr)) 
     invoked_member_name[i++] = *member_ptr++;
@@ -2258,7 +5233,7 @@ void get_invoked_member_name(char *member_ptr, char *invoked_member_name) {
 // returns outmost object's name, the entire object invocation chain (w/ prefixed array
 // subscripts as needed) as well as whether the outermost object is a pointer
 // 'is_nested_object' indicates parsing a nested method-within-a-method invocation
-void get_object_name(char*outerMost_objectName,char*objectChain,char*buffer,int i,
+static void get_object_name(char*outerMost_objectName,char*objectChain,char*buffer,int i,
                      char method_words[][MAX_TOKEN_NAME_LENGTH],bool is_nested_object,bool*objectName_is_pointer) {
   // * outerMost_objectName is the name - w/o subscripts - of the outermost object leading the object chain of invocation
   // * the objectChain consists of an optional outer container object that contains the method-invoking
@@ -2305,22 +5280,19 @@ void get_object_name(char*outerMost_objectName,char*objectChain,char*buffer,int
 
   // if nested, find any local members w/in array subscript to prefix 'this->'
   if(is_nested_object) {
-    char prefixed_objectChain[MAX_TOKEN_NAME_LENGTH * 2];
-    FLOOD_ZEROS(prefixed_objectChain, MAX_TOKEN_NAME_LENGTH * 2);
-    prefixed_objectChain[0] = '\0';
-    char *read_chain = objectChain, *write_chain = prefixed_objectChain;
+    struct string_builder prefixed_objectChain = {NULL, 0, 0};
+    char *read_chain = objectChain;
     while(*read_chain != '\0') {
       if(*read_chain == '[') {
         int filler_int_arg = 0;
         // repurpose method argument parser/copier to handle array subscript instead
-        read_chain += prefix_local_members_and_cpy_method_args(read_chain,write_chain,method_words,&filler_int_arg,']');
-        write_chain += strlen(write_chain);
+        read_chain += prefix_local_members_and_cpy_method_args(read_chain,&prefixed_objectChain,method_words,&filler_int_arg,']');
       }
-      if(*read_chain != '\0') *write_chain++ = *read_chain++;
+      if(*read_chain != '\0') sb_putc(&prefixed_objectChain, *read_chain++);
     }
-    *write_chain = '\0';
     FLOOD_ZEROS(objectChain, MAX_TOKEN_NAME_LENGTH * 2); // save prefixed object chain as the only object chain
-    strcpy(objectChain, prefixed_objectChain);
+    if(prefixed_objectChain.len > 0) strcpy(objectChain, prefixed_objectChain.str);
+    sb_free(&prefixed_objectChain);
   }
 
   // determine whether outermost object is a ptr via its method invocation punctuation
@@ -2342,7 +5314,7 @@ void get_object_name(char*outerMost_objectName,char*objectChain,char*buffer,int
 }
 
 // prefixes local members with 'this->' & cpys entire method arg to 'write_to_buffer'
-int prefix_local_members_and_cpy_method_args(char*end,char*write_to_buffer,char method_words[][MAX_TOKEN_NAME_LENGTH],
+static int prefix_local_members_and_cpy_method_args(char*end,struct string_builder*write_to_buffer,char method_words[][MAX_TOKEN_NAME_LENGTH],
                                              int*buffer_length,char delimiter) {
   int end_increment = 0;
   char *word_start = end + 1, *findArrow;
@@ -2353,7 +5325,7 @@ int prefix_local_members_and_cpy_method_args(char*end,char*write_to_buffer,char
         findArrow = end;
         while(IS_WHITESPACE(*findArrow)) --findArrow; // screen for arrow invocation
         if(*findArrow == '>' && *(findArrow-1) == '-') {
-          *write_to_buffer++ = *end++, *buffer_length += 1, ++end_increment;
+          sb_putc(write_to_buffer, *end++), *buffer_length += 1, ++end_increment;
           continue;
         }
       }
@@ -2365,14 +5337,13 @@ int prefix_local_members_and_cpy_method_args(char*end,char*write_to_buffer,char
       while(word_start != end + 1) argument[idx++] = *word_start++;           // copy argument word
       argument[idx++] = '\0';
       if(not_in_method_words(method_words, idx, argument))                    // argument != redefined variable
-        for(int i = 0; i < classes[total_classes].total_members; ++i)
-          if(strcmp(classes[total_classes].member_names[i], argument) == 0) { // argument = local member
+        for(int i = 0; i < DC->classes[DC->total_classes].total_members; ++i)
+          if(strcmp(DC->classes[DC->total_classes].member_names[i], argument) == 0) { // argument = local member
             splice_in_this_arrowPtr(write_to_buffer);
-            write_to_buffer += strlen(write_to_buffer);
             break; 
           }
     }
-    *write_to_buffer++ = *end++, *buffer_length += 1, ++end_increment;        // copy-current & traverse-next char in arg
+    sb_putc(write_to_buffer, *end++), *buffer_length += 1, ++end_increment;   // copy-current & traverse-next char in arg
   }
   return end_increment;
 }
@@ -2386,7 +5357,7 @@ int prefix_local_members_and_cpy_method_args(char*end,char*write_to_buffer,char
 // total_classes_increment: -1 = arg (no dtor) 
 //                           0 = in fcn (total_classes)      (dtor if not returned) 
 //                           1 = in method (total_classes+1) (dtor if not returned)
-bool store_object_info(char *s, int total_classes_increment, bool *dummy_ctor) {
+static bool store_object_info(char *s, int total_classes_increment, bool *dummy_ctor) {
   bool not_an_arg = true, is_fcn_assignment = false, has_dtor = false, is_alloced_class_pointer = false;
   char *q = s, *p = s, object_name[MAX_TOKEN_NAME_LENGTH], class_type_name[MAX_TOKEN_NAME_LENGTH];
   FLOOD_ZEROS(object_name, MAX_TOKEN_NAME_LENGTH); 
@@ -2409,7 +5380,7 @@ bool store_object_info(char *s, int total_classes_increment, bool *dummy_ctor) {
 
   // determine whether object is prefixed with "immortal" keyword (never invokes class dtor if tagged "immortal")
   bool is_immortal = false;
-  if(*IMMORTALITY) {
+  if(*DC->IMMORTALITY) {
     char *check_immortal = s - 1;                                    // start 1 position before class name type
     while(IS_WHITESPACE(*check_immortal) && *check_immortal != '\n') // move past the space btwn "immortal' '<type>"
       --check_immortal;
@@ -2452,22 +5423,22 @@ bool store_object_info(char *s, int total_classes_increment, bool *dummy_ctor) {
   if(*p == '[') is_class_array = true;                  // check if object == class array
   object_name[j] = '\0', class_type_name[i] = '\0';
   if(strlen(object_name) == 0 || class_type_name[strlen(class_type_name)-1] == ',') return false; // prototype fcn arg
-  strcpy(objects[total_objects].object_name, object_name);
-  strcpy(objects[total_objects].class_name, class_type_name);
-  objects[total_objects].is_class_pointer = is_class_pointer;
-  objects[total_objects].is_alloced_class_pointer = is_alloced_class_pointer;
-  objects[total_objects].is_class_array = is_class_array;
-  objects[total_objects].is_immortal = is_immortal;
+  reserve_class_tables(0, 1, 0);
+  strcpy(DC->objects[DC->total_objects].object_name, object_name);
+  strcpy(DC->objects[DC->total_objects].class_name, class_type_name);
+  DC->objects[DC->total_objects].is_class_pointer = is_class_pointer;
+  DC->objects[DC->total_objects].is_alloced_class_pointer = is_alloced_class_pointer;
+  DC->objects[DC->total_objects].is_class_array = is_class_array;
+  DC->objects[DC->total_objects].is_immortal = is_immortal;
 
   // determine whether object's class uses a dtor (default false if object == an arg tho)
-  if(total_classes_increment != -1 && not_an_arg) // object declared != arg
-    for(int k = 0; k < total_classes + total_classes_increment; ++k)
-      if(strcmp(classes[k].class_name, class_type_name) == 0) {
-        has_dtor = classes[k].class_has_dtor;
-        break;
-      }
-  objects[total_objects].class_has_dtor = has_dtor;
-  total_objects++;
+  if(total_classes_increment != -1 && not_an_arg) { // object declared != arg
+    int k = class_named(class_type_name, strlen(class_type_name), DC->total_classes + total_classes_increment);
+    if(k != -1) has_dtor = DC->classes[k].class_has_dtor;
+  }
+  DC->objects[DC->total_objects].class_has_dtor = has_dtor;
+  name_index_add(&DC->OBJECT_INDEX, DC->objects[DC->total_objects].object_name, DC->total_objects); // register in object symbol table
+  DC->total_objects++;
 
   // don't pre-init dflt vals to arguments 
   // (nor pointers w/o allocated memory, but such is handled externally)
@@ -2478,23 +5449,33 @@ bool store_object_info(char *s, int total_classes_increment, bool *dummy_ctor) {
 * PARSE CLASS HELPER FUNCTIONS
 ******************************************************************************/
 
+// grows "classes", "objects", & "ALLOC_FCNS" to hold 'classes', 'objects', & 'alloc_fcns' more entries
+// ("classes" also keeps room for the class being parsed past them)
+static void reserve_class_tables(int classes, int objects, int alloc_fcns) {
+  DC->classes = reserve_table(DC->classes, &DC->max_classes, DC->total_classes + classes + 1, sizeof(struct class_info));
+  DC->objects = reserve_table(DC->objects, &DC->max_objects, DC->total_objects + objects, sizeof(struct objNames));
+  DC->ALLOC_FCNS = reserve_table(DC->ALLOC_FCNS, &DC->max_alloc_fcns, DC->TOTAL_ALLOC_FCNS + alloc_fcns, sizeof(DC->ALLOC_FCNS[0]));
+}
+
 // stores a new class instance's default stats in the global "classes" struct
-void initialize_new_class_default_properties(char *class_name) {
-  strcpy(classes[total_classes].class_name, class_name);
-  classes[total_classes].total_methods = 0, classes[total_classes].total_members = 1;
-  classes[total_classes].total_uctors = 0;
-  classes[total_classes].class_has_alloc = false, classes[total_classes].class_has_dtor = false;
-  classes[total_classes].class_has_ctor = false, classes[total_classes].class_has_ctor_args = false;
-  classes[total_classes].member_value_user_ctor[0][0] = 0, classes[total_classes].member_value_user_ctor[0][1] = '\0';
-  classes[total_classes].member_object_class_name[0][0] = 0, classes[total_classes].member_object_class_name[0][1] = '\0';
-  classes[total_classes].member_is_immortal[0] = classes[total_classes].member_value_is_alloc[0] = false;
-  classes[total_classes].member_is_array[0] = false;
-  classes[total_classes].member_is_pointer[0] = true;
-  strcpy(classes[total_classes].member_names[0], "object_has_been_destroyed_flag");
+static void initialize_new_class_default_properties(char *class_name) {
+  strcpy(DC->classes[DC->total_classes].class_name, class_name);
+  name_index_add(&DC->CLASS_INDEX, class_name, DC->total_classes);
+  DC->classes[DC->total_classes].total_methods = 0, DC->classes[DC->total_classes].total_members = 1;
+  DC->classes[DC->total_classes].total_uctors = 0;
+  DC->classes[DC->total_classes].class_has_alloc = false, DC->classes[DC->total_classes].class_has_dtor = false;
+  DC->classes[DC->total_classes].class_is_pooled = false;
+  DC->classes[DC->total_classes].class_has_ctor = false, DC->classes[DC->total_classes].class_has_ctor_args = false;
+  DC->classes[DC->total_classes].member_value_user_ctor[0][0] = 0, DC->classes[DC->total_classes].member_value_user_ctor[0][1] = '\0';
+  DC->classes[DC->total_classes].member_object_class_name[0][0] = 0, DC->classes[DC->total_classes].member_object_class_name[0][1] = '\0';
+  DC->classes[DC->total_classes].member_is_immortal[0] = DC->classes[DC->total_classes].member_value_is_alloc[0] = false;
+  DC->classes[DC->total_classes].member_is_array[0] = false;
+  DC->classes[DC->total_classes].member_is_pointer[0] = true;
+  strcpy(DC->classes[DC->total_classes].member_names[0], "object_has_been_destroyed_flag");
 }
 
 // returns whether struct is definition (true) or variable declaration (false)
-bool is_struct_definition(char *end) {
+static bool is_struct_definition(char *end) {
   char *brace = end, *newline = end;
   while(*newline != '\0' && *newline != '\n') ++newline;
   while(*brace != '\0' && *brace != '{') if(brace++ == newline) return false;
@@ -2502,7 +5483,7 @@ bool is_struct_definition(char *end) {
 }
 
 // get class (now struct) name
-void get_class_name(char *s, char *class_name) {
+static void get_class_name(char *s, char *class_name) {
   char *p = s, *name = class_name;
   while(*p != '\0' && *p++ != ' ');                                         // skip 'class '
   while(*p != '\0' && *p != ' ' && *p != '{' && *p != '\n') *name++ = *p++; // copy class (becoming struct) name 
@@ -2512,38 +5493,38 @@ void get_class_name(char *s, char *class_name) {
 // checks whether or not class already has a user-defined ctor/dtor, & throws error if so
 // (unless is a ctor & "#define DECLASS_NCOLA" was not found, then "confirm_only_valid_cola_overloads" 
 // checks to confirm only arg-length based overloads were made & throws an error if needed)
-void confirm_only_one_cdtor(char *class_name, char *structor_type, bool possible_dtor) {
-  if((possible_dtor && classes[total_classes].class_has_dtor) || (!possible_dtor && classes[total_classes].class_has_ctor && NO_COLA_PARSER)) {
-    fprintf(stderr, "\n >> declass.c: \033[1m\033[31mERROR\033[0m MORE THAN 1 %s FOR CLASSNAME \"%s\" FOUND!", structor_type, class_name);
-    fprintf(stderr, "\n >> NO FUNCTION OVERLOADING");
-    if(!possible_dtor && classes[total_classes].class_has_ctor && NO_COLA_PARSER)
-      fprintf(stderr, " (\"#define DECLASS_NCOLA\" WAS DETECTED!)");
-    if(MORTAL_ERRORS) ask_user_whether_to_quit_or_continue_declassification();
+static void confirm_only_one_cdtor(char *class_name, char *structor_type, bool possible_dtor) {
+  if((possible_dtor && DC->classes[DC->total_classes].class_has_dtor) || (!possible_dtor && DC->classes[DC->total_classes].class_has_ctor && DC->NO_COLA_PARSER)) {
+    fprintf(DC_STDERR, "\n >> declass.c: \033[1m\033[31mERROR\033[0m MORE THAN 1 %s FOR CLASSNAME \"%s\" FOUND!", structor_type, class_name);
+    fprintf(DC_STDERR, "\n >> NO FUNCTION OVERLOADING");
+    if(!possible_dtor && DC->classes[DC->total_classes].class_has_ctor && DC->NO_COLA_PARSER)
+      fprintf(DC_STDERR, " (\"#define DECLASS_NCOLA\" WAS DETECTED!)");
+    if(DC->MORTAL_ERRORS) ask_user_whether_to_quit_or_continue_declassification();
     else {
-      fprintf(stderr, " >> Terminating Declassifier.\n");
-      exit(EXIT_FAILURE);
+      fprintf(DC_STDERR, " >> Terminating Declassifier.\n");
+      declass_exit(EXIT_FAILURE);
     }
   }
 }
 
 // confirm only COLA (arg-length based function/macro overloads) have been made for ctors
-void confirm_only_valid_cola_overloads(char *class_name) {
-  for(int i = 0, j; !NO_COLA_PARSER && i < classes[total_classes].total_uctors - 1; ++i)
-    for(j = i + 1; j < classes[total_classes].total_uctors; ++j)
-      if(classes[total_classes].class_uctor_arg_lengths[i] == classes[total_classes].class_uctor_arg_lengths[j]) {
-        fprintf(stderr, "\n >> declass.c: \033[1m\033[31mERROR\033[0m INVALID DUPLICATE CTOR ARGUMENT-LENGTH \"COLA\" OVERLOAD DETECTED!\n");
-        fprintf(stderr, " >> FOUND IN CLASSNAME \"%s\"\n", class_name);
-        fprintf(stderr, " >> ONLY FUNCTIONS & CTORS W/ DIFFERING #'S OF ARGUMENTS CAN BE \"COLA\" OVERLOADED!\n");
-        if(MORTAL_ERRORS) ask_user_whether_to_quit_or_continue_declassification();
+static void confirm_only_valid_cola_overloads(char *class_name) {
+  for(int i = 0, j; !DC->NO_COLA_PARSER && i < DC->classes[DC->total_classes].total_uctors - 1; ++i)
+    for(j = i + 1; j < DC->classes[DC->total_classes].total_uctors; ++j)
+      if(DC->classes[DC->total_classes].class_uctor_arg_lengths[i] == DC->classes[DC->total_classes].class_uctor_arg_lengths[j]) {
+        fprintf(DC_STDERR, "\n >> declass.c: \033[1m\033[31mERROR\033[0m INVALID DUPLICATE CTOR ARGUMENT-LENGTH \"COLA\" OVERLOAD DETECTED!\n");
+        fprintf(DC_STDERR, " >> FOUND IN CLASSNAME \"%s\"\n", class_name);
+        fprintf(DC_STDERR, " >> ONLY FUNCTIONS & CTORS W/ DIFFERING #'S OF ARGUMENTS CAN BE \"COLA\" OVERLOADED!\n");
+        if(DC->MORTAL_ERRORS) ask_user_whether_to_quit_or_continue_declassification();
         else {
-          fprintf(stderr, " >> Terminating Declassifier.\n");
-          exit(EXIT_FAILURE);
+          fprintf(DC_STDERR, " >> Terminating Declassifier.\n");
+          declass_exit(EXIT_FAILURE);
         }
       }
 }
 
 // count the # args in any given ctor (used to design dummy/array object ctor macros for COLA-overloaded user-def'd ctors)
-int count_class_cdtor_args(char *r) {
+static int count_class_cdtor_args(char *r) {
   bool in_a_string = false, in_a_char = false, in_token_scope = true;
   int in_arg_scope = 1, arg_total = 1;
   ++r; // move "r" to 1st arg in fcn & past opening '('
@@ -2562,7 +5543,7 @@ int count_class_cdtor_args(char *r) {
 
 // parse & prepend function name w/ class (now struct) name, & determine 
 // whether method is user-defined class constructor/destructor
-void get_prepended_method_name(char*s,char*class_name,char*prepended_method_name,bool*method_is_ctor,bool*method_is_dtor){
+static void get_prepended_method_name(char*s,char*class_name,char*prepended_method_name,bool*method_is_ctor,bool*method_is_dtor){
   int total_utor_args = 0; // for cola.c overloading
   char method_name[MAX_TOKEN_NAME_LENGTH], cdtor_name[MAX_TOKEN_NAME_LENGTH], structor_name[30], structor_type[30];
   char structor_invoker[MAX_TOKEN_NAME_LENGTH * 2], bad_code_buffer[BAD_CODE_BUFFER_LENGTH];
@@ -2593,20 +5574,21 @@ void get_prepended_method_name(char*s,char*class_name,char*prepended_method_name
   if(*q == '(' && strcmp(cdtor_name, class_name) == 0) { // no type & fcn name == class_name: method = ctor/dtor
     confirm_only_one_cdtor(class_name, structor_type, possible_dtor);
     strcpy(prepended_method_name, structor_invoker);
-    strcpy(classes[total_classes].method_names[classes[total_classes].total_methods], structor_name);
+    strcpy(DC->classes[DC->total_classes].method_names[DC->classes[DC->total_classes].total_methods], structor_name);
+    name_index_add(&DC->classes[DC->total_classes].method_index, structor_name, DC->classes[DC->total_classes].total_methods);
     if(possible_dtor) {
-      *method_is_dtor = classes[total_classes].class_has_dtor = true;
+      *method_is_dtor = DC->classes[DC->total_classes].class_has_dtor = true;
       if(count_class_cdtor_args(q) > 0) { // DTOR __CANNOT__EVER__ take args!
         FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
         get_invalid_code_snippet(s, q, bad_code_buffer);
         throw_fatal_error_dtor_has_args(class_name, __LINE__, bad_code_buffer);
       }
     } else {
-      *method_is_ctor = classes[total_classes].class_has_ctor = true;
+      *method_is_ctor = DC->classes[DC->total_classes].class_has_ctor = true;
       total_utor_args = count_class_cdtor_args(q); // retrieve & save the number of udef'd args for udef'd ctor
-      classes[total_classes].class_uctor_arg_lengths[classes[total_classes].total_uctors] = total_utor_args;
-      ++ classes[total_classes].total_uctors; // increment # of user-defined ctors
-      if(total_utor_args > 0) classes[total_classes].class_has_ctor_args = true;
+      DC->classes[DC->total_classes].class_uctor_arg_lengths[DC->classes[DC->total_classes].total_uctors] = total_utor_args;
+      ++ DC->classes[DC->total_classes].total_uctors; // increment # of user-defined ctors
+      if(total_utor_args > 0) DC->classes[DC->total_classes].class_has_ctor_args = true;
       confirm_only_valid_cola_overloads(class_name);
     }
 
@@ -2617,24 +5599,25 @@ void get_prepended_method_name(char*s,char*class_name,char*prepended_method_name
     *name = '\0';
     sprintf(prepended_method_name, "DC_%s_%s", class_name, method_name); // className_'function name'
     // store method info in global class struct's instance of the current class
-    strcpy(classes[total_classes].method_names[classes[total_classes].total_methods], method_name);
+    strcpy(DC->classes[DC->total_classes].method_names[DC->classes[DC->total_classes].total_methods], method_name);
+    name_index_add(&DC->classes[DC->total_classes].method_index, method_name, DC->classes[DC->total_classes].total_methods);
   }
-  classes[total_classes].total_methods += 1;
+  DC->classes[DC->total_classes].total_methods += 1;
 }
 
 // returns a member's initialized value (0 by default) & returns how far back name is after value initialization
-int get_initialized_member_value(char *member_end) {
+static int get_initialized_member_value(char *member_end) {
   char *start_of_val;
   int i = 0, distance_back = 0;
-  int len = classes[total_classes].total_members;
+  int len = DC->classes[DC->total_classes].total_members;
   --member_end, ++distance_back;
   while(*member_end != '\0' && no_overlap(*member_end, "=;\n")) --member_end, ++distance_back; // find '='
   if(*member_end == '=') {                                                                     // is initialized value
     start_of_val = member_end + 1;
     while(IS_WHITESPACE(*start_of_val)) start_of_val++;                                        // find start of value
     for(; *start_of_val != ';'; i++, ++start_of_val)                                           // copy initialized value
-      classes[total_classes].member_values[len][i] = *start_of_val;
-    classes[total_classes].member_values[len][i] = '\0';
+      DC->classes[DC->total_classes].member_values[len][i] = *start_of_val;
+    DC->classes[DC->total_classes].member_values[len][i] = '\0';
 
     // determine whether obj is a ptr
     char *check_ptr = member_end;
@@ -2642,13 +5625,13 @@ int get_initialized_member_value(char *member_end) {
     bool is_obj_ptr = (*check_ptr == '*');
     
     // determine whether initialized member value was a form of memory allocation
-    classes[total_classes].member_value_is_alloc[len] = false;
-    char *is_alloc = classes[total_classes].member_values[len];
+    DC->classes[DC->total_classes].member_value_is_alloc[len] = false;
+    char *is_alloc = DC->classes[DC->total_classes].member_values[len];
     char *value_front = is_alloc;
     while(*is_alloc != '\0') {
       if(is_an_alloc_fcn(is_alloc) && (is_alloc == value_front || !VARCHAR(*(is_alloc-1)))) {
-        classes[total_classes].member_value_is_alloc[len] = true;
-        classes[total_classes].class_has_alloc = true;
+        DC->classes[DC->total_classes].member_value_is_alloc[len] = true;
+        DC->classes[DC->total_classes].class_has_alloc = true;
         break;
       }
       ++is_alloc;
@@ -2663,41 +5646,43 @@ int get_initialized_member_value(char *member_end) {
     */
     char obj_arr_ctor_val[MAX_TOKEN_NAME_LENGTH * 3]; FLOOD_ZEROS(obj_arr_ctor_val, MAX_TOKEN_NAME_LENGTH * 3);
     char obj_single_ctor_val[MAX_TOKEN_NAME_LENGTH * 3]; FLOOD_ZEROS(obj_single_ctor_val, MAX_TOKEN_NAME_LENGTH * 3);
-    sprintf(obj_arr_ctor_val, "DC__%s_UCTOR_ARR", objects[total_objects-1].class_name);
-    sprintf(obj_single_ctor_val, "DC_%s_", objects[total_objects-1].class_name);
-    if(is_at_substring(classes[total_classes].member_values[len],obj_arr_ctor_val)
-      || is_at_substring(classes[total_classes].member_values[len],obj_single_ctor_val)){
-      strcpy(classes[total_classes].member_value_user_ctor[len], classes[total_classes].member_values[len]);
-      FLOOD_ZEROS(classes[total_classes].member_values[len], MAX_DEFAULT_VALUE_LENGTH);
-      if(!is_obj_ptr) sprintf(classes[total_classes].member_values[len], "{0}");
-      else            sprintf(classes[total_classes].member_values[len], "0");
+    if(DC->total_objects > 0) { // (no ctor to match before any object's registered)
+      sprintf(obj_arr_ctor_val, "DC__%s_UCTOR_ARR", DC->objects[DC->total_objects-1].class_name);
+      sprintf(obj_single_ctor_val, "DC_%s_", DC->objects[DC->total_objects-1].class_name);
+    }
+    if(DC->total_objects > 0 && (is_at_substring(DC->classes[DC->total_classes].member_values[len],obj_arr_ctor_val)
+      || is_at_substring(DC->classes[DC->total_classes].member_values[len],obj_single_ctor_val))){
+      strcpy(DC->classes[DC->total_classes].member_value_user_ctor[len], DC->classes[DC->total_classes].member_values[len]);
+      FLOOD_ZEROS(DC->classes[DC->total_classes].member_values[len], MAX_DEFAULT_VALUE_LENGTH);
+      if(!is_obj_ptr) sprintf(DC->classes[DC->total_classes].member_values[len], "{0}");
+      else            sprintf(DC->classes[DC->total_classes].member_values[len], "0");
     } else {
-      classes[total_classes].member_value_user_ctor[len][0] = 0;
-      classes[total_classes].member_value_user_ctor[len][1] = '\0';
+      DC->classes[DC->total_classes].member_value_user_ctor[len][0] = 0;
+      DC->classes[DC->total_classes].member_value_user_ctor[len][1] = '\0';
     }
 
     while(IS_WHITESPACE(*member_end) || *member_end == '=') // move ptr to end of member name to copy
       --member_end, ++distance_back; 
     --distance_back;                                        // [start, end) so move end ptr right after name
   } else {                                                  // no initialized value: set to 0
-    classes[total_classes].member_values[len][0] = 0;
-    classes[total_classes].member_values[len][1] = '\0';
+    DC->classes[DC->total_classes].member_values[len][0] = 0;
+    DC->classes[DC->total_classes].member_values[len][1] = '\0';
     distance_back = 0;
   }
   return distance_back;
 }
 
 // accounts for whether member is itself a class object, & adds it to the 'objects' struct array if so
-void register_member_class_objects(char *member_end) {
+static void register_member_class_objects(char *member_end) {
   // move 'member_end' back from line's end to line's front (to get member data type)
   while(*member_end != '\0' && *member_end != '\n') --member_end;
   while(IS_WHITESPACE(*member_end)) ++member_end;
-  int latest_member = classes[total_classes].total_members;
+  int latest_member = DC->classes[DC->total_classes].total_members;
 
   // check as to whether member is tagged with the "immortal" keyword
   // objects tagged as "immortal" before they're type never invoke user-defined class destructors
   bool is_immortal = false;
-  if(*IMMORTALITY) {
+  if(*DC->IMMORTALITY) {
     char *check_mortality = member_end, keyword[MAX_TOKEN_NAME_LENGTH];
     FLOOD_ZEROS(keyword, MAX_TOKEN_NAME_LENGTH);
     char *key_ptr = keyword;
@@ -2719,47 +5704,48 @@ void register_member_class_objects(char *member_end) {
   // find the member's data type & determine if type is a class name (thus member = class object)
   while(VARCHAR(*member_end)) member_type[idx++] = *member_end++; 
   member_type[idx] = '\0';
-  for(int i = 0; i < total_classes; ++i) {
-    if(strcmp(classes[i].class_name, member_type) == 0) {
-
-      // get member/object name & pointer/array status
-      while(IS_WHITESPACE(*member_end)) ++member_end;
-      if(*member_end == '*') is_class_pointer = true, member_end++;   // check if member is class pointer
-      idx = 0;
-      while(VARCHAR(*member_end)) member_name[idx++] = *member_end++; // copy member/class-object name
-      if(*member_end == '[') is_class_array = true;                   // check if member is class array
-      member_name[idx] = '\0';
-
-      // record whether member class object has a alloc'd member to destroy/free
-      if(classes[i].class_has_alloc) classes[total_classes].class_has_alloc = true;
-
-      // record member class object's class name
-      strcpy(classes[total_classes].member_object_class_name[latest_member], member_type);
-      
-      // register class object member as one of its class' objects
-      strcpy(objects[total_objects].object_name, member_name);
-      strcpy(objects[total_objects].class_name, member_type);
-      objects[total_objects].is_class_pointer = is_class_pointer;
-      objects[total_objects].is_class_array = is_class_array;
-      // register object & member mortality
-      classes[total_classes].member_is_immortal[latest_member] = is_immortal;
-      objects[total_objects].is_immortal = is_immortal;
-      total_objects++;
-      return;
-    }
+  int i = class_named(member_type, idx, DC->total_classes);
+  if(i != -1) {
+
+    // get member/object name & pointer/array status
+    while(IS_WHITESPACE(*member_end)) ++member_end;
+    if(*member_end == '*') is_class_pointer = true, member_end++;   // check if member is class pointer
+    idx = 0;
+    while(VARCHAR(*member_end)) member_name[idx++] = *member_end++; // copy member/class-object name
+    if(*member_end == '[') is_class_array = true;                   // check if member is class array
+    member_name[idx] = '\0';
+
+    // record whether member class object has a alloc'd member to destroy/free
+    if(DC->classes[i].class_has_alloc) DC->classes[DC->total_classes].class_has_alloc = true;
+
+    // record member class object's class name
+    strcpy(DC->classes[DC->total_classes].member_object_class_name[latest_member], member_type);
+    
+    // register class object member as one of its class' objects
+    reserve_class_tables(0, 1, 0);
+    strcpy(DC->objects[DC->total_objects].object_name, member_name);
+    strcpy(DC->objects[DC->total_objects].class_name, member_type);
+    DC->objects[DC->total_objects].is_class_pointer = is_class_pointer;
+    DC->objects[DC->total_objects].is_class_array = is_class_array;
+    // register object & member mortality
+    DC->classes[DC->total_classes].member_is_immortal[latest_member] = is_immortal;
+    DC->objects[DC->total_objects].is_immortal = is_immortal;
+    name_index_add(&DC->OBJECT_INDEX, DC->objects[DC->total_objects].object_name, DC->total_objects);
+    DC->total_objects++;
+    return;
   }
   // if not a class, class name is 0
-  classes[total_classes].member_object_class_name[latest_member][0] = 0;
-  classes[total_classes].member_object_class_name[latest_member][1] = '\0';
-  classes[total_classes].member_is_immortal[latest_member] = false; // non-obj's not dtor'd so not affected by "immortal"
+  DC->classes[DC->total_classes].member_object_class_name[latest_member][0] = 0;
+  DC->classes[DC->total_classes].member_object_class_name[latest_member][1] = '\0';
+  DC->classes[DC->total_classes].member_is_immortal[latest_member] = false; // non-obj's not dtor'd so not affected by "immortal"
 }
 
 // check if sizeof() arg is the member just created (ie *node = malloc(sizeof(node));) and if so, 
 // prepend sizeof arg with "this" (ie sizeof(this.node)) for global initializer fcn
-void check_for_alloc_sizeof_arg() {
-  int len = classes[total_classes].total_members;
-  if(classes[total_classes].member_values[len][0] == 0 || !classes[total_classes].member_value_is_alloc[len]) return;
-  char *p=classes[total_classes].member_values[len], *name=classes[total_classes].member_names[len], *size, *prep, *q;
+static void check_for_alloc_sizeof_arg() {
+  int len = DC->classes[DC->total_classes].total_members;
+  if(DC->classes[DC->total_classes].member_values[len][0] == 0 || !DC->classes[DC->total_classes].member_value_is_alloc[len]) return;
+  char *p=DC->classes[DC->total_classes].member_values[len], *name=DC->classes[DC->total_classes].member_names[len], *size, *prep, *q;
   char member_name[MAX_DEFAULT_VALUE_LENGTH], prepended_sizeof_arg[260];
   FLOOD_ZEROS(member_name, MAX_DEFAULT_VALUE_LENGTH); FLOOD_ZEROS(prepended_sizeof_arg, 260);
   size = member_name, prep = prepended_sizeof_arg;
@@ -2771,14 +5757,14 @@ void check_for_alloc_sizeof_arg() {
       while(*p != '\0' && VARCHAR(*p)) *size++ = *p++; // copy name
       *size = '\0';
       if(strcmp(member_name, name) == 0) { // check if sizeof() arg = newest member (ie *node = malloc(sizeof(node));)
-        q = classes[total_classes].member_values[len];
+        q = DC->classes[DC->total_classes].member_values[len];
         while(*q != '\0' && q != startOfSizeofArg) *prep++ = *q++; // copy up to sizeof arg
         sprintf(prep, "this.");                                    // prepend size of arg with "this"
         prep += strlen(prep);
         while(*q != '\0') *prep++ = *q++;                          // copy rest of sizeof arg
         *prep = '\0';
-        FLOOD_ZEROS(classes[total_classes].member_values[len], MAX_DEFAULT_VALUE_LENGTH);
-        strcpy(classes[total_classes].member_values[len], prepended_sizeof_arg);
+        FLOOD_ZEROS(DC->classes[DC->total_classes].member_values[len], MAX_DEFAULT_VALUE_LENGTH);
+        strcpy(DC->classes[DC->total_classes].member_values[len], prepended_sizeof_arg);
         break;
       }
     }
@@ -2787,20 +5773,20 @@ void check_for_alloc_sizeof_arg() {
 }
 
 // check for & store member in class - returns 0 = no member, 1 = member, 2 = member initialized with values
-int get_class_member(char *end, bool is_fcn_ptr) {
+static int get_class_member(char *end, bool is_fcn_ptr) {
   char *member_start, *member_end = end;
   while(IS_WHITESPACE(*member_end)) --member_end;
   if(*member_end == ';' || is_fcn_ptr) {                             // is member
     register_member_class_objects(member_end);                       // account for whether member is itself a class obj
     if(is_fcn_ptr) 
       while(*member_end != '\0' && *member_end != ';') ++member_end; // to check for initialization value
-    int len = classes[total_classes].total_members;                  // new member index
+    int len = DC->classes[DC->total_classes].total_members;                  // new member index
     member_end -= get_initialized_member_value(member_end);          // get initialized value (0 by default)
     
     if(*(member_end - 1) == ']') {                                   // is array member
       while(*member_end != '[') --member_end; 
-      classes[total_classes].member_is_array[len] = true;
-    } else classes[total_classes].member_is_array[len] = false;
+      DC->classes[DC->total_classes].member_is_array[len] = true;
+    } else DC->classes[DC->total_classes].member_is_array[len] = false;
 
     // if user using a ptr obj thats ctor'd & alloc'd, format "className *objName = ctor() = alloc()"
     // BUT member end currently directly prior "alloc()"'s equal sign right now so register's ctor's
@@ -2818,23 +5804,23 @@ int get_class_member(char *end, bool is_fcn_ptr) {
 
     char *find_asterisk = member_start;                              // determine if pointer member
     while(no_overlap(*find_asterisk, "*\n;") && !VARCHAR(*find_asterisk)) --find_asterisk;
-    classes[total_classes].member_is_pointer[len] = (*find_asterisk == '*');
+    DC->classes[DC->total_classes].member_is_pointer[len] = (*find_asterisk == '*');
 
     int i = 0;                                                       // copy member to classes struct
     while(member_start != member_end) {
-      if(VARCHAR(*member_start)) classes[total_classes].member_names[len][i++] = *member_start;
+      if(VARCHAR(*member_start)) DC->classes[DC->total_classes].member_names[len][i++] = *member_start;
       ++member_start;
     }
-    classes[total_classes].member_names[len][i] = '\0';
+    DC->classes[DC->total_classes].member_names[len][i] = '\0';
     check_for_alloc_sizeof_arg(); // prepend alloc sizeof() arg w/ "this." if arg = newest member
-    classes[total_classes].total_members += 1;
-    return 1 + (classes[total_classes].member_values[len][0] != 0);
+    DC->classes[DC->total_classes].total_members += 1;
+    return 1 + (DC->classes[DC->total_classes].member_values[len][0] != 0);
   }
   return 0;
 }
 
 // adds a word from method into 'method_words[][]'
-void add_method_word(char method_words[][MAX_TOKEN_NAME_LENGTH], int *word_size, char *word_start, char *word_end) {
+static void add_method_word(char method_words[][MAX_TOKEN_NAME_LENGTH], int *word_size, char *word_start, char *word_end) {
   char *p = word_start, method_word[MAX_TOKEN_NAME_LENGTH];
   FLOOD_ZEROS(method_word, MAX_TOKEN_NAME_LENGTH);
   int i = 0, j;
@@ -2852,7 +5838,7 @@ void add_method_word(char method_words[][MAX_TOKEN_NAME_LENGTH], int *word_size,
 ******************************************************************************/
 
 // returns whether var is a redefinition/declaration (false) or member (true)
-bool not_local_var_declaration(char *word_start) {
+static bool not_local_var_declaration(char *word_start) {
   // if 'basic_c_types' found before ';' or ') {', & isn't an array declaration elt nor array 
   // subscript nor assigned value, var is presumed to be a type redefinition/declaration (ie NOT a member)
   char *scout = word_start, *findParenthesis;
@@ -2876,14 +5862,14 @@ bool not_local_var_declaration(char *word_start) {
 }
 
 // returns whether method doesn't already have word (if false, var is then NOT a member)
-bool not_in_method_words(char method_words[][MAX_TOKEN_NAME_LENGTH], int word_size, char *word) {
+static bool not_in_method_words(char method_words[][MAX_TOKEN_NAME_LENGTH], int word_size, char *word) {
   for(int j = 0; j < word_size; ++j) if(strcmp(method_words[j], word) == 0) return false;
   return true;
 }
 
 // returns whether word isn't an invocation (true)
 // otherwise, being invoked by some external struct or class (false)
-bool not_an_external_invocation(char *method_buff_idx) {
+static bool not_an_external_invocation(char *method_buff_idx) {
   char *p = method_buff_idx;
   while(VARCHAR(*p)) --p;
   while(IS_WHITESPACE(*p)) --p;
@@ -2892,44 +5878,42 @@ bool not_an_external_invocation(char *method_buff_idx) {
 }
 
 // given a member's index, splices in 'this->' after member's name
-void splice_in_this_arrowPtr(char *method_buff_idx) {
+static void splice_in_this_arrowPtr(struct string_builder *method_buff) {
   char members_name[MAX_TOKEN_NAME_LENGTH];
   FLOOD_ZEROS(members_name, MAX_TOKEN_NAME_LENGTH);
-  method_buff_idx--;                                  // move ptr back to a char (at '\0' right now)
-  while(VARCHAR(*method_buff_idx)) --method_buff_idx; // move ptr back to front of member name
-  method_buff_idx++;                                  // increment ptr to right B4 member name
-  strcpy(members_name, method_buff_idx);
-  sprintf(method_buff_idx, "this->%s", members_name); // splice in 'this->members_name'
+  long member_start = method_buff->len;                                         // at '\0' right now
+  while(member_start > 0 && VARCHAR(method_buff->str[member_start - 1])) --member_start; // move back to front of member name
+  strcpy(members_name, &method_buff->str[member_start]);
+  sb_truncate(method_buff, member_start);
+  sb_printf(method_buff, "this->%s", members_name);                               // splice in 'this->members_name'
 }
 
 // finds methods invoked w/in methods of their same class such that they
 // should be prepended 'className'_ & take 'this' as their last arg
-int parse_local_nested_method(char *end, char *method_buff_idx, char *class_name, char method_words[][MAX_TOKEN_NAME_LENGTH]) {
+static int parse_local_nested_method(char *end, struct string_builder *method_buff, char *class_name, char method_words[][MAX_TOKEN_NAME_LENGTH]) {
   int prepended_size = 0;
   if(!VARCHAR(*end) && VARCHAR(*(end + 1))) {
-    *method_buff_idx++ = *end++, prepended_size++;                     // move to first letter
+    char first_char = *end++;                                          // move to first letter
+    prepended_size++;
     char method_name[MAX_TOKEN_NAME_LENGTH];
     FLOOD_ZEROS(method_name, MAX_TOKEN_NAME_LENGTH);
     int i = 0;
     while(VARCHAR(*end)) method_name[i++] = *end++, prepended_size++;  // copy method name
     if(*end != '(') return 0;                                          // if no method
     method_name[i] = '\0';
-    for(int j = 0; j < classes[total_classes].total_methods; ++j)      // find if class has method name
-      if(strcmp(classes[total_classes].method_names[j], method_name) == 0) {
-        sprintf(method_buff_idx, "DC_%s_%s", class_name, method_name); // prepend method name w/ 'className'_
-        method_buff_idx += strlen(method_buff_idx);
-        // copy method arguments & prefix any local members w/in w/ 'this->'
-        end += prefix_local_members_and_cpy_method_args(end, method_buff_idx, method_words, &prepended_size, ')');
-        method_buff_idx += strlen(method_buff_idx);
-        (*(end - 1) == '(') ? sprintf(method_buff_idx, "this") : sprintf(method_buff_idx, ", this");
-        return prepended_size;
-      }
+    if(name_index_find(&DC->classes[DC->total_classes].method_index, method_name, i, -1) != -1) { // find if class has method name
+      sb_printf(method_buff, "%cDC_%s_%s", first_char, class_name, method_name); // prepend method name w/ 'className'_
+      // copy method arguments & prefix any local members w/in w/ 'this->'
+      end += prefix_local_members_and_cpy_method_args(end, method_buff, method_words, &prepended_size, ')');
+      sb_append(method_buff, (*(end - 1) == '(') ? "this" : ", this");
+      return prepended_size;
+    }
   }
   return 0;
 }
 
 // umbrella fcn evaluating all conditions for a word to be a local class member
-bool valid_member(char*word_start,char*memberName,char nextChar,char period,char method_words[][MAX_TOKEN_NAME_LENGTH],int word_size) {
+static bool valid_member(char*word_start,char*memberName,char nextChar,char period,char method_words[][MAX_TOKEN_NAME_LENGTH],int word_size) {
   return (is_at_substring((word_start+1), memberName) && !VARCHAR(*word_start) // at potential member
     && (!VARCHAR(nextChar) || period == '.')                                   // member = word or struct
     && not_local_var_declaration(word_start+1)                                 // not redeclared
@@ -2942,7 +5926,7 @@ bool valid_member(char*word_start,char*memberName,char nextChar,char period,char
 ******************************************************************************/
 
 // parses class instance
-int parse_class(char *class_instance, char *NEW_FILE, int *j) {
+static int parse_class(char *class_instance, struct string_builder *NEW_FILE) {
   #define skip_over_blank_lines(first_newline) \
     blank_line_size = remove_blank_lines(first_newline); \
     if(blank_line_size > 0) { \
@@ -2952,21 +5936,24 @@ int parse_class(char *class_instance, char *NEW_FILE, int *j) {
     }
 
   // method_buff stores functions in class to be spliced out
-  char method_buff[MAX_METHOD_BYTES_PER_CLASS], *method_buff_idx;
-  FLOOD_ZEROS(method_buff, MAX_METHOD_BYTES_PER_CLASS);
+  struct string_builder method_buff = {NULL, 0, 0};
   
   // struct_buff stores non-method elts from class to be put into struct
-  char struct_buff[MAX_MEMBER_BYTES_PER_CLASS], class_name[MAX_TOKEN_NAME_LENGTH], *struct_buff_idx;
-  FLOOD_ZEROS(struct_buff, MAX_MEMBER_BYTES_PER_CLASS);
+  struct string_builder struct_buff = {NULL, 0, 0};
+  char class_name[MAX_TOKEN_NAME_LENGTH];
   FLOOD_ZEROS(class_name, MAX_TOKEN_NAME_LENGTH);
   get_class_name(class_instance, class_name);
-  sprintf(struct_buff, "typedef struct DC_%s {\n\tint *DC_DTR;", class_name);
-  struct_buff_idx = &struct_buff[strlen(struct_buff)]; // points to '\0'
-  method_buff_idx = method_buff;
+  sb_printf(&struct_buff, "typedef struct DC_%s {\n\tint *DC_DTR;", class_name);
 
   // store dflt class info in the global "classes" struct
   initialize_new_class_default_properties(class_name);
 
+  // "pooled" classes register their pool as an alloc fcn before any objs (even in their own methods) are parsed
+  if(class_is_pooled(class_instance)) {
+    DC->classes[DC->total_classes].class_is_pooled = true;
+    register_class_pool_alloc_fcn(class_name);
+  }
+
   // dummy ctor detection variables
   char dummy_ctor_invoking_obj_chain[MAX_TOKEN_NAME_LENGTH * 2];
   bool dummy_ctor_ptr_invoked = false, dummy_ctor_invoker_redefined = false;
@@ -2976,14 +5963,27 @@ int parse_class(char *class_instance, char *NEW_FILE, int *j) {
   int class_size = 0, class_comment_size, blank_line_size;
 
   // class scope btwn 'start' & 'end'
-  char *start = class_instance, *end, *start_of_line;
-  int in_class_scope = 1, in_method_scope;
-  bool in_a_string, in_a_char, in_token_scope;
+  char *start = class_instance, *end, *start_of_line, *lexed, *stop, *newline;
+  int in_class_scope = 1, in_method_scope, next_token = 0;
   while(*start++ != '{') ++class_size;
   end = start;
 
+  // lex the class' body once (re-lexed past any member ctor spliced in, as that shifts the rest)
+  struct token_stream tokens = {NULL, 0, 0};
+  lex_tokens(lexed = end, &tokens, true);
+
   // copy members to struct_buff & methods to method_buff
   while(*end != '\0' && in_class_scope > 0) {
+    // copy straight through to the next line or token checked below, never into strings
+    stop = next_token_stop(lexed, &tokens, &next_token, end, "{}(", false);
+    if(stop == NULL) stop = end + strlen(end);
+    if((newline = memchr(end, '\n', stop - end)) != NULL) stop = newline;
+    if(stop > end) {
+      sb_appendn(&struct_buff, end, stop - end);
+      class_size += stop - end, end = stop;
+      continue;
+    }
+
     // confirm in class' scope
     if(*end == '{') in_class_scope++;
     else if(*end == '}') in_class_scope--;
@@ -2993,22 +5993,22 @@ int parse_class(char *class_instance, char *NEW_FILE, int *j) {
     // within the struct's scope and thus NOT members of the outer class
     // NOTE: UNIONS & STRUCTS HANDLED IDENTICALLY!
     if((is_at_substring(end, "struct") || is_at_substring(end, "union")) && is_struct_definition(end)) {
-      while(*end != '\0' && *(end - 1) != '{') *struct_buff_idx++ = *end++, ++class_size;
+      while(*end != '\0' && *(end - 1) != '{') sb_putc(&struct_buff, *end++), ++class_size;
       int in_struct_scope = 1;
       while(*end != '\0' && in_struct_scope > 0) {
         if(*end == '{') in_struct_scope++;
         else if(*end == '}') in_struct_scope--;
         if(*end == ';') { // store struct members to use in CTOR brace initialization
           #define init_struct_members(attrib) ({\
-            classes[total_classes].attrib[classes[total_classes].total_members][0] = 0; \
-            classes[total_classes].attrib[classes[total_classes].total_members][1] = '\0'; \
+            DC->classes[DC->total_classes].attrib[DC->classes[DC->total_classes].total_members][0] = 0; \
+            DC->classes[DC->total_classes].attrib[DC->classes[DC->total_classes].total_members][1] = '\0'; \
           })
           init_struct_members(member_names); 
           init_struct_members(member_values);
           #undef init_struct_members
-          classes[total_classes].total_members += 1;
+          DC->classes[DC->total_classes].total_members += 1;
         }
-        *struct_buff_idx++ = *end++, ++class_size;
+        sb_putc(&struct_buff, *end++), ++class_size;
       }
     }
 
@@ -3016,31 +6016,32 @@ int parse_class(char *class_instance, char *NEW_FILE, int *j) {
     if(*end == '\n') {
       start_of_line = end;
       if(get_class_member(end, false) == 2) { // check for member & rmv any init vals from struct
-        *struct_buff_idx-- = '\0';
-        while(*struct_buff_idx != '\0' && *struct_buff_idx != '\n' && *struct_buff_idx != '=') *struct_buff_idx-- = '\0';
-        *struct_buff_idx++ = ';';
+        long init_val = struct_buff.len - 1;
+        while(init_val > 0 && struct_buff.str[init_val] != '\n' && struct_buff.str[init_val] != '=') --init_val;
+        sb_truncate(&struct_buff, init_val);
+        sb_putc(&struct_buff, ';');
 
-        char *check_for_obj_ptr_alloc = struct_buff_idx - 1;
+        char *check_for_obj_ptr_alloc = &struct_buff.str[struct_buff.len - 1];
         while(no_overlap(*check_for_obj_ptr_alloc, "\n=")) --check_for_obj_ptr_alloc;
         // only ptr objs both ctor'd and alloc'd have a "className *objName = ctor() = alloc();" format
         if(*check_for_obj_ptr_alloc == '=') { 
           // directly copy the obj ctor into the class object "member_value_user_ctor" attribute
 
           char *obj_ptr_alloc = check_for_obj_ptr_alloc + 1;
-          int obj_ptr_idx = 0, current_member = classes[total_classes].total_members - 1;
+          int obj_ptr_idx = 0, current_member = DC->classes[DC->total_classes].total_members - 1;
           while(IS_WHITESPACE(*obj_ptr_alloc)) ++obj_ptr_alloc;
 
           // confirm at an object pointer being constructed and alloc'd (only instance where a valid double assignment
           // could occur, and even then it's generated by declass.c not the user)
           if(!is_at_substring(obj_ptr_alloc, "DC_")) throw_potential_invalid_double_dflt_assignment(__func__, __LINE__, class_name);
 
-          FLOOD_ZEROS(classes[total_classes].member_value_user_ctor[current_member], MAX_TOKEN_NAME_LENGTH);
-          while(obj_ptr_alloc != struct_buff_idx) // copy ctor into class of "classes" struct array's ctor value
-            classes[total_classes].member_value_user_ctor[current_member][obj_ptr_idx++] = *obj_ptr_alloc++;
-          classes[total_classes].member_value_user_ctor[current_member][obj_ptr_idx-1] = '\0';
+          FLOOD_ZEROS(DC->classes[DC->total_classes].member_value_user_ctor[current_member], MAX_TOKEN_NAME_LENGTH);
+          while(obj_ptr_alloc != &struct_buff.str[struct_buff.len]) // copy ctor into class of "classes" struct array's ctor value
+            DC->classes[DC->total_classes].member_value_user_ctor[current_member][obj_ptr_idx++] = *obj_ptr_alloc++;
+          DC->classes[DC->total_classes].member_value_user_ctor[current_member][obj_ptr_idx-1] = '\0';
 
-          while(struct_buff_idx != check_for_obj_ptr_alloc) *struct_buff_idx-- = '\0'; // erase the ctor from struct buff
-          *struct_buff_idx++ = ';';
+          sb_truncate(&struct_buff, check_for_obj_ptr_alloc - struct_buff.str); // erase the ctor from struct buff
+          sb_putc(&struct_buff, ';');
         }
       }
       skip_over_blank_lines(end); // don't copy any blank lines to struct_buff
@@ -3053,20 +6054,19 @@ int parse_class(char *class_instance, char *NEW_FILE, int *j) {
       while(no_overlap(*findEq, "\n=;")) --findEq; // move to either beginning of line or assignment
       if(*findEq == '=') {                         // if function is being assigned
         while(*end != '\0' && *end != '\n')        // move to the end of the line
-          *struct_buff_idx++ = *end++, ++class_size;
+          sb_putc(&struct_buff, *end++), ++class_size;
         continue;                                  // invoke next loop iteration to trigger "member" detection logic above
       }
 
       // check for fcn ptr => treated as member
       if(*(end + 1) == '*') { 
-        while(*end != '\0' && *end != ')') *struct_buff_idx++ = *end++, ++class_size;
+        while(*end != '\0' && *end != ')') sb_putc(&struct_buff, *end++), ++class_size;
         if(get_class_member(end, true) == 2) { // copy fcn ptr args BUT NOT INITIALIZING VALUE to struct buff
-          while(*end != '\0' && *end != '=' && *(end - 1) != '\n') *struct_buff_idx++ = *end++, ++class_size;
-          *struct_buff_idx++ = ';';
-          *struct_buff_idx++ = '\n';
+          while(*end != '\0' && *end != '=' && *(end - 1) != '\n') sb_putc(&struct_buff, *end++), ++class_size;
+          sb_append(&struct_buff, ";\n");
           while(*end != '\0' && *(end - 1) != '\n') end++, ++class_size;
         } else {                              // copy fcn ptr args to struct buff
-          while(*end != '\0' && *(end - 1) != '\n') *struct_buff_idx++ = *end++, ++class_size;
+          while(*end != '\0' && *(end - 1) != '\n') sb_putc(&struct_buff, *end++), ++class_size;
         }
         start_of_line = end - 1;
         skip_over_blank_lines(end - 1);       // don't copy any blank lines to struct_buff
@@ -3079,23 +6079,21 @@ int parse_class(char *class_instance, char *NEW_FILE, int *j) {
       // (3) a member object being declared with a user-defined constructor, in which case the line ends w/ ';'
       // handle case (3): check for user-defined constructor invocation
       bool found_ctor = false;
-      int struct_increment = 0;
-      end = check_for_ctor_obj(end, struct_buff_idx, &class_size, &struct_increment, &found_ctor);
+      end = check_for_ctor_obj(end, &struct_buff, &class_size, &found_ctor);
       if(found_ctor) {
-        struct_buff_idx += struct_increment;
         // move line's end & invoke next loop iteration to trigger "member" detection logic above method detection
-        while(*end != '\0' && *end != '\n') *struct_buff_idx++ = *end++, ++class_size; 
+        while(*end != '\0' && *end != '\n') sb_putc(&struct_buff, *end++), ++class_size; 
+        lex_tokens(lexed = end, &tokens, true), next_token = 0;
         continue;
       }
 
       // store method variables and keywords to single out local members to make 'this' point to
-      char method_words[MAX_WORDS_PER_METHOD][MAX_TOKEN_NAME_LENGTH], *word_start;
+      char (*method_words)[MAX_TOKEN_NAME_LENGTH] = DC->METHOD_WORDS, *word_start;
       for(int i = 0; i < MAX_WORDS_PER_METHOD; ++i) FLOOD_ZEROS(method_words[i], MAX_TOKEN_NAME_LENGTH);
       int word_size = 0;
 
-      // confirm whether still w/in method scope or w/in a string
+      // confirm whether still w/in method scope
       in_method_scope = 1;
-      in_a_string = false, in_a_char = false, in_token_scope = true;
       
       // get className-prepended method name
       char prepended_method_name[MAX_TOKEN_NAME_LENGTH];
@@ -3104,307 +6102,286 @@ int parse_class(char *class_instance, char *NEW_FILE, int *j) {
       get_prepended_method_name(start_of_line, class_name, prepended_method_name, &method_is_ctor, &method_is_dtor);
 
       // remove method from struct_buff (only members)
-      char *wipe_method_line = start_of_line;
-      while(wipe_method_line++ != end) *struct_buff_idx-- = '\0';
+      sb_truncate(&struct_buff, struct_buff.len - (end - start_of_line));
 
       // copy method to 'method_buff' & move 'end' forward
-      while(IS_WHITESPACE(*start_of_line) && start_of_line != end)  *method_buff_idx++ = *start_of_line++; // copy indent
+      while(IS_WHITESPACE(*start_of_line) && start_of_line != end)  sb_putc(&method_buff, *start_of_line++); // copy indent
       if(method_is_dtor) {
-        sprintf(method_buff_idx, "void"); method_buff_idx += strlen(method_buff_idx);
+        sb_append(&method_buff, "void");
       } else {
-        while(!IS_WHITESPACE(*start_of_line) && start_of_line != end) *method_buff_idx++ = *start_of_line++; // copy type
+        while(!IS_WHITESPACE(*start_of_line) && start_of_line != end) sb_putc(&method_buff, *start_of_line++); // copy type
       }
-      sprintf(method_buff_idx, " %s", prepended_method_name);                              // copy appended method name
-      method_buff_idx += strlen(method_buff_idx);                                          // move method_buff_idx to '\0'
+      sb_printf(&method_buff, " %s", prepended_method_name);                              // copy appended method name
+
+      // method args & locals are scoped to the method in the object symbol table
+      push_object_scope();
 
       // store method's arg words in 'method_words[][]' to discern from local class member vars
       while(*(end + 1) != '\0' && *end != ')') {
         // Check for class objects in method argument
-        int k; 
         bool PLACEHOLDER_ARG_VAL = false;
-        for(k = 0; k < total_classes + 1; ++k)
-          if(is_at_substring(end, classes[k].class_name) 
-            && !VARCHAR(*(end + strlen(classes[k].class_name))) && !VARCHAR(*(end-1))) {
-            store_object_info(end, -1, &PLACEHOLDER_ARG_VAL); // register object arg as a class object instance
-            // check for unexpected "dummy ctor" invocation
-            if(PLACEHOLDER_ARG_VAL) 
-              POSSIBLE_DUMMY_CTOR_METHOD_ARG_ERROR_MESSAGE(__func__, __LINE__, k);
-            break; 
-          }
+        int k = class_at(end, DC->total_classes + 1);
+        if(k != -1) {
+          store_object_info(end, -1, &PLACEHOLDER_ARG_VAL); // register object arg as a class object instance
+          // check for unexpected "dummy ctor" invocation
+          if(PLACEHOLDER_ARG_VAL) 
+            POSSIBLE_DUMMY_CTOR_METHOD_ARG_ERROR_MESSAGE(__func__, __LINE__, k);
+        }
         // Save method's words in argument
-        if(k == total_classes + 1){
+        if(k == -1) {
           if(!VARCHAR(*end) && *end != ')' && VARCHAR(*(end + 1))) word_start = end + 1;
           else if(VARCHAR(*end) && !VARCHAR(*(end + 1)))
             add_method_word(method_words, &word_size, word_start, end);         // add arg word to 'method_words[][]'
         }
-        *method_buff_idx++ = *end++, ++class_size;                              // copy method up to ')'
+        sb_putc(&method_buff, *end++), ++class_size;                             // copy method up to ')'
       }
 
       // splice in 'this' class ptr as last arg in method
-      if(*(end - 1) == '(') sprintf(method_buff_idx, "%s *this", class_name);   // spliced class ptr is single method arg                      
-      else                  sprintf(method_buff_idx, ", %s *this", class_name); // spliced class ptr is poly method arg
-      method_buff_idx += strlen(method_buff_idx); 
-      while(*end != '\0' && *(end - 1) != '{') *method_buff_idx++ = *end++, ++class_size; // copy method up to '{'
+      if(*(end - 1) == '(') sb_printf(&method_buff, "%s *this", class_name);   // spliced class ptr is single method arg                      
+      else                  sb_printf(&method_buff, ", %s *this", class_name); // spliced class ptr is poly method arg
+      while(*end != '\0' && *(end - 1) != '{') sb_putc(&method_buff, *end++), ++class_size; // copy method up to '{'
 
       // if method = destructor, splice in destructors for contained objects thus far at dtor's start
       if(method_is_dtor)
-        for(int k = 0; k < classes[total_classes].total_members; ++k)
-          if(classes[total_classes].member_object_class_name[k][0] != 0
-            && !classes[total_classes].member_is_pointer[k]
-            && !classes[total_classes].member_is_immortal[k]) { // non-pointer & mortal member objects
-            if(classes[total_classes].member_is_array[k]) {
-              sprintf(method_buff_idx, "\n\t\tDC__%s_UDTOR_ARR(this->%s);", 
-                classes[total_classes].member_object_class_name[k], classes[total_classes].member_names[k]);
-            } else if(classes[total_classes].member_is_pointer[k]) {
-              sprintf(method_buff_idx, "\n\t\tDC__NOT_%s_(this->%s);", 
-                classes[total_classes].member_object_class_name[k], classes[total_classes].member_names[k]);
+        for(int k = 0; k < DC->classes[DC->total_classes].total_members; ++k)
+          if(DC->classes[DC->total_classes].member_object_class_name[k][0] != 0
+            && !DC->classes[DC->total_classes].member_is_pointer[k]
+            && !DC->classes[DC->total_classes].member_is_immortal[k]) { // non-pointer & mortal member objects
+            if(DC->classes[DC->total_classes].member_is_array[k]) {
+              sb_printf(&method_buff, "\n\t\tDC__%s_UDTOR_ARR(this->%s);", 
+                DC->classes[DC->total_classes].member_object_class_name[k], DC->classes[DC->total_classes].member_names[k]);
+            } else if(DC->classes[DC->total_classes].member_is_pointer[k]) {
+              sb_printf(&method_buff, "\n\t\tDC__NOT_%s_(this->%s);", 
+                DC->classes[DC->total_classes].member_object_class_name[k], DC->classes[DC->total_classes].member_names[k]);
             } else {
-              sprintf(method_buff_idx, "\n\t\tDC__NOT_%s_(&(this->%s));", 
-                classes[total_classes].member_object_class_name[k], classes[total_classes].member_names[k]);
+              sb_printf(&method_buff, "\n\t\tDC__NOT_%s_(&(this->%s));", 
+                DC->classes[DC->total_classes].member_object_class_name[k], DC->classes[DC->total_classes].member_names[k]);
             }
-            method_buff_idx += strlen(method_buff_idx);
           }
 
       // copy the rest of the method into 'method_buff'
       in_class_scope++;                                                      // skip first '{'
       while(*end != '\0' && in_method_scope > 0 && in_class_scope > 0) {     // copy method body
+        // write out any dtors spliced in prior the current char
+        emit_dtor_splices(end, &method_buff);
+        // copy straight through to the next token parsed below (or the next dtor spliced in), never into strings
+        stop = next_token_stop(lexed, &tokens, &next_token, end, "{}", true);
+        stop = before_next_dtor_splice((stop == NULL) ? end + strlen(end) : stop);
+        if(stop > end) {
+          sb_appendn(&method_buff, end, stop - end);
+          class_size += stop - end, end = stop;
+          continue;
+        }
         // account for current scope & cpy method
         if(*end == '{') in_method_scope++, in_class_scope++;
         else if(*end == '}') in_method_scope--, in_class_scope--;
-        account_for_string_char_scopes(&in_a_string, &in_a_char, &in_token_scope, end);
         if(in_method_scope < 0 || in_class_scope < 0) break;
+        // objects declared in nested blocks are scoped to them (the method's own braces are popped below)
+        if(*end == '{')                             push_object_scope();
+        else if(*end == '}' && in_method_scope > 0) pop_object_scope();
 
         // check for class object declaration
         bool dummy_ctor = false;
-        for(int k = 0; in_token_scope && k < total_classes + 1; ++k)
-          if(is_at_substring(end, classes[k].class_name) 
-            && !VARCHAR(*(end-1)) && !VARCHAR(*(end+strlen(classes[k].class_name)))) {
-            if(store_object_info(end, 1, &dummy_ctor)) {
-
-              // check if a so-called "dummy ctor" was detected and splice 
-              // in the "DC__DUMMY_" class/ctor name's prefix if so
-              if(dummy_ctor) {
-                dummy_ctor_ptr_invoked = dummy_ctor_invoker_redefined = false;
-                FLOOD_ZEROS(dummy_ctor_invoking_obj_chain, MAX_TOKEN_NAME_LENGTH * 2);
-                // flag the object to be destroyed again after being assigned to a dummy ctor (being that they're a new obj instance)
-                get_dummy_ctor_invoking_object_chain(end, dummy_ctor_invoking_obj_chain, k, &dummy_ctor_ptr_invoked, &dummy_ctor_invoker_redefined);
-                dummy_ctor_len = prefix_dummy_ctor_with_DC__DUMMY_(method_buff_idx, end);
-                method_buff_idx += strlen(method_buff_idx), end += dummy_ctor_len, class_size += dummy_ctor_len;
-                // As per Documentation's "DECLASS.C CTORS & DTORS" > "FORMATTING" > "(2)", dummy ctors only 
-                // return single obj instances, thus "obj arrays" are presumed to be assigning one of their
-                // individual object "cells" w/in.
-                add_object_dtor(end, true, dummy_ctor_invoker_redefined); 
-                if(dummy_ctor_invoker_redefined) { // Don't add for new declarations
-                  if(dummy_ctor_ptr_invoked)
-                    sprintf(method_buff_idx, ";if(%s){%s->DC_DTR=&DC__NDTR;}", dummy_ctor_invoking_obj_chain, dummy_ctor_invoking_obj_chain);
-                  else sprintf(method_buff_idx, ";%s.DC_DTR=&DC__NDTR", dummy_ctor_invoking_obj_chain);
-                  method_buff_idx += strlen(method_buff_idx);
-                }
-                break;
-              }
-
-              // check if object is assigned a value upon declaration (if so, no default values need be added)
-              char *already_assigned = end;
-              while(*already_assigned != '\0' && no_overlap(*already_assigned, "\n;,=")) ++already_assigned;
-              if(*already_assigned == '=' && !objects[total_objects-1].is_alloced_class_pointer) {
-                add_object_dtor(end, true, false);
-                break;
-              }
-
-              // determine if object is invoking it's user-defined constructor
-              char *user_ctor_finder = end;
-              char user_ctor[1000]; FLOOD_ZEROS(user_ctor, 1000);
-              bool is_fcn_returning_obj = false;
-              bool user_ctor_invoked=get_user_ctor(user_ctor_finder,user_ctor,classes[k].class_name,&is_fcn_returning_obj);
-              // don't splice in any constructors if "object" is actually a fcn returning an object
-              if(is_fcn_returning_obj) break;
-              // implement macro ctor
-              while(*end != '\0' && *(end-1) != ';') *method_buff_idx++ = *end++, ++class_size;
-              // if an obj ptr allocating memory, confirm obj != NULL prior to passing to ctors & dflt-val assignment
-              objects[total_objects-1].is_dangling_ctord_ptr = false; // ID dangling ptrs (no ctor/'='/alloc) to assign "objPtr=NULL" in "add_object_dtor()"
-              if(objects[total_objects-1].is_alloced_class_pointer) {
-                sprintf(method_buff_idx, " if(%s){", objects[total_objects-1].object_name), method_buff_idx += strlen(method_buff_idx);
-              // if obj a ctor'd ptr but not alloc'd, still assign dangling ptr to NULL prior any CTOR's
-              } else if(objects[total_objects-1].is_class_pointer) {
-                sprintf(method_buff_idx, " %s=NULL;", objects[total_objects-1].object_name), method_buff_idx += strlen(method_buff_idx);
-                objects[total_objects-1].is_dangling_ctord_ptr = true;
-              }
-              // only add dflt vals for non-ptrs or memory-allocated pointers
-              if(!objects[total_objects-1].is_class_pointer || objects[total_objects-1].is_alloced_class_pointer) {
-                if(objects[total_objects-1].is_class_array)        // object = array, use array macro init
-                  sprintf(method_buff_idx, " DC__%s_ARR(%s);", 
-                    classes[k].class_name, objects[total_objects-1].object_name);
-                else if(objects[total_objects-1].is_class_pointer) // object != array & is ptr, so use single-object macro init
-                  sprintf(method_buff_idx, " DC__%s_CTOR((*%s));%s->DC_DTR=&DC__NDTR;", 
-                    classes[k].class_name, objects[total_objects-1].object_name, objects[total_objects-1].object_name);
-                else                                               // object != array, so use single-object macro init
-                  sprintf(method_buff_idx, " DC__%s_CTOR(%s);", 
-                    classes[k].class_name, objects[total_objects-1].object_name);
-                method_buff_idx += strlen(method_buff_idx);
-              }
-              // add user-defined ctor invocation w/ initialization values (if present)
-              if(user_ctor_invoked) { 
-                sprintf(method_buff_idx, " %s", user_ctor); 
-                method_buff_idx += strlen(method_buff_idx); 
-              }
-              // if an obj ptr allocing memory, close the "if != null" braced-condition
-              if(objects[total_objects-1].is_alloced_class_pointer) *method_buff_idx++ = '}';
-              add_object_dtor(end, false, false);
+        int k = class_at(end, DC->total_classes + 1);
+        if(k != -1 && store_object_info(end, 1, &dummy_ctor)) do { // ('break' once handled)
+
+          // check if a so-called "dummy ctor" was detected and splice 
+          // in the "DC__DUMMY_" class/ctor name's prefix if so
+          if(dummy_ctor) {
+            dummy_ctor_ptr_invoked = dummy_ctor_invoker_redefined = false;
+            FLOOD_ZEROS(dummy_ctor_invoking_obj_chain, MAX_TOKEN_NAME_LENGTH * 2);
+            // flag the object to be destroyed again after being assigned to a dummy ctor (being that they're a new obj instance)
+            get_dummy_ctor_invoking_object_chain(end, dummy_ctor_invoking_obj_chain, k, &dummy_ctor_ptr_invoked, &dummy_ctor_invoker_redefined);
+            dummy_ctor_len = prefix_dummy_ctor_with_DC__DUMMY_(&method_buff, end);
+            end += dummy_ctor_len, class_size += dummy_ctor_len;
+            // As per Documentation's "DECLASS.C CTORS & DTORS" > "FORMATTING" > "(2)", dummy ctors only 
+            // return single obj instances, thus "obj arrays" are presumed to be assigning one of their
+            // individual object "cells" w/in.
+            add_object_dtor(end, true, dummy_ctor_invoker_redefined); 
+            if(dummy_ctor_invoker_redefined) { // Don't add for new declarations
+              if(dummy_ctor_ptr_invoked)
+                sb_printf(&method_buff, ";if(%s){%s->DC_DTR=&DC__NDTR;}", dummy_ctor_invoking_obj_chain, dummy_ctor_invoking_obj_chain);
+              else sb_printf(&method_buff, ";%s.DC_DTR=&DC__NDTR", dummy_ctor_invoking_obj_chain);
             }
             break;
           }
 
+          // check if object is assigned a value upon declaration (if so, no default values need be added)
+          char *already_assigned = end;
+          while(*already_assigned != '\0' && no_overlap(*already_assigned, "\n;,=")) ++already_assigned;
+          if(*already_assigned == '=' && !DC->objects[DC->total_objects-1].is_alloced_class_pointer) {
+            add_object_dtor(end, true, false);
+            break;
+          }
+
+          // determine if object is invoking it's user-defined constructor
+          char *user_ctor_finder = end;
+          char user_ctor[1000]; FLOOD_ZEROS(user_ctor, 1000);
+          bool is_fcn_returning_obj = false;
+          bool user_ctor_invoked=get_user_ctor(user_ctor_finder,user_ctor,DC->classes[k].class_name,&is_fcn_returning_obj);
+          // don't splice in any constructors if "object" is actually a fcn returning an object
+          if(is_fcn_returning_obj) break;
+          // implement macro ctor
+          while(*end != '\0' && *(end-1) != ';') sb_putc(&method_buff, *end++), ++class_size;
+          // if an obj ptr allocating memory, confirm obj != NULL prior to passing to ctors & dflt-val assignment
+          DC->objects[DC->total_objects-1].is_dangling_ctord_ptr = false; // ID dangling ptrs (no ctor/'='/alloc) to assign "objPtr=NULL" in "add_object_dtor()"
+          if(DC->objects[DC->total_objects-1].is_alloced_class_pointer) {
+            sb_printf(&method_buff, " if(%s){", DC->objects[DC->total_objects-1].object_name);
+          // if obj a ctor'd ptr but not alloc'd, still assign dangling ptr to NULL prior any CTOR's
+          } else if(DC->objects[DC->total_objects-1].is_class_pointer) {
+            sb_printf(&method_buff, " %s=NULL;", DC->objects[DC->total_objects-1].object_name);
+            DC->objects[DC->total_objects-1].is_dangling_ctord_ptr = true;
+          }
+          // only add dflt vals for non-ptrs or memory-allocated pointers
+          if(!DC->objects[DC->total_objects-1].is_class_pointer || DC->objects[DC->total_objects-1].is_alloced_class_pointer) {
+            if(DC->objects[DC->total_objects-1].is_class_array)        // object = array, use array macro init
+              sb_printf(&method_buff, " DC__%s_ARR(%s);", 
+                DC->classes[k].class_name, DC->objects[DC->total_objects-1].object_name);
+            else if(DC->objects[DC->total_objects-1].is_class_pointer) // object != array & is ptr, so use single-object macro init
+              sb_printf(&method_buff, " DC__%s_CTOR((*%s));%s->DC_DTR=&DC__NDTR;", 
+                DC->classes[k].class_name, DC->objects[DC->total_objects-1].object_name, DC->objects[DC->total_objects-1].object_name);
+            else                                               // object != array, so use single-object macro init
+              sb_printf(&method_buff, " DC__%s_CTOR(%s);", 
+                DC->classes[k].class_name, DC->objects[DC->total_objects-1].object_name);
+          }
+          // add user-defined ctor invocation w/ initialization values (if present)
+          if(user_ctor_invoked) sb_printf(&method_buff, " %s", user_ctor); 
+          // if an obj ptr allocing memory, close the "if != null" braced-condition
+          if(DC->objects[DC->total_objects-1].is_alloced_class_pointer) sb_putc(&method_buff, '}');
+          add_object_dtor(end, false, false);
+        } while(false);
+
+        // write out dtors spliced in after any object declaration just parsed
+        emit_dtor_splices(end, &method_buff);
+
         // either add method word to 'method_words[][]' or prepend 'this->' to member
-        if(in_token_scope) {
-          if(!VARCHAR(*(end-1)) && (*(end-1) != '\'' || (*(end-2) == '\\' && *(end-3) != '\\')) && VARCHAR(*end)) word_start = end; // beginning of word
-          if(VARCHAR(*end) && !VARCHAR(*(end + 1))) { // end of word - member or var
-            // check if a member of the current/local class
-            int i = 0;
-            for(; i < classes[total_classes].total_members; ++i) {
-              if(classes[total_classes].member_names[i][0] == 0) continue; // struct member -- disregard
-              char *endOfMember = word_start + strlen(classes[total_classes].member_names[i]);
-              char nextChar = *endOfMember, period = *(endOfMember + 1);   // either a word or class' struct member invoked
-              // word is a member of the local class -- prefix 'this->'
-              if(valid_member(word_start - 1, classes[total_classes].member_names[i], 
-                nextChar, period, method_words, word_size)) {
-
-                splice_in_this_arrowPtr(method_buff_idx);
-                method_buff_idx += strlen(method_buff_idx);
-                break;
-              }
+        if(!VARCHAR(*(end-1)) && (*(end-1) != '\'' || (*(end-2) == '\\' && *(end-3) != '\\')) && VARCHAR(*end)) word_start = end; // beginning of word
+        if(VARCHAR(*end) && !VARCHAR(*(end + 1))) { // end of word - member or var
+          // check if a member of the current/local class
+          int i = 0;
+          for(; i < DC->classes[DC->total_classes].total_members; ++i) {
+            if(DC->classes[DC->total_classes].member_names[i][0] == 0) continue; // struct member -- disregard
+            char *endOfMember = word_start + strlen(DC->classes[DC->total_classes].member_names[i]);
+            char nextChar = *endOfMember, period = *(endOfMember + 1);   // either a word or class' struct member invoked
+            // word is a member of the local class -- prefix 'this->'
+            if(valid_member(word_start - 1, DC->classes[DC->total_classes].member_names[i], 
+              nextChar, period, method_words, word_size)) {
+
+              splice_in_this_arrowPtr(&method_buff);
+              break;
             }
-            // not a member - thus add arg word to 'method_words[][]'
-            if(i == classes[total_classes].total_members) add_method_word(method_words, &word_size, word_start, end); 
           }
+          // not a member - thus add arg word to 'method_words[][]'
+          if(i == DC->classes[DC->total_classes].total_members) add_method_word(method_words, &word_size, word_start, end); 
         }
 
         // prepend methods invoked within methods with the appropriate 'className'_
-        int method_buff_idx_position = strlen(method_buff) + 1;
-        int nested_method_size = (in_token_scope)
-          ? parse_method_invocation(end, method_buff_idx, &method_buff_idx_position, true, method_words)
-          : 0;
+        int nested_method_size = parse_method_invocation(end, &method_buff, true, method_words);
         end += nested_method_size, class_size += nested_method_size;
 
         // check whether nested method or not
-        if(nested_method_size > 0) {
-          method_buff_idx += strlen(method_buff_idx);
-        } else {
-
+        if(nested_method_size == 0) {
           // check whether nested method, but for local class (ie NOT for another object)
-          int local_nested_method_size = (in_token_scope) 
-            ? parse_local_nested_method(end, method_buff_idx, class_name, method_words) 
-            : 0;
-          if(local_nested_method_size > 0) {
-            end += local_nested_method_size, class_size += local_nested_method_size;
-            method_buff_idx += strlen(method_buff_idx);
-          }
-          *method_buff_idx++ = *end++, ++class_size;
+          int local_nested_method_size = parse_local_nested_method(end, &method_buff, class_name, method_words);
+          end += local_nested_method_size, class_size += local_nested_method_size;
+          sb_putc(&method_buff, *end++), ++class_size;
         }
       }
       if(method_is_ctor) { // return object at the end of user-defined ctors for default assignment
-        sprintf(method_buff_idx - 1, "\treturn *this;\n\t}");
-        method_buff_idx += strlen(method_buff_idx);
+        sb_truncate(&method_buff, method_buff.len - 1);
+        sb_append(&method_buff, "\treturn *this;\n\t}");
       }
+      pop_object_scope();
       start_of_line = end; // start next line after method
     } 
-    *struct_buff_idx++ = *end++;
+    sb_putc(&struct_buff, *end++);
     ++class_size;
   }
 
   // provide a default destructor/constructor if left undefined by user
-  char default_ctor_dtor[MAX_METHOD_BYTES_PER_CLASS];
-  FLOOD_ZEROS(default_ctor_dtor, MAX_METHOD_BYTES_PER_CLASS);
-  char *default_cd = default_ctor_dtor;
+  struct string_builder default_ctor_dtor = {NULL, 0, 0};
 
   // add a default destructor to invoke any dtors of contained objects if user left dtor undefined
-  if(!classes[total_classes].class_has_dtor) {
-    sprintf(default_cd, "\nvoid DC__NOT_%s_(%s *this) {", class_name, class_name);
-    default_cd += strlen(default_cd);
-    for(int k = 0; k < classes[total_classes].total_members; ++k) {
+  if(!DC->classes[DC->total_classes].class_has_dtor) {
+    sb_printf(&default_ctor_dtor, "\nvoid DC__NOT_%s_(%s *this) {", class_name, class_name);
+    for(int k = 0; k < DC->classes[DC->total_classes].total_members; ++k) {
       // if found a mortal & non-pointer class member object
-      if(!classes[total_classes].member_is_immortal[k] 
-        && classes[total_classes].member_object_class_name[k][0] != 0
-        && !classes[total_classes].member_is_pointer[k]) {
-        if(classes[total_classes].member_is_array[k])        // dtor contained object array
-          sprintf(default_cd, "\n\tDC__%s_UDTOR_ARR(this->%s);", 
-            classes[total_classes].member_object_class_name[k], classes[total_classes].member_names[k]);
-        else if(classes[total_classes].member_is_pointer[k]) // dtor contained single object
-          sprintf(default_cd, "\n\tDC__NOT_%s_(this->%s);", 
-            classes[total_classes].member_object_class_name[k], classes[total_classes].member_names[k]);
+      if(!DC->classes[DC->total_classes].member_is_immortal[k] 
+        && DC->classes[DC->total_classes].member_object_class_name[k][0] != 0
+        && !DC->classes[DC->total_classes].member_is_pointer[k]) {
+        if(DC->classes[DC->total_classes].member_is_array[k])        // dtor contained object array
+          sb_printf(&default_ctor_dtor, "\n\tDC__%s_UDTOR_ARR(this->%s);", 
+            DC->classes[DC->total_classes].member_object_class_name[k], DC->classes[DC->total_classes].member_names[k]);
+        else if(DC->classes[DC->total_classes].member_is_pointer[k]) // dtor contained single object
+          sb_printf(&default_ctor_dtor, "\n\tDC__NOT_%s_(this->%s);", 
+            DC->classes[DC->total_classes].member_object_class_name[k], DC->classes[DC->total_classes].member_names[k]);
         else                                                 // dtor contained single object
-          sprintf(default_cd, "\n\tDC__NOT_%s_(&(this->%s));", 
-            classes[total_classes].member_object_class_name[k], classes[total_classes].member_names[k]);
-        default_cd += strlen(default_cd);
+          sb_printf(&default_ctor_dtor, "\n\tDC__NOT_%s_(&(this->%s));", 
+            DC->classes[DC->total_classes].member_object_class_name[k], DC->classes[DC->total_classes].member_names[k]);
       }
     }
-    sprintf(default_cd, "\n}");
-    default_cd += strlen(default_cd);
-    classes[total_classes].class_has_dtor = true;
+    sb_append(&default_ctor_dtor, "\n}");
+    DC->classes[DC->total_classes].class_has_dtor = true;
   }
 
   // add a default constructor to always allow "()" invocation as well as w/o "()" if user left ctor undefined
-  if(!classes[total_classes].class_has_ctor) {
-    sprintf(default_cd, "\n%s DC_%s_(%s*this){return*this;}", 
+  if(!DC->classes[DC->total_classes].class_has_ctor) {
+    sb_printf(&default_ctor_dtor, "\n%s DC_%s_(%s*this){return*this;}", 
       class_name, class_name, class_name);
-    default_cd += strlen(default_cd);
-    classes[total_classes].class_has_ctor = true;
+    DC->classes[DC->total_classes].class_has_ctor = true;
   }
 
   // add a so-called "dummy" object-less constructor(s) to return an object:
   // used as an assignment value, denoted as "className objName = className(args);" 
   // with the "dummy ctor" in this example being on the RHS
-  mk_dummy_ctor_macros(default_cd, class_name);
+  mk_dummy_ctor_macros(&default_ctor_dtor, class_name);
 
-  // clean-up formatting of struct & method buffers
-  sprintf(struct_buff_idx, " %s;", class_name);
-  *method_buff_idx = '\0';
+  // clean-up formatting of struct buffer
+  sb_printf(&struct_buff, " %s;", class_name);
 
   ++end, ++class_size; // skip '};'
   if(*(end - 1) == ';') ++end, ++class_size;
 
-  // copy the constructor macros, class-converted-to-struct, & spliced-out methods to 'NEW_FILE'
-  char macro_ctor_comment[MAX_TOKEN_NAME_LENGTH * 2], macro_dtor_comment[MAX_TOKEN_NAME_LENGTH * 2];
-  char struct_comment[MAX_TOKEN_NAME_LENGTH * 2], method_comment[MAX_TOKEN_NAME_LENGTH * 2], dflt_comment[MAX_TOKEN_NAME_LENGTH * 2];
-  FLOOD_ZEROS(macro_ctor_comment, MAX_TOKEN_NAME_LENGTH * 2); FLOOD_ZEROS(macro_dtor_comment, MAX_TOKEN_NAME_LENGTH * 2);
-  FLOOD_ZEROS(struct_comment, MAX_TOKEN_NAME_LENGTH * 2); FLOOD_ZEROS(method_comment, MAX_TOKEN_NAME_LENGTH * 2); 
-  FLOOD_ZEROS(dflt_comment, MAX_TOKEN_NAME_LENGTH * 2);
-  sprintf(macro_ctor_comment, "/* \"%s\" CLASS DEFAULT VALUE MACRO CONSTRUCTORS: */\n", class_name);
-  sprintf(macro_dtor_comment, "\n/* \"%s\" CLASS OBJECT ARRAY MACRO DESTRUCTOR: */\n", class_name);
-  sprintf(struct_comment, "\n\n/* \"%s\" CLASS CONVERTED TO STRUCT: */\n", class_name);
-  sprintf(method_comment, "\n\n/* \"%s\" CLASS METHODS SPLICED OUT: */", class_name);
-  sprintf(dflt_comment, "\n\n/* DEFAULT PROVIDED \"%s\" CLASS CONSTRUCTOR/DESTRUCTOR: */", class_name);
-
   // make a global class object with default values to initialize client's unassigned class objects with
-  char initial_values_brace[1000];
-  FLOOD_ZEROS(initial_values_brace, 1000);
-  mk_initialization_brace(initial_values_brace, total_classes);
-  char class_global_initializer[6000];
-  FLOOD_ZEROS(class_global_initializer, 6000);
-  mk_class_global_initializer(class_global_initializer, class_name, initial_values_brace);
-
-  // make macro ctors to assign any objects of this class its default values, as well as
-  // initialize any contained class object members too - both for single & array instances of objects
-  char ctor_macros[6000];
-  FLOOD_ZEROS(ctor_macros, 6000); mk_ctor_macros(ctor_macros, class_name); 
-
-  // make macro dtor to invoke user-defined (or default if undefined by user) dtor across an array of objects
-  char dtor_array_macro[6000];
-  FLOOD_ZEROS(dtor_array_macro, 6000); 
-  mk_dtor_array_macro(dtor_array_macro, class_name); 
+  struct string_builder initial_values_brace = {NULL, 0, 0};
+  mk_initialization_brace(&initial_values_brace, DC->total_classes);
 
+  // copy the constructor macros, class-converted-to-struct, & spliced-out methods directly to 'NEW_FILE':
   // struct before methods to use class/struct type for method's 'this' ptr args
-  if(strlen(struct_buff) > 0) {
-    APPEND_STR_TO_NEW_FILE("/******************************** CLASS START ********************************/\n");
-    APPEND_STR_TO_NEW_FILE(macro_ctor_comment); APPEND_STR_TO_NEW_FILE(ctor_macros);
-    APPEND_STR_TO_NEW_FILE(macro_dtor_comment); APPEND_STR_TO_NEW_FILE(dtor_array_macro);
-    APPEND_STR_TO_NEW_FILE(struct_comment); APPEND_STR_TO_NEW_FILE(struct_buff);
-    APPEND_STR_TO_NEW_FILE(class_global_initializer);
-    APPEND_STR_TO_NEW_FILE(dflt_comment); APPEND_STR_TO_NEW_FILE(default_ctor_dtor);
-    if(strlen(method_buff)>0)APPEND_STR_TO_NEW_FILE(method_comment);APPEND_STR_TO_NEW_FILE(method_buff);
-    APPEND_STR_TO_NEW_FILE("\n/********************************* CLASS END *********************************/");
-  }
-
-  total_classes++;
+  if(struct_buff.len > 0) {
+    sb_append(NEW_FILE, "/******************************** CLASS START ********************************/\n");
+    // make macro ctors to assign any objects of this class its default values, as well as
+    // initialize any contained class object members too - both for single & array instances of objects
+    sb_printf(NEW_FILE, "/* \"%s\" CLASS DEFAULT VALUE MACRO CONSTRUCTORS: */\n", class_name);
+    mk_ctor_macros(NEW_FILE, class_name);
+    // make macro dtor to invoke user-defined (or default if undefined by user) dtor across an array of objects
+    sb_printf(NEW_FILE, "\n/* \"%s\" CLASS OBJECT ARRAY MACRO DESTRUCTOR: */\n", class_name);
+    mk_dtor_array_macro(NEW_FILE, class_name);
+    sb_printf(NEW_FILE, "\n\n/* \"%s\" CLASS CONVERTED TO STRUCT: */\n", class_name);
+    sb_appendn(NEW_FILE, struct_buff.str, struct_buff.len);
+    mk_class_global_initializer(NEW_FILE, class_name, initial_values_brace.str);
+    if(DC->classes[DC->total_classes].class_is_pooled) {
+      sb_printf(NEW_FILE, "\n\n/* \"%s\" CLASS OBJECT POOL DECLARATIONS: */", class_name);
+      mk_class_pool_decls(NEW_FILE, class_name);
+    }
+    sb_printf(NEW_FILE, "\n\n/* DEFAULT PROVIDED \"%s\" CLASS CONSTRUCTOR/DESTRUCTOR: */", class_name);
+    if(default_ctor_dtor.len > 0) sb_appendn(NEW_FILE, default_ctor_dtor.str, default_ctor_dtor.len);
+    if(method_buff.len > 0) {
+      sb_printf(NEW_FILE, "\n\n/* \"%s\" CLASS METHODS SPLICED OUT: */", class_name);
+      sb_appendn(NEW_FILE, method_buff.str, method_buff.len);
+    }
+    if(DC->classes[DC->total_classes].class_is_pooled) {
+      sb_printf(NEW_FILE, "\n\n/* \"%s\" CLASS OBJECT POOL (FREE LIST OF CACHE-LINE-ALIGNED SLABS): */", class_name);
+      mk_class_pool_fcns(NEW_FILE, class_name);
+    }
+    sb_append(NEW_FILE, "\n/********************************* CLASS END *********************************/");
+  }
+  sb_free(&method_buff); sb_free(&struct_buff);
+  sb_free(&default_ctor_dtor); sb_free(&initial_values_brace);
+  free_token_stream(&tokens);
+
+  DC->total_classes++;
+  reserve_class_tables(0, 0, 0); // room for the next class parsed
   return class_size;
   #undef skip_over_blank_lines
 }
@@ -3437,157 +6414,183 @@ int parse_class(char *class_instance, char *NEW_FILE, int *j) {
  ************************************************************************************/
 
 /* STRING, CHAR, AND GLOBAL SCOPES STATUS UPDATING && STRING HELPER FUNCTIONS */
-void handle_string_char_brace_scopes(bool*, bool*, int*, char*);
+static void handle_string_char_brace_scopes(bool*, bool*, int*, char*);
 /* COMMENT & MACRO-BODY SKIP/CPY FUNCTIONS */
-char *cola_skip_comments(char*, char*);
-char *skip_macro_body(char*);
+static char *cola_skip_comments(char*, char*);
+static char *skip_macro_body(char*);
+/* COLA TABLE GROWTH & DEFAULT VALUE INTERNING FUNCTIONS */
+static void *reserve_table(void*, int*, int, size_t);
+static char *intern_dflt_value(char*, int);
 /* "fmacs" (FUNCTION MACRO INSTANCES) STRUCT HELPER FUNCTIONS */
-int non_prototype_duplicate_instance_in_fmacs(char*, int);
-bool overloaded_name_already_in_fmacs(char*);
-void update_all_name_overloaded_status(char*);
-void get_fmac_name(char*, char*);
+static int non_prototype_duplicate_instance_in_fmacs(char*, int);
+static bool overloaded_name_already_in_fmacs(char*);
+static void update_all_name_overloaded_status(char*);
+static void get_fmac_name(char*, char*);
 /* MACRO INSTANCE & FUNCTIONLIKENESS EVALUATION FUNCTIONS */
-bool is_at_macro_name(char*);
-bool macro_is_functionlike(char*);
+static bool is_at_macro_name(char*);
+static bool macro_is_functionlike(char*);
 /* "overload_fmacs" (FUNCTION MACRO OVERLOAD INSTANCES) STRUCT HELPER FUNCTIONS */
-bool name_not_in_overload_fmacs(char*);
-int overload_fmacs_instance_idx(int);
+static bool name_not_in_overload_fmacs(char*);
+static int overload_fmacs_instance_idx(int);
 /* O/P ALIGNMENT SPACE-PADDING FUNCTIONS */
-int max_fmacs_name_length();
-int max_overload_fmacs_name_length();
-int max_dflts_name_length();
-void print_space_padding(int, int);
+#ifndef DECLASS_LIBRARY
+static int max_fmacs_name_length();
+static int max_overload_fmacs_name_length();
+static int max_dflts_name_length();
+static void print_space_padding(int, int);
+#endif
 /* MESSAGING FUNCTIONS */
-void COLA_in_ASCII();
-void terminate_program(char*);
-void throw_fatal_error_variadic_overload(char*, char*, int);
-void throw_fatal_error_duplicate_overload(char*, int, char*, int);
-void throw_fatal_error_undefined_arg_length_invocation(char*, int, char*, int);
-void throw_fatal_error_non_functional_invocation_of_overload_or_dflt_name(char*, char*, int);
-void throw_fatal_error_invalid_default_arg_value(char*, bool, int);
-void throw_fatal_error_ambiguous_overload(char*, int, int, int, int, int);
+#ifndef DECLASS_LIBRARY
+static void COLA_in_ASCII();
+#endif
+static void terminate_program(char*);
+static void throw_fatal_error_variadic_overload(char*, char*, int);
+static void throw_fatal_error_duplicate_overload(char*, int, char*, int);
+static void throw_fatal_error_undefined_arg_length_invocation(char*, int, char*, int);
+static void throw_fatal_error_non_functional_invocation_of_overload_or_dflt_name(char*, char*, int);
+static void throw_fatal_error_invalid_default_arg_value(char*, bool, int);
+static void throw_fatal_error_ambiguous_overload(char*, int, int, int, int, int);
 /* FUNCTION/MACRO ARGUMENT COUNTING FUNCTION */
-int count_args(char*, char*, bool, int);
+static int count_args(char*, char*, bool, int);
 /* FUNCTION-PROTOTYPE CHECKING FUNCTION */
-bool is_function_prototype(char*);
+static bool is_function_prototype(char*);
 /* MAIN ACCOUNTING FUNCTION FOR FUNCTION/MACRO DEFINITIONS IN FILE */
-void register_all_global_function_macro_defs(char*);
+static void register_all_global_function_macro_defs(char*);
+static void register_global_function_macro(char*, char*, char*, int, bool, bool);
+/* "DECLASS_H_" HEADER SPAN REGISTRATION RECORDING & REPLAYING FUNCTIONS */
+static void record_DECLASS_H_fmac(struct parsed_header*, long, char*, char*, int, bool, bool);
+static void stop_recording_DECLASS_H_fmacs(char*, struct header_segment*, char*, int);
+static bool replay_DECLASS_H_fmacs(char*, struct header_segment*);
+static bool args_are_variadic(char*);
 /* FILTER OVERLOADED FCNS/MACROS FROM "FMACS" INTO "OVERLOAD_FMACS" STRUCTURE */
-void filter_overloads_from_FMACS_to_OVERLOAD_FMACS();
+static void filter_overloads_from_FMACS_to_OVERLOAD_FMACS();
 /* PREFIX FUNCTION/MACRO OVERLOAD INSTANCES & SPLICE IN DEFAULT FUNCTION VALS */
-void prefix_overloaded_and_splice_default_value_instances(char*, char*);
+static void prefix_overloaded_and_splice_default_value_instances(char*, struct string_builder*);
 /* DEFAULT VALUE "unique_dflt_fcns" (HAS DFLT FCN INSTANCES) STRUCT HELPER FCNS */
-bool name_not_in_unique_dflt_fcns(char*);
-int unique_dflt_fcns_instance_idx(int);
-int total_dflts_for_ARG_SIZE_fcn_instance_in_UNIQUE_DFLT_FCNS(int, int);
+static bool name_not_in_unique_dflt_fcns(char*);
+static int unique_dflt_fcns_instance_idx(int);
+static int total_dflts_for_ARG_SIZE_fcn_instance_in_UNIQUE_DFLT_FCNS(int, int);
 /* DEFAULT VALUE FILTER FCN FROM "ALL_DFLT_FCNS" INTO "UNIQUE_DFLT_FCNS" STRUCT */
-void filter_defaulted_fcns_from_ALL_DFLT_FCNS_to_UNIQUE_DFLT_FCNS();
+static void filter_defaulted_fcns_from_ALL_DFLT_FCNS_to_UNIQUE_DFLT_FCNS();
 /* DEFAULT VALUE FCNS CONFIRMING DFLT != PRIOR NON-DFLT, IN MACRO, OR AMBIGUOUS */
-void confirm_no_ambiguous_overloaded_default_values();
-bool ambiguous_overload(int, int, int, int);
-void confirm_valid_default_values_position(int, char*, bool);
+static void confirm_no_ambiguous_overloaded_default_values();
+static bool ambiguous_overload(int, int, int, int);
+static void confirm_valid_default_values_position(int, char*, bool);
 /* DEFAULT VALUE STORING IN "all_dflt_fcns" & WHITING-OUT FROM ARG LIST FUNCTION */
-int store_dflt_value(int, char*);
+static int store_dflt_value(int, char*);
 
 /******************************************************************************
 * MAIN EXECUTION OF "C OVERLOADED LENGTH ARGUMENTS" PARSER
 ******************************************************************************/
 
-// Main Execution for the "declass.c"-Adapted "cola.c" overloading parser
+#ifndef DECLASS_LIBRARY
+// Main Execution for the "declass.c"-Adapted "cola.c" overloading parser, given the "precola"
+// declassified text of "declass_filename" (only on disk if "saved_precola", IE "-save-temps")
 // Returns Whether or not COLA Overloads Were Found
-bool COLA_C_main_execution(bool show_cola_info, char *declass_filename) { 
-  char read[MAX_FILESIZE], write[MAX_FILESIZE];
+static bool COLA_C_main_execution(bool show_cola_info, char *declass_filename, struct string_builder *precola, bool saved_precola) { 
+  struct string_builder write = {NULL, 0, 0};
   char filename[MAX_TOKEN_NAME_LENGTH], original_filename_DECLASS[MAX_TOKEN_NAME_LENGTH];
-  FLOOD_ZEROS(read, MAX_FILESIZE); FLOOD_ZEROS(write, MAX_FILESIZE);
   FLOOD_ZEROS(filename, MAX_TOKEN_NAME_LENGTH); FLOOD_ZEROS(original_filename_DECLASS, MAX_TOKEN_NAME_LENGTH);
   strcpy(filename, declass_filename);                  // copy original filename
   strcpy(original_filename_DECLASS, declass_filename); // copy original filename
-  FSCRAPE(read, filename); // read file
-
-  register_all_global_function_macro_defs(read);    // parse all global fcns/macros
-  filter_defaulted_fcns_from_ALL_DFLT_FCNS_to_UNIQUE_DFLT_FCNS(); // filter dflt-arg'd fcns, grouping together any overloads
-  filter_overloads_from_FMACS_to_OVERLOAD_FMACS();  // filter fcns/macros, only keeping overloads
-  confirm_no_ambiguous_overloaded_default_values(); // confirm no dflt'd fcn & possible overload invocation signature ambiguity
-
-  bool found_overloads = (overload_fmacs_size > 0);
-  bool found_defaults  = (unique_dflt_fcns_size > 0);
 
-  if(found_overloads || found_defaults) {
-    prefix_overloaded_and_splice_default_value_instances(read, write); // prefix all overloads "DC__<arg#>_"
-    COLA_in_ASCII();
-  }
+  COLA_C_overload(precola->str, &write);
+  bool found_overloads = (DC->overload_fmacs_size > 0);
+  bool found_defaults  = (DC->unique_dflt_fcns_size > 0);
+  if(found_overloads || found_defaults) COLA_in_ASCII();
   
   // show cola overload/registered global fcn/macro data (if "-l" flag active)
   if(show_cola_info) {
     int max = 0, i = 0, j = 0, k = 0;
     if(found_overloads) {
       max = max_overload_fmacs_name_length();
-      printf("\n\033[1m>> \033[4mOVERLOADS\033[0m\033[1m:\033[0m\n");
-      for(i = 0; i < overload_fmacs_size; ++i) {
-        printf("   %02d) \033[1m\033[4mNAME\033[0m \"%s\"", i + 1, overload_fmacs[i].name);
-        print_space_padding(strlen(overload_fmacs[i].name), max);
-        printf(" \033[1m\033[4mOVERLOAD ARG LENGTHS\033[0m");      
-        for(j = 0; j < overload_fmacs[i].arg_sizes_length; ++j) {
-          printf(" %d", overload_fmacs[i].arg_sizes[j]);
-          if(j < overload_fmacs[i].arg_sizes_length - 1) printf(",");
+      fprintf(DC_STDOUT, "\n\033[1m>> \033[4mOVERLOADS\033[0m\033[1m:\033[0m\n");
+      for(i = 0; i < DC->overload_fmacs_size; ++i) {
+        fprintf(DC_STDOUT, "   %02d) \033[1m\033[4mNAME\033[0m \"%s\"", i + 1, DC->overload_fmacs[i].name);
+        print_space_padding(strlen(DC->overload_fmacs[i].name), max);
+        fprintf(DC_STDOUT, " \033[1m\033[4mOVERLOAD ARG LENGTHS\033[0m");      
+        for(j = 0; j < DC->overload_fmacs[i].arg_sizes_length; ++j) {
+          fprintf(DC_STDOUT, " %d", DC->overload_fmacs[i].arg_sizes[j]);
+          if(j < DC->overload_fmacs[i].arg_sizes_length - 1) fprintf(DC_STDOUT, ",");
         }
-        printf("\n");
+        fprintf(DC_STDOUT, "\n");
       }
     }
 
     if(found_defaults) {
       max = max_dflts_name_length();
-      printf("\n\033[1m>> \033[4mDEFAULTS\033[0m\033[1m:\033[0m\n");
-      for(i = 0; i < unique_dflt_fcns_size; ++i) {
-        printf("   %02d) \033[1m\033[4mNAME\033[0m \"%s\"", i + 1, unique_dflt_fcns[i].name);
-        print_space_padding(strlen(unique_dflt_fcns[i].name), max);
-        printf(" \033[1m\033[4mDEFAULT FCN ARG VALUES\033[0m \033[1m(\033[4mFcn1\033[0m\033[1m)\033[0m");
-        for(j = 0; j < unique_dflt_fcns[i].arg_sizes_length; ++j) {
-          for(k = 0; k < unique_dflt_fcns[i].total_dflts[j]; ++k) {
-            printf(" %s", unique_dflt_fcns[i].dflt_vals[j][k]);
-            if(k < unique_dflt_fcns[i].total_dflts[j] - 1) printf(",");
+      fprintf(DC_STDOUT, "\n\033[1m>> \033[4mDEFAULTS\033[0m\033[1m:\033[0m\n");
+      for(i = 0; i < DC->unique_dflt_fcns_size; ++i) {
+        fprintf(DC_STDOUT, "   %02d) \033[1m\033[4mNAME\033[0m \"%s\"", i + 1, DC->unique_dflt_fcns[i].name);
+        print_space_padding(strlen(DC->unique_dflt_fcns[i].name), max);
+        fprintf(DC_STDOUT, " \033[1m\033[4mDEFAULT FCN ARG VALUES\033[0m \033[1m(\033[4mFcn1\033[0m\033[1m)\033[0m");
+        for(j = 0; j < DC->unique_dflt_fcns[i].arg_sizes_length; ++j) {
+          for(k = 0; k < DC->unique_dflt_fcns[i].total_dflts[j]; ++k) {
+            fprintf(DC_STDOUT, " %s", DC->unique_dflt_fcns[i].dflt_vals[j][k]);
+            if(k < DC->unique_dflt_fcns[i].total_dflts[j] - 1) fprintf(DC_STDOUT, ",");
           }
-          if(j < unique_dflt_fcns[i].arg_sizes_length - 1) printf(", \033[1m(\033[4mFcn2\033[0m\033[1m)\033[0m");
+          if(j < DC->unique_dflt_fcns[i].arg_sizes_length - 1) fprintf(DC_STDOUT, ", \033[1m(\033[4mFcn2\033[0m\033[1m)\033[0m");
         }
-        printf("\n");
+        fprintf(DC_STDOUT, "\n");
       }
     }
 
     max = max_fmacs_name_length();
-    printf("\n\033[1m>> \033[4mALL REGISTERED GLOBAL FCNS/MACROS\033[0m\033[1m:\033[0m\n");
-    for(i = 0; i < fmacs_size; ++i) {
-      printf("   %02d) \033[1m\033[4mNAME\033[0m \"%s\", ", i + 1, fmacs[i].name);
-      print_space_padding(strlen(fmacs[i].name), max);
-      printf("\033[1m\033[4mIS PROTOTYPE\033[0m %d, \033[1m\033[4mTOTAL ARGS\033[0m %d\n", 
-        fmacs[i].is_a_prototype, fmacs[i].args);
+    fprintf(DC_STDOUT, "\n\033[1m>> \033[4mALL REGISTERED GLOBAL FCNS/MACROS\033[0m\033[1m:\033[0m\n");
+    for(i = 0; i < DC->fmacs_size; ++i) {
+      fprintf(DC_STDOUT, "   %02d) \033[1m\033[4mNAME\033[0m \"%s\", ", i + 1, DC->fmacs[i].name);
+      print_space_padding(strlen(DC->fmacs[i].name), max);
+      fprintf(DC_STDOUT, "\033[1m\033[4mIS PROTOTYPE\033[0m %d, \033[1m\033[4mTOTAL ARGS\033[0m %d\n", 
+        DC->fmacs[i].is_a_prototype, DC->fmacs[i].args);
     }
   }
 
   // output results or rename file if no overloads
-  if(overload_fmacs_size > 0) {
-    printf("\n=================================================================================\n");
-    printf("%s ==\033[1mCOLA\033[0m=\033[1mOVERLOAD\033[0m=> ", filename);
+  if(DC->overload_fmacs_size > 0) {
+    fprintf(DC_STDOUT, "\n=================================================================================\n");
+    if(saved_precola) fprintf(DC_STDOUT, "%s ", filename); // only name the pre-COLA file if it was written
+    fprintf(DC_STDOUT, "==\033[1mCOLA\033[0m=\033[1mOVERLOAD\033[0m=> ");
     strcpy(&filename[strlen(filename)-10], ".c\0");
-    printf("%s", filename);
-    if(NO_COMPILE || show_cola_info) printf("\n=================================================================================\n");
-    FPUT(write, filename);
+    fprintf(DC_STDOUT, "%s", filename);
+    if(DC->NO_COMPILE || show_cola_info) fprintf(DC_STDOUT, "\n=================================================================================\n");
+    FPUT(write.str, write.len, filename);
   } else { // no need to convert file w/o overloads
     const char *bold_underline = "\033[1m\033[4m";
-    if(show_cola_info) printf("\n================================================================================");
-    printf("\n\033[1m>> declass.c: cola.c: \033[4mNO\033[0m %sOVERLOADS\033[0m %sOR\033[0m %sDEFAULTS\033[0m %sDETECTED\033[0m\033[1m!\033[0m\n",
+    if(show_cola_info) fprintf(DC_STDOUT, "\n================================================================================");
+    fprintf(DC_STDOUT, "\n\033[1m>> declass.c: cola.c: \033[4mNO\033[0m %sOVERLOADS\033[0m %sOR\033[0m %sDEFAULTS\033[0m %sDETECTED\033[0m\033[1m!\033[0m\n",
       bold_underline, bold_underline, bold_underline, bold_underline);
     strcpy(&original_filename_DECLASS[strlen(original_filename_DECLASS)-10], ".c"); // convert "DECLASS_PRECOLA.c" => "DECLASS.c"
-    printf("\033[1m>> Renaming \"\033[0m%s\033[1m\" to \"\033[0m%s\033[1m\"\033[0m\n", filename, original_filename_DECLASS);
-    if(rename(filename, original_filename_DECLASS) != 0) {
-      fprintf(stderr, 
-        "\n\033[1m >> declass.c: cola.c:%03d: \033[33mWARNING\033[0m\033[1m ERROR TRYING TO RENAME \"%s\" TO RMV THE \"_PRECOLA\" POSTFIX!\033[0m", 
-        __LINE__, filename);
-      fprintf(stderr, "\n                       \033[1mKEEPING \"%s\" AS THE OFFICAL DECLASSIFIED FILENAME!\033[0m\n", filename);
+    if(!saved_precola) { // write the unchanged declassified text straight out
+      fprintf(DC_STDOUT, "\033[1m>> Writing \"\033[0m%s\033[1m\"\033[0m\n", original_filename_DECLASS);
+      FPUT(precola->str, precola->len, original_filename_DECLASS);
+    } else {
+      fprintf(DC_STDOUT, "\033[1m>> Renaming \"\033[0m%s\033[1m\" to \"\033[0m%s\033[1m\"\033[0m\n", filename, original_filename_DECLASS);
+      char resolved[PATH_MAX], resolved_DECLASS[PATH_MAX];
+      if(rename(resolve_path(filename, resolved), resolve_path(original_filename_DECLASS, resolved_DECLASS)) != 0) {
+        fprintf(DC_STDERR, 
+          "\n\033[1m >> declass.c: cola.c:%03d: \033[33mWARNING\033[0m\033[1m ERROR TRYING TO RENAME \"%s\" TO RMV THE \"_PRECOLA\" POSTFIX!\033[0m", 
+          __LINE__, filename);
+        fprintf(DC_STDERR, "\n                       \033[1mKEEPING \"%s\" AS THE OFFICAL DECLASSIFIED FILENAME!\033[0m\n", filename);
+      }
     }
-    if(show_cola_info) printf("================================================================================\n");
+    if(show_cola_info) fprintf(DC_STDOUT, "================================================================================\n");
   }
 
-  return (overload_fmacs_size > 0);
+  sb_free(&write);
+  return (DC->overload_fmacs_size > 0);
+}
+#endif
+
+// overloads & splices dflt values into "read", writing to "write" if any found
+// Returns Whether or not COLA Overloads Were Found
+static bool COLA_C_overload(char *read, struct string_builder *write) {
+  register_all_global_function_macro_defs(read);    // parse all global fcns/macros
+  filter_defaulted_fcns_from_ALL_DFLT_FCNS_to_UNIQUE_DFLT_FCNS(); // filter dflt-arg'd fcns, grouping together any overloads
+  filter_overloads_from_FMACS_to_OVERLOAD_FMACS();  // filter fcns/macros, only keeping overloads
+  confirm_no_ambiguous_overloaded_default_values(); // confirm no dflt'd fcn & possible overload invocation signature ambiguity
+  if(DC->overload_fmacs_size > 0 || DC->unique_dflt_fcns_size > 0)
+    prefix_overloaded_and_splice_default_value_instances(read, write); // prefix all overloads "DC__<arg#>_"
+  return (DC->overload_fmacs_size > 0);
 }
 
 /******************************************************************************
@@ -3595,9 +6598,9 @@ bool COLA_C_main_execution(bool show_cola_info, char *declass_filename) {
 ******************************************************************************/
 
 // handle incrementing/decrementing status of whether "r" currently in a string, char, or in a braced-scope
-void handle_string_char_brace_scopes(bool *in_a_string, bool *in_a_char, int *in_global_scope, char *r) {
-  if(!(*in_a_char)   && *r == '"'  && (*(r-1) != '\\' || *(r-2) == '\\')) *in_a_string = !(*in_a_string); // confirm whether in a string or not
-  if(!(*in_a_string) && *r == '\'' && (*(r-1) != '\\' || *(r-2) == '\\')) *in_a_char   = !(*in_a_char);   // confirm whether in a char or not
+static void handle_string_char_brace_scopes(bool *in_a_string, bool *in_a_char, int *in_global_scope, char *r) {
+  if(!(*in_a_char)   && *r == '"'  && !is_escaped(r)) *in_a_string = !(*in_a_string); // confirm whether in a string or not
+  if(!(*in_a_string) && *r == '\'' && !is_escaped(r)) *in_a_char   = !(*in_a_char);   // confirm whether in a char or not
   if(!(*in_a_string) && !(*in_a_char) && *r == '{') ++ *in_global_scope; // update braces scope
   if(!(*in_a_string) && !(*in_a_char) && *r == '}') -- *in_global_scope; // update braces scope
 }
@@ -3607,7 +6610,7 @@ void handle_string_char_brace_scopes(bool *in_a_string, bool *in_a_char, int *in
 ******************************************************************************/
 
 // if at a comment instance in "*read" skips over them (& copies to "*write" "write" != NULL)
-char *cola_skip_comments(char *read, char *write) {
+static char *cola_skip_comments(char *read, char *write) {
   bool cpy_comments = (write != NULL);            // otherwise only skip over
   if(*read == '/' && *(read + 1) == '/') {        // single-line comment
     if(cpy_comments) *write++ = *read++, *write++ = *read++, *write++ = *read++; else read += 3; // skip/copy initial "//"
@@ -3625,7 +6628,7 @@ char *cola_skip_comments(char *read, char *write) {
 }
 
 // invoked at a macro, skips macro body's contents
-char *skip_macro_body(char *read) {
+static char *skip_macro_body(char *read) {
   bool in_a_string = false, in_a_char = false;
   int in_global_scope = 0, in_arg_scope = 1;
   ++read; // skip initial '('
@@ -3642,34 +6645,87 @@ char *skip_macro_body(char *read) {
   return read;
 }
 
+/******************************************************************************
+* COLA TABLE GROWTH & DEFAULT VALUE INTERNING FUNCTIONS
+******************************************************************************/
+
+// returns 'table' (w/ '*max' elems of 'size' bytes) grown geometrically to hold 'len' elems, zeroing new elems
+static void *reserve_table(void *table, int *max, int len, size_t size) {
+  if(len <= *max) return table;
+  int new_max = (*max == 0) ? 16 : *max;
+  while(new_max < len) new_max *= 2;
+  char *grown = realloc(table, size * new_max);
+  if(grown == NULL) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:cola.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR FCN/MACRO TABLE!\033[0m\n\n", __LINE__);
+    declass_exit(EXIT_FAILURE);
+  }
+  memset(&grown[size * *max], 0, size * (new_max - *max));
+  *max = new_max;
+  return grown;
+}
+
+// returns the interned copy of the 1st 'len' chars of 'value' (allocated only the 1st time it's seen)
+static char *intern_dflt_value(char *value, int len) {
+  if(2 * (DC->DFLT_VALUES.total + 1) > DC->DFLT_VALUES.max) { // rehash into twice the slots
+    struct interned_strings grown = {NULL, DC->DFLT_VALUES.total, (DC->DFLT_VALUES.max == 0) ? 64 : DC->DFLT_VALUES.max * 2};
+    if((grown.strs = calloc(grown.max, sizeof(char *))) == NULL) {
+      fprintf(DC_STDERR, "\n\033[1mdeclass.c:cola.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR DEFAULT VALUES!\033[0m\n\n", __LINE__);
+      declass_exit(EXIT_FAILURE);
+    }
+    for(int i = 0, slot; i < DC->DFLT_VALUES.max; ++i)
+      if(DC->DFLT_VALUES.strs[i] != NULL) {
+        slot = hash_token(DC->DFLT_VALUES.strs[i], strlen(DC->DFLT_VALUES.strs[i])) & (grown.max - 1);
+        while(grown.strs[slot] != NULL) slot = (slot + 1) & (grown.max - 1);
+        grown.strs[slot] = DC->DFLT_VALUES.strs[i];
+      }
+    free(DC->DFLT_VALUES.strs);
+    DC->DFLT_VALUES = grown;
+  }
+  int slot = hash_token(value, len) & (DC->DFLT_VALUES.max - 1);
+  for(; DC->DFLT_VALUES.strs[slot] != NULL; slot = (slot + 1) & (DC->DFLT_VALUES.max - 1))
+    if(strncmp(DC->DFLT_VALUES.strs[slot], value, len) == 0 && DC->DFLT_VALUES.strs[slot][len] == '\0')
+      return DC->DFLT_VALUES.strs[slot];
+  if((DC->DFLT_VALUES.strs[slot] = malloc(len + 1)) == NULL) {
+    fprintf(DC_STDERR, "\n\033[1mdeclass.c:cola.c:%03d: \033[31mERROR\033[0m\033[1m COULDN'T ALLOCATE MEMORY FOR DEFAULT VALUES!\033[0m\n\n", __LINE__);
+    declass_exit(EXIT_FAILURE);
+  }
+  memcpy(DC->DFLT_VALUES.strs[slot], value, len);
+  DC->DFLT_VALUES.strs[slot][len] = '\0';
+  ++DC->DFLT_VALUES.total;
+  return DC->DFLT_VALUES.strs[slot];
+}
+
 /******************************************************************************
 * "fmacs" (FUNCTION MACRO INSTANCES) STRUCT HELPER FUNCTIONS
 ******************************************************************************/
 
 // checks whether exact same fcn/macro already in fmacs (w/ same arg # thus NOT an overload)
-int non_prototype_duplicate_instance_in_fmacs(char *name, int total_args) {
-  for(int i = 0; i < fmacs_size; ++i) 
-    if(strcmp(fmacs[i].name, name) == 0 && fmacs[i].args == total_args) 
+static int non_prototype_duplicate_instance_in_fmacs(char *name, int total_args) {
+  int name_idx = identifier_id(name, strlen(name));
+  if(name_idx == -1) return -1;
+  for(int i = DC->cola_names[name_idx].newest_fmac; i != -1; i = DC->fmacs[i].next_same_name) 
+    if(DC->fmacs[i].args == total_args) 
       return i;
   return -1;
 }
 
 // checks whether same fcn/macro name already in fmacs
-bool overloaded_name_already_in_fmacs(char *name) {
-  for(int i = 0; i < fmacs_size; ++i) 
-    if(strcmp(fmacs[i].name, name) == 0) return true;
-  return false;
+static bool overloaded_name_already_in_fmacs(char *name) {
+  int name_idx = identifier_id(name, strlen(name));
+  return (name_idx != -1 && DC->cola_names[name_idx].newest_fmac != -1);
 }
 
 // given a name of a confirmed overloaded fcn/macro instance, updates "overloaded"
 // status of all its previously registered overloaded variants
-void update_all_name_overloaded_status(char *name) {
-  for(int i = 0; i < fmacs_size; ++i) 
-    if(strcmp(fmacs[i].name, name) == 0) fmacs[i].overloaded = true;
+static void update_all_name_overloaded_status(char *name) {
+  int name_idx = identifier_id(name, strlen(name));
+  if(name_idx == -1) return;
+  for(int i = DC->cola_names[name_idx].newest_fmac; i != -1; i = DC->fmacs[i].next_same_name) 
+    DC->fmacs[i].overloaded = true;
 }
 
 // cpys the macro/fcn name from "read" to "name"
-void get_fmac_name(char *read, char *name) {
+static void get_fmac_name(char *read, char *name) {
   while(!VARCHAR(*read)) --read; // move to end of fcn/macro name
   while(VARCHAR(*read))  --read; // move directly prior fcn/macro name
   ++read;                        // move to beginning of fcn/macro name
@@ -3682,7 +6738,7 @@ void get_fmac_name(char *read, char *name) {
 ******************************************************************************/
 
 // given a ptr to initial '(', returns whether or not "read" name is that of a macro
-bool is_at_macro_name(char *read) {
+static bool is_at_macro_name(char *read) {
   while(!VARCHAR(*read))      --read; // skip past '('
   while(VARCHAR(*read))       --read; // skip past possible macro name
   while(IS_WHITESPACE(*read)) --read; // skip past whitespace btwn "#define" (OR fcn type) & name
@@ -3692,7 +6748,7 @@ bool is_at_macro_name(char *read) {
 
 // confirm macro is "functionlike", ie has both a list of args btwn "()" 
 // as well as a non-whitespace & non-comment "macro body" (else can't overload)
-bool macro_is_functionlike(char *read) { 
+static bool macro_is_functionlike(char *read) { 
   ++read; // skip initial '('
   bool in_a_string = false, in_a_char = false;
   int in_global_scope = 0, in_arg_scope = 1;
@@ -3718,90 +6774,89 @@ bool macro_is_functionlike(char *read) {
 ******************************************************************************/
 
 // checks whether same fcn/macro name already in overload_fmacs
-bool name_not_in_overload_fmacs(char *name) {
-  for(int i = 0; i < overload_fmacs_size; ++i) 
-    if(strcmp(overload_fmacs[i].name, name) == 0) return false;
-  return true;
+static bool name_not_in_overload_fmacs(char *name) {
+  int name_idx = identifier_id(name, strlen(name));
+  return (name_idx == -1 || DC->cola_names[name_idx].overload_idx == -1);
 }
 
 // returns idx of fcn/macro arg-length overload instance if instance doesn't 
 // already have "fmacs[fmacs_idx].args" in "arg_sizes[]", & returns -1 if 
 // already found (ie if already stored its name & arg # instance from a prototype)
-int overload_fmacs_instance_idx(int fmacs_idx) {
-  for(int j = 0, k; j < overload_fmacs_size; ++j) 
-    if(strcmp(overload_fmacs[j].name, fmacs[fmacs_idx].name) == 0) {
-      // search instance's overloaded arg lengths for "fmacs[fmacs_idx].args"
-      for(k = 0; k < overload_fmacs[j].arg_sizes_length; ++k)
-        if(fmacs[fmacs_idx].args == overload_fmacs[j].arg_sizes[k]) break;
-      // if "fmacs[fmacs_idx].args" not found, return instance idx to 
-      // add # of args as a new overload to "overload_fmacs" instance's "arg_sizes[]"
-      return (k == overload_fmacs[j].arg_sizes_length) ? j : -1;
-    }
-  // the following "return -1;" is never triggered -- would indicate "fmacs[fmacs_idx].name" 
-  // isn't in the "overload_fmacs" struct, BUT this function is only triggered if the name IS in 
-  // "overload_fmacs" as per the "name_not_in_overload_fmacs" function above returning "false"
-  return -1; 
+static int overload_fmacs_instance_idx(int fmacs_idx) {
+  int name_idx = identifier_id(DC->fmacs[fmacs_idx].name, strlen(DC->fmacs[fmacs_idx].name)), j, k;
+  // only triggered if the name IS in "overload_fmacs" as per "name_not_in_overload_fmacs" returning "false"
+  if(name_idx == -1 || (j = DC->cola_names[name_idx].overload_idx) == -1) return -1;
+  // search instance's overloaded arg lengths for "fmacs[fmacs_idx].args"
+  for(k = 0; k < DC->overload_fmacs[j].arg_sizes_length; ++k)
+    if(DC->fmacs[fmacs_idx].args == DC->overload_fmacs[j].arg_sizes[k]) break;
+  // if "fmacs[fmacs_idx].args" not found, return instance idx to 
+  // add # of args as a new overload to "overload_fmacs" instance's "arg_sizes[]"
+  return (k == DC->overload_fmacs[j].arg_sizes_length) ? j : -1;
 }
 
 /******************************************************************************
 * O/P ALIGNMENT SPACE-PADDING FUNCTIONS
 ******************************************************************************/
 
+#ifndef DECLASS_LIBRARY
 // get the max fcn/macro name length in "fmacs" struct
-int max_fmacs_name_length() {
+static int max_fmacs_name_length() {
   int max = 0, length;
-  for(int i = 0; i < fmacs_size; ++i)
-    if((length = strlen(fmacs[i].name)) > max) max = length;
+  for(int i = 0; i < DC->fmacs_size; ++i)
+    if((length = strlen(DC->fmacs[i].name)) > max) max = length;
   return max;
 }
 
 // get the max fcn/macro name length in "overload_fmacs" struct
-int max_overload_fmacs_name_length() {
+static int max_overload_fmacs_name_length() {
   int max = 0, length;
-  for(int i = 0; i < fmacs_size; ++i)
-    if((length = strlen(overload_fmacs[i].name)) > max) max = length;
+  for(int i = 0; i < DC->overload_fmacs_size; ++i)
+    if((length = strlen(DC->overload_fmacs[i].name)) > max) max = length;
   return max;
 }
 
 // get the max fcn name length in "unique_dflt_fcns" struct
-int max_dflts_name_length() {
+static int max_dflts_name_length() {
   int max = 0, length;
-  for(int i = 0; i < unique_dflt_fcns_size; ++i)
-    if((length = strlen(unique_dflt_fcns[i].name)) > max) max = length;
+  for(int i = 0; i < DC->unique_dflt_fcns_size; ++i)
+    if((length = strlen(DC->unique_dflt_fcns[i].name)) > max) max = length;
   return max;
 }
 
 // print spaces to pad btwn the 1st column of names & the 2nd data column to align output
-void print_space_padding(int length, int max) {
-  for(int i = length; i < max; ++i) printf(" ");
+static void print_space_padding(int length, int max) {
+  for(int i = length; i < max; ++i) fprintf(DC_STDOUT, " ");
 }
+#endif
 
 /******************************************************************************
 * MESSAGING FUNCTIONS
 ******************************************************************************/
 
+#ifndef DECLASS_LIBRARY
 // "COLA" in ASCII
-void COLA_in_ASCII() {
+static void COLA_in_ASCII() {
   const char *NONE = "\033[0m";                      // clear syntax settings
   const char *BOLD = "\033[1m";                      // bold font
   const char *BLUE = "\033[38;5;21m";                // blue font
   const char *RONW = "\033[48;5;231m\033[38;5;196m"; // Red font ON White back
   const char *WONR = "\033[48;5;196m\033[38;5;231m"; // White font ON Red back
-  printf("\n                   /|======================================|\\\n");
-  printf("                   ||%s%s        %s          %s        %s          %sO %s||\n", BOLD, RONW, WONR, RONW, WONR, BLUE, NONE);
-  printf("                   ||%s%s //==\\\\ %s  //==\\\\  %s |\\     %s  //^\\\\  %sOo %s||\n", BOLD, RONW, WONR, RONW, WONR, BLUE, NONE);
-  printf("                   ||%s%s ||  |/ %s ||    || %s ||   _ %s |/===\\| %so  %s||\n", BOLD, RONW, WONR, RONW, WONR, BLUE, NONE);
-  printf("                   ||%s%s ||     %s  \\\\==//  %s ||  || %s ||   || |\\ %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
-  printf("                   ||%s%s \\\\     %s//=====\\\\ %s \\===// %s |/   \\| // %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
-  printf("                   ||%s%s  \\\\===/%s/       \\=%s========%s========//  %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
-  printf("                   ||%s%s        %s          %s        %s            %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
-  printf("                   ||%s%s  O  V  %s  E  R  L %s  O  A  %s  D  E  D ! %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
-  printf("                   ||%s%s        %s          %s        %s            %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
-  printf("                   \\|======================================|/\n");
+  fprintf(DC_STDOUT, "\n                   /|======================================|\\\n");
+  fprintf(DC_STDOUT, "                   ||%s%s        %s          %s        %s          %sO %s||\n", BOLD, RONW, WONR, RONW, WONR, BLUE, NONE);
+  fprintf(DC_STDOUT, "                   ||%s%s //==\\\\ %s  //==\\\\  %s |\\     %s  //^\\\\  %sOo %s||\n", BOLD, RONW, WONR, RONW, WONR, BLUE, NONE);
+  fprintf(DC_STDOUT, "                   ||%s%s ||  |/ %s ||    || %s ||   _ %s |/===\\| %so  %s||\n", BOLD, RONW, WONR, RONW, WONR, BLUE, NONE);
+  fprintf(DC_STDOUT, "                   ||%s%s ||     %s  \\\\==//  %s ||  || %s ||   || |\\ %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
+  fprintf(DC_STDOUT, "                   ||%s%s \\\\     %s//=====\\\\ %s \\===// %s |/   \\| // %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
+  fprintf(DC_STDOUT, "                   ||%s%s  \\\\===/%s/       \\=%s========%s========//  %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
+  fprintf(DC_STDOUT, "                   ||%s%s        %s          %s        %s            %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
+  fprintf(DC_STDOUT, "                   ||%s%s  O  V  %s  E  R  L %s  O  A  %s  D  E  D ! %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
+  fprintf(DC_STDOUT, "                   ||%s%s        %s          %s        %s            %s||\n", BOLD, RONW, WONR, RONW, WONR, NONE);
+  fprintf(DC_STDOUT, "                   \\|======================================|/\n");
 }
+#endif
 
 // fills "bad_code_buffer" with a snippet of the client's invalid code to show in an error message
-void get_invalid_code_snippet(const char *absolute_array_start, const char *scout, char bad_code_buffer[]) {
+static void get_invalid_code_snippet(const char *absolute_array_start, const char *scout, char bad_code_buffer[]) {
   int j;
   char *bcb_ptr = bad_code_buffer;
   // move back then copy the invalid code snippet to show in error message
@@ -3812,86 +6867,86 @@ void get_invalid_code_snippet(const char *absolute_array_start, const char *scou
 }
 
 // outputs "message" to stderr, notifies client of cola.c termination, & exits program
-void terminate_program(char *message) {
-  if(MORTAL_ERRORS) {
-    fprintf(stderr, " >> %s\n", message);
-    printf(" >> CONTINUE DECLASSIFICATION PROCESS? ENTER 1 FOR YES & 0 FOR NO\n\n>>> ");
+static void terminate_program(char *message) {
+  if(DC->MORTAL_ERRORS) {
+    fprintf(DC_STDERR, " >> %s\n", message);
+    fprintf(DC_STDOUT, " >> CONTINUE DECLASSIFICATION PROCESS? ENTER 1 FOR YES & 0 FOR NO\n\n>>> ");
     int continueDeclassification;
     scanf("%d", &continueDeclassification);
     if(continueDeclassification == 1)
-      printf("\n\n-:- CONTINUING DECLASSIFICATION PROCESS - \033[1mI HOPE YOU KNOW WHAT YOU'RE DOING\033[0m -:-\n\n");
+      fprintf(DC_STDOUT, "\n\n-:- CONTINUING DECLASSIFICATION PROCESS - \033[1mI HOPE YOU KNOW WHAT YOU'RE DOING\033[0m -:-\n\n");
     else {
-      printf("\n\n >> Saving declass.c's \"Pre-Cola\" Generated File To Help Client Debug Their Program.\n >> Terminating COLA Processor.\n\n");
-      exit(EXIT_SUCCESS); // having been intentionally terminated
+      fprintf(DC_STDOUT, "\n\n >> Saving declass.c's \"Pre-Cola\" Generated File To Help Client Debug Their Program.\n >> Terminating COLA Processor.\n\n");
+      declass_exit(EXIT_SUCCESS); // having been intentionally terminated
     }
   } else {
-    fprintf(stderr, " >> %s\n >> Saving declass.c's \"Pre-Cola\" Generated File To Help Client Debug Their Program.\n >> Terminating COLA Processor.\n\n",
+    fprintf(DC_STDERR, " >> %s\n >> Saving declass.c's \"Pre-Cola\" Generated File To Help Client Debug Their Program.\n >> Terminating COLA Processor.\n\n",
       message);
-    exit(EXIT_FAILURE);
+    declass_exit(EXIT_FAILURE);
   }
 }
 
 // invoked by finding an overloaded variadic macro/fcn
-void throw_fatal_error_variadic_overload(char *name, char *bad_code_buffer, int line_No) {
-  fprintf(stderr, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m INVALID VARIADIC FCN/MACRO OVERLOAD DETECTED!\n\033[0m", line_No);
-  fprintf(stderr, " >> NAME OF VARIADIC FCN/MACRO: \"%s\"\n", name);
-  fprintf(stderr, " >> SNIPPET OF THE FILE'S INVALID VARIADIC OVERLOAD:\n");
-  fprintf(stderr, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
+static void throw_fatal_error_variadic_overload(char *name, char *bad_code_buffer, int line_No) {
+  fprintf(DC_STDERR, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m INVALID VARIADIC FCN/MACRO OVERLOAD DETECTED!\n\033[0m", line_No);
+  fprintf(DC_STDERR, " >> NAME OF VARIADIC FCN/MACRO: \"%s\"\n", name);
+  fprintf(DC_STDERR, " >> SNIPPET OF THE FILE'S INVALID VARIADIC OVERLOAD:\n");
+  fprintf(DC_STDERR, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
   terminate_program("VARIADIC FCNS/MACROS \033[1mCANNOT\033[0m BE OVERLOADED!");
 }
 
 // invoked by detecting overloaded fcn/macro name instance w/ an already existing number of args
-void throw_fatal_error_duplicate_overload(char *name, int arg_total, char *bad_code_buffer, int line_No) {
-  fprintf(stderr, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m DUPLICATE FCN/MACRO ARGUMENT-LENGTH OVERLOAD DETECTED!\n\033[0m", line_No);
-  fprintf(stderr, " >> NAME & ARG-LENGTH DUPLICATE INSTANCE OF AN ALREADY EXISTING ARG-LENGTH OVERLOAD: \"%s\", ARG LENGTH: %d.\n", name, arg_total);
-  fprintf(stderr, " >> SNIPPET OF THE FILE'S DUPLICATE FCN/MACRO ARGUMENT-LENGTH OVERLOAD:\n");
-  fprintf(stderr, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
+static void throw_fatal_error_duplicate_overload(char *name, int arg_total, char *bad_code_buffer, int line_No) {
+  fprintf(DC_STDERR, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m DUPLICATE FCN/MACRO ARGUMENT-LENGTH OVERLOAD DETECTED!\n\033[0m", line_No);
+  fprintf(DC_STDERR, " >> NAME & ARG-LENGTH DUPLICATE INSTANCE OF AN ALREADY EXISTING ARG-LENGTH OVERLOAD: \"%s\", ARG LENGTH: %d.\n", name, arg_total);
+  fprintf(DC_STDERR, " >> SNIPPET OF THE FILE'S DUPLICATE FCN/MACRO ARGUMENT-LENGTH OVERLOAD:\n");
+  fprintf(DC_STDERR, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
   terminate_program("FUNCTIONS/MACROS W/ THE SAME NUMBER OF ARGUMENTS \033[1mCANNOT\033[0m BE OVERLOADED!");
 }
 
 // invoked by detecting fcn/macro name invocation w/ an unaccounted for # of args (global 
 // definition of overloaded fcn/macro instance w/ particular arg length not registered by "overload_fmacs")
-void throw_fatal_error_undefined_arg_length_invocation(char *name, int arg_total, char *bad_code_buffer, int line_No) {
-  fprintf(stderr, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m UNDEFINED OVERLOADED ARG LENGTH INVOCATION!\n\033[0m", line_No);
-  fprintf(stderr, " >> NO GLOBAL FCN/MACRO DEFINITION OR PROTOTYPE MATCHED THE # OF ARGS FOUND IN THE INVOCATION!\n");
-  fprintf(stderr, " >> NAME & ARG-LENGTH OF UNDEFINED OVERLOAD INSTANCE: \"%s\", ARG LENGTH: %d.\n", name, arg_total);
-  fprintf(stderr, " >> SNIPPET OF THE FILE'S UNDEFINED OVERLOADED ARG LENGTH INVOCATION:\n");
-  fprintf(stderr, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
+static void throw_fatal_error_undefined_arg_length_invocation(char *name, int arg_total, char *bad_code_buffer, int line_No) {
+  fprintf(DC_STDERR, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m UNDEFINED OVERLOADED ARG LENGTH INVOCATION!\n\033[0m", line_No);
+  fprintf(DC_STDERR, " >> NO GLOBAL FCN/MACRO DEFINITION OR PROTOTYPE MATCHED THE # OF ARGS FOUND IN THE INVOCATION!\n");
+  fprintf(DC_STDERR, " >> NAME & ARG-LENGTH OF UNDEFINED OVERLOAD INSTANCE: \"%s\", ARG LENGTH: %d.\n", name, arg_total);
+  fprintf(DC_STDERR, " >> SNIPPET OF THE FILE'S UNDEFINED OVERLOADED ARG LENGTH INVOCATION:\n");
+  fprintf(DC_STDERR, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
   terminate_program("ALL FCN/MACRO ARG-LENGTH OVERLOADS MUST BE GLOBALLY DEFINED OR PROTOTYPED!");
 }
 
 // invoked by detecting fcn/macro name invocation w/o any "args list"
-void throw_fatal_error_non_functional_invocation_of_overload_or_dflt_name(char *name, char *bad_code_buffer, int line_No) {
-  fprintf(stderr, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m REDEFINITION OF OVERLOADED/DEFAULT FCN/MACRO ", line_No);
-  fprintf(stderr, "(DETECTED A NON-FUNCTIONAL INVOCATION W/O ARGS & \"()\")!\n\033[0m");
-  fprintf(stderr, " >> NAME OF ARG-LESS REDEFINED OVERLOAD/DEFAULT-ARG-VAL INVOCATION INSTANCE: \"%s\".\n", name);
-  fprintf(stderr, " >> SNIPPET OF THE FILE'S INVALID INVOCATION INSTANCE:\n");
-  fprintf(stderr, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
+static void throw_fatal_error_non_functional_invocation_of_overload_or_dflt_name(char *name, char *bad_code_buffer, int line_No) {
+  fprintf(DC_STDERR, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m REDEFINITION OF OVERLOADED/DEFAULT FCN/MACRO ", line_No);
+  fprintf(DC_STDERR, "(DETECTED A NON-FUNCTIONAL INVOCATION W/O ARGS & \"()\")!\n\033[0m");
+  fprintf(DC_STDERR, " >> NAME OF ARG-LESS REDEFINED OVERLOAD/DEFAULT-ARG-VAL INVOCATION INSTANCE: \"%s\".\n", name);
+  fprintf(DC_STDERR, " >> SNIPPET OF THE FILE'S INVALID INVOCATION INSTANCE:\n");
+  fprintf(DC_STDERR, "\n\033[1m<CODE_SNIPPET>\n\033[7m%s\033[0m\n\033[1m</CODE_SNIPPET>\033[0m\n\n", bad_code_buffer);
   terminate_program("DEFAULT-ARG-VAL FCNS & OVERLOADED FCN/MACRO NAMES \033[1mCANNOT\033[0m BE REDEFINED TO ANY OTHER VARIABLE/FCN-PTR IN ANY OTHER SCOPE!");
 }
 
 // invoked by finding a default value prior to a non-default value in a function's arg list
-void throw_fatal_error_invalid_default_arg_value(char *function_name, bool is_a_macro, int line_No) {
-  fprintf(stderr, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m INVALID DEFAULT ARG ASSIGNMENT!\n\033[0m", line_No);
+static void throw_fatal_error_invalid_default_arg_value(char *function_name, bool is_a_macro, int line_No) {
+  fprintf(DC_STDERR, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m INVALID DEFAULT ARG ASSIGNMENT!\n\033[0m", line_No);
   if(is_a_macro) {
-    fprintf(stderr, " >> DEFAULT VALUE FOR MACRO \"%s\" DETECTED!\n", function_name);
+    fprintf(DC_STDERR, " >> DEFAULT VALUE FOR MACRO \"%s\" DETECTED!\n", function_name);
     terminate_program("ONLY FCNS CAN TAKE DEFAULT VALUES, MACROS \033[1mCANNOT\033[0m!");
   }
-  fprintf(stderr, " >> DETECTED A DEFAULTED ARG PRECEDING A NON-DEFAULTED ARG IN ARG LIST FOR FCN \"%s\"!\n", function_name);
+  fprintf(DC_STDERR, " >> DETECTED A DEFAULTED ARG PRECEDING A NON-DEFAULTED ARG IN ARG LIST FOR FCN \"%s\"!\n", function_name);
   terminate_program("ONLY THE LAST ARGS IN A FCN'S ARG LIST CAN BE DEFAULTED, DEFAULTED ARGS \033[1mCANNOT\033[0m PRECEDE NON-DEFAULTED ARGS!");
 }
 
 // invoked by finding an ambigious invocation signature btwn 2 overloaded fcn instances wrt the implmentation of default values
-void throw_fatal_error_ambiguous_overload(char *function_name, int fcn1_dflts, int fcn1_args, int fcn2_args, int fcn2_dflts, int line_No) {
-  fprintf(stderr, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m AMBIGUOUS OVERLOAD WITH DEFAULT ARG ASSIGNMENT!\n\033[0m", line_No);
-  fprintf(stderr, " >> FCN \"%s\" OVERLOAD & DFLT VALUES MAKE ITS INVOCATION SIGNATURE AMBIGUOUS WRT ITS OTHER OVERLOADS!\n", function_name);
-  fprintf(stderr, " >> DATA FOR THE 2 OVERLOADED FCN INSTANCES W/ CONFLICTING AMBIGUOUS INVOCATIONS:\n    OVERLOAD 1:\n\t    ");
-  fprintf(stderr, "TOTAL ARGS = %d, TOTAL NON-DFLT ARGS = %d, TOTAL DFLT ARGS = %d", fcn1_args, fcn1_args - fcn1_dflts, fcn1_dflts);
-  fprintf(stderr, "\n    OVERLOAD 2:\n\t    TOTAL ARGS = %d, TOTAL NON-DFLT ARGS = %d, TOTAL DFLT ARGS = %d\n", 
+static void throw_fatal_error_ambiguous_overload(char *function_name, int fcn1_dflts, int fcn1_args, int fcn2_args, int fcn2_dflts, int line_No) {
+  fprintf(DC_STDERR, "\033[1m\ndeclass.c:cola.c:%03d: \033[31mERROR:\033[0m\033[1m AMBIGUOUS OVERLOAD WITH DEFAULT ARG ASSIGNMENT!\n\033[0m", line_No);
+  fprintf(DC_STDERR, " >> FCN \"%s\" OVERLOAD & DFLT VALUES MAKE ITS INVOCATION SIGNATURE AMBIGUOUS WRT ITS OTHER OVERLOADS!\n", function_name);
+  fprintf(DC_STDERR, " >> DATA FOR THE 2 OVERLOADED FCN INSTANCES W/ CONFLICTING AMBIGUOUS INVOCATIONS:\n    OVERLOAD 1:\n\t    ");
+  fprintf(DC_STDERR, "TOTAL ARGS = %d, TOTAL NON-DFLT ARGS = %d, TOTAL DFLT ARGS = %d", fcn1_args, fcn1_args - fcn1_dflts, fcn1_dflts);
+  fprintf(DC_STDERR, "\n    OVERLOAD 2:\n\t    TOTAL ARGS = %d, TOTAL NON-DFLT ARGS = %d, TOTAL DFLT ARGS = %d\n", 
     fcn2_args, fcn2_args - fcn2_dflts, fcn2_dflts);
-  fprintf(stderr, " >> ANY OVERLOADED FCN W/ DEFAULT ARG VALUES MUST BE DISCERNABLE BY ADHERING TO EITHER OF THE FOLLOWING:\n");
-  fprintf(stderr, "    (1) HAVING ITS \"TOTAL NON-DFLT ARGS\" EXCEED THE \"TOTAL ARGS\" OF ALL OTHER OVERLOADED FCN INSTANCES\n");
-  fprintf(stderr, "    (2) HAVING ITS \"TOTAL ARGS\" BE LESS THAN THE \"TOTAL NON-DFLT ARGS\" OF ALL OTHER OVERLOADED FCN INSTANCES\n");
+  fprintf(DC_STDERR, " >> ANY OVERLOADED FCN W/ DEFAULT ARG VALUES MUST BE DISCERNABLE BY ADHERING TO EITHER OF THE FOLLOWING:\n");
+  fprintf(DC_STDERR, "    (1) HAVING ITS \"TOTAL NON-DFLT ARGS\" EXCEED THE \"TOTAL ARGS\" OF ALL OTHER OVERLOADED FCN INSTANCES\n");
+  fprintf(DC_STDERR, "    (2) HAVING ITS \"TOTAL ARGS\" BE LESS THAN THE \"TOTAL NON-DFLT ARGS\" OF ALL OTHER OVERLOADED FCN INSTANCES\n");
   terminate_program("EITHER ALTER \"OVERLOAD 2\"'S \"TOTAL ARGS\" # OR RMV ITS ARG(S) DEFAULT VALUE TO HAVE A UNIQUE INVOCATION\n    SIGNATURE!");
 }
 
@@ -3901,13 +6956,13 @@ void throw_fatal_error_ambiguous_overload(char *function_name, int fcn1_dflts, i
 
 // given a ptr at the opening '(', returns the # of args in a fcn/macro
 // & finds default values to be passed to & stored by the "store_dflt_value" fcn
-int count_args(char *r, char *function_name, bool is_a_macro, int overload_fmacs_index) {
+static int count_args(char *r, char *function_name, bool is_a_macro, int overload_fmacs_index) {
   char bad_code_buffer[BAD_CODE_BUFFER_LENGTH]; // used to show snippet of client's code at error
   char *absolute_start = r;
   // default-arg-value handling variables
-  all_dflt_fcns[all_dflt_fcns_size].total_dflts = 0; // total defaults found so far is 0 (just started parsing)
-  strcpy(all_dflt_fcns[all_dflt_fcns_size].fcn_name, function_name);
-  FLOOD_ZEROS(all_dflt_fcns[all_dflt_fcns_size].dflt_idxs, MAX_ARGS_PER_FCN);
+  DC->all_dflt_fcns = reserve_table(DC->all_dflt_fcns, &DC->all_dflt_fcns_max, DC->all_dflt_fcns_size + 1, sizeof(struct function_with_default_value_instance));
+  DC->all_dflt_fcns[DC->all_dflt_fcns_size].total_dflts = 0; // total defaults found so far is 0 (just started parsing)
+  strcpy(DC->all_dflt_fcns[DC->all_dflt_fcns_size].fcn_name, function_name);
   int default_value_length; // length of default arg value to white out
   // arg-counting variables 
   bool in_a_string = false, in_a_char = false;
@@ -3941,18 +6996,18 @@ int count_args(char *r, char *function_name, bool is_a_macro, int overload_fmacs
   // the 2nd round of splicing in overloaded prefixes can't tell us if at a macro or fcn,
   // thus must compare the overloaded name w/ the number of registered args in order to 
   // determine whether or not currently at a macro
-  if(overload_fmacs_index > -1) // in 2nd round of splicing, not parsing overloads
-    for(int i = 0; i < overload_fmacs[overload_fmacs_index].arg_sizes_length; ++i)
-      if(overload_fmacs[overload_fmacs_index].arg_sizes[i] == arg_total) {
-        is_a_macro = overload_fmacs[overload_fmacs_index].is_a_macro[i];
+  if(overload_fmacs_index > -1 && overload_fmacs_index < DC->overload_fmacs_size) // in 2nd round of splicing, not parsing overloads
+    for(int i = 0; i < DC->overload_fmacs[overload_fmacs_index].arg_sizes_length; ++i)
+      if(DC->overload_fmacs[overload_fmacs_index].arg_sizes[i] == arg_total) {
+        is_a_macro = DC->overload_fmacs[overload_fmacs_index].is_a_macro[i];
         break;
       }
   if(overload_fmacs_index == -1) { // in 1st round: parsing
     // throw an error if any defaulted args found prior a non-defaulted arg OR in a macro
     confirm_valid_default_values_position(arg_total, function_name, is_a_macro); 
     // register total # of args & increment fcn counter having completed parsing a fcn arg-list instance
-    all_dflt_fcns[all_dflt_fcns_size].total_args = arg_total;
-    ++ all_dflt_fcns_size;
+    DC->all_dflt_fcns[DC->all_dflt_fcns_size].total_args = arg_total;
+    ++ DC->all_dflt_fcns_size;
   }
   return (*r == '(') ? 0 : arg_total;
 }
@@ -3962,7 +7017,7 @@ int count_args(char *r, char *function_name, bool is_a_macro, int overload_fmacs
 ******************************************************************************/
 
 // given ptr at opening '(' of fcn/macro args list, return whether at a fcn prototype
-bool is_function_prototype(char *r) {
+static bool is_function_prototype(char *r) {
   bool in_a_string = false, in_a_char = false, overload;
   int in_global_scope = 0; // 0 if in global scope, > 0 if in a fcn or any other braces
   int in_arg_scope = 1;
@@ -3984,23 +7039,48 @@ bool is_function_prototype(char *r) {
 ******************************************************************************/
 
 // register all functions & macros declared globally  along w/ their arg # & overloaded 
-// status (fills "fmacs" which then gets filtered into "overload_fmacs" on return to main)
-void register_all_global_function_macro_defs(char *read) {
-  char *r = read, *scout, function_name[MAX_TOKEN_NAME_LENGTH], bad_code_buffer[BAD_CODE_BUFFER_LENGTH];
-  bool in_a_string = false, in_a_char = false, overload, prototype, macro;
-  int in_global_scope = 0; // 0 if in global scope, > 0 if in a fcn or any other braces
-  int arg_total, duplicate_overload;
+// status (fills "fmacs" which then gets filtered into "overload_fmacs" on return to main).
+// "DECLASS_H_" header spans w/ a cached registration are replayed, & uncached ones recorded
+static void register_all_global_function_macro_defs(char *read) {
+  char *r, *skip_to = read, function_name[MAX_TOKEN_NAME_LENGTH];
+  bool prototype, macro;
+  int skipped_depth = 0; // net braces in skipped macro bodies (excluded from the global scope depth)
+  int t, arg_total, segment = 0, recording_depth = 0;
+  struct header_segment *recording = NULL; // header span being recorded
+  struct token_stream stream = {NULL, 0, 0};
+  lex_tokens(read, &stream, false);
 
   // register all function/macro names in file to detect overloads prior to prefixing invocations
-  while(*r != '\0') {
-    handle_string_char_brace_scopes(&in_a_string, &in_a_char, &in_global_scope, r);
-    if(!in_a_string && !in_a_char)
-      r = cola_skip_comments(r, NULL);
-    if(!in_a_string && !in_a_char && in_global_scope == 0 && *r == '(') { // potential function/macro
+  for(t = 0; t < stream.total; ++t) {
+    struct token *token = &stream.tokens[t];
+    r = &read[token->offset];
+    // leaving a header span being recorded, or entering a header span at the global scope
+    if(recording != NULL && token->offset >= recording->end) 
+      stop_recording_DECLASS_H_fmacs(read, recording, skip_to, skipped_depth - recording_depth), recording = NULL;
+    while(segment < DC->total_header_segments && DC->header_segments[segment].end <= token->offset) ++segment;
+    if(segment < DC->total_header_segments && token->offset >= DC->header_segments[segment].start) {
+      struct header_segment *seg = &DC->header_segments[segment++];
+      if(r >= skip_to && token->depth - skipped_depth == 0 && replay_DECLASS_H_fmacs(read, seg)) {
+        skipped_depth += seg->parsed->skipped_depth;
+        while(t + 1 < stream.total && stream.tokens[t + 1].offset < seg->end) ++t;
+        continue;
+      }
+      if(r >= skip_to && token->depth - skipped_depth == 0 && seg->parsed != NULL && !seg->restored) {
+        recording = seg, recording_depth = skipped_depth;
+        sb_appendn(&seg->parsed->precola, &read[seg->start], seg->end - seg->start);
+      }
+    }
+    if(token->kind != TOKEN_PUNCTUATOR) continue;
+    if(r < skip_to) { // in a skipped macro body
+      if(*r == '{') ++skipped_depth; else if(*r == '}') --skipped_depth;
+      continue;
+    }
+    // potential function/macro (unless its '(' was whited-out w/ a dflt value after lexing)
+    if(token->depth - skipped_depth == 0 && *r == '(') { 
       // check if at a macro, & if so confirm its "functionlike" (can't overload non-functionlike macros)
       macro = is_at_macro_name(r);
       if(macro && !macro_is_functionlike(r)) { 
-        r = skip_macro_body(r); 
+        skip_to = skip_macro_body(r); 
         continue; 
       } 
       // copy function name
@@ -4010,31 +7090,123 @@ void register_all_global_function_macro_defs(char *read) {
       arg_total = count_args(r, function_name, macro, -1);
       // check whether at a function prototype
       prototype = is_function_prototype(r);
-      // disregard if function name already exists w/ exact same arg # (ie already registered its prototype)
-      if((duplicate_overload = non_prototype_duplicate_instance_in_fmacs(function_name, arg_total)) != -1) { 
-        if(!fmacs[duplicate_overload].is_a_prototype) { // throw fatal error if not a prototype
-          FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
-          get_invalid_code_snippet(read, r, bad_code_buffer);
-          throw_fatal_error_duplicate_overload(function_name, arg_total, bad_code_buffer, __LINE__);
-        }
-        ++r; 
-        continue;
-      }
-      // check if function overload exists w/ same name BUT different # arg
-      overload = overloaded_name_already_in_fmacs(function_name);
-      if(overload) update_all_name_overloaded_status(function_name);
-      // assign unique fcn/macro instance properties
-      strcpy(fmacs[fmacs_size].name, function_name);
-      fmacs[fmacs_size].args = arg_total;
-      fmacs[fmacs_size].overloaded = overload;
-      fmacs[fmacs_size].is_a_prototype = prototype;
-      fmacs[fmacs_size].is_a_macro = macro;
-      ++fmacs_size;
+      if(recording != NULL) record_DECLASS_H_fmac(recording->parsed, r - &read[recording->start], r, function_name, arg_total, macro, prototype);
+      register_global_function_macro(read, r, function_name, arg_total, macro, prototype);
       // check if at a macro to skip over its body
-      if(macro) r = skip_macro_body(r);
+      if(macro) skip_to = skip_macro_body(r);
+    }
+  }
+  if(recording != NULL) stop_recording_DECLASS_H_fmacs(read, recording, skip_to, skipped_depth - recording_depth);
+  free_token_stream(&stream);
+}
+
+// registers the global fcn/macro "function_name" w/ "arg_total" args (its '(' at 'r' in "read") in "fmacs"
+static void register_global_function_macro(char *read, char *r, char *function_name, int arg_total, bool macro, bool prototype) {
+  char bad_code_buffer[BAD_CODE_BUFFER_LENGTH];
+  int duplicate_overload;
+  // disregard if function name already exists w/ exact same arg # (ie already registered its prototype)
+  if((duplicate_overload = non_prototype_duplicate_instance_in_fmacs(function_name, arg_total)) != -1) { 
+    if(!DC->fmacs[duplicate_overload].is_a_prototype) { // throw fatal error if not a prototype
+      FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
+      get_invalid_code_snippet(read, r, bad_code_buffer);
+      throw_fatal_error_duplicate_overload(function_name, arg_total, bad_code_buffer, __LINE__);
+    }
+    return;
+  }
+  // check if function overload exists w/ same name BUT different # arg
+  bool overload = overloaded_name_already_in_fmacs(function_name);
+  if(overload) update_all_name_overloaded_status(function_name);
+  // assign unique fcn/macro instance properties
+  DC->fmacs = reserve_table(DC->fmacs, &DC->fmacs_max, DC->fmacs_size + 1, sizeof(struct function_macro_instance));
+  strcpy(DC->fmacs[DC->fmacs_size].name, function_name);
+  DC->fmacs[DC->fmacs_size].args = arg_total;
+  DC->fmacs[DC->fmacs_size].overloaded = overload;
+  DC->fmacs[DC->fmacs_size].is_a_prototype = prototype;
+  DC->fmacs[DC->fmacs_size].is_a_macro = macro;
+  int name_idx = intern_identifier(function_name, strlen(function_name)); // chain onto its name's other instances
+  DC->fmacs[DC->fmacs_size].next_same_name = DC->cola_names[name_idx].newest_fmac;
+  DC->cola_names[name_idx].newest_fmac = DC->fmacs_size;
+  ++DC->fmacs_size;
+}
+
+/******************************************************************************
+* "DECLASS_H_" HEADER SPAN REGISTRATION RECORDING & REPLAYING FUNCTIONS
+******************************************************************************/
+
+// records the fcn/macro just registered at 'r' ("offset" into its header's span) in "parsed", 
+// w/ the "all_dflt_fcns" instance "count_args()" just added
+static void record_DECLASS_H_fmac(struct parsed_header *parsed, long offset, char *r, char *function_name, int arg_total, bool macro, bool prototype) {
+  struct function_with_default_value_instance *dflts = &DC->all_dflt_fcns[DC->all_dflt_fcns_size - 1];
+  parsed->fmacs = reserve_table(parsed->fmacs, &parsed->max_fmacs, parsed->total_fmacs + 1, sizeof(struct parsed_fmac));
+  struct parsed_fmac *fmac = &parsed->fmacs[parsed->total_fmacs++];
+  fmac->offset = offset, fmac->args = arg_total;
+  fmac->is_a_macro = macro, fmac->is_a_prototype = prototype, fmac->is_variadic = args_are_variadic(r);
+  strcpy(fmac->dflts.fcn_name, function_name);
+  fmac->dflts.total_args = dflts->total_args;
+  fmac->dflts.dflt_idxs = copy_parse_table(dflts->dflt_idxs, dflts->total_dflts, sizeof(int));
+  fmac->dflts.dflt_vals = copy_parse_table(dflts->dflt_vals, dflts->total_dflts, sizeof(char *));
+  for(fmac->dflts.total_dflts = 0; fmac->dflts.total_dflts < dflts->total_dflts; ++fmac->dflts.total_dflts) // own each value
+    fmac->dflts.dflt_vals[fmac->dflts.total_dflts] = copy_parse_table(dflts->dflt_vals[fmac->dflts.total_dflts], strlen(dflts->dflt_vals[fmac->dflts.total_dflts]) + 1, 1);
+  fmac->dflts.max_dflts = fmac->dflts.total_dflts;
+}
+
+// finishes recording "seg"'s registration (once past its span, at "skip_to" w/ "skipped_depth" net braces
+// skipped since it began): only spans not ending in a skipped macro body can be replayed
+static void stop_recording_DECLASS_H_fmacs(char *read, struct header_segment *seg, char *skip_to, int skipped_depth) {
+  sb_appendn(&seg->parsed->registered, &read[seg->start], seg->end - seg->start);
+  seg->parsed->skipped_depth = skipped_depth;
+  seg->parsed->cola_recorded = (skip_to <= &read[seg->end]);
+}
+
+// if "seg"'s parse recorded a registration of the same text in its span of "read", replays it: registering 
+// its fcns/macros as if parsed & whiting out their dflt values. returns whether it did
+static bool replay_DECLASS_H_fmacs(char *read, struct header_segment *seg) {
+  struct parsed_header *parsed = seg->parsed;
+  char bad_code_buffer[BAD_CODE_BUFFER_LENGTH];
+  if(parsed == NULL || !parsed->cola_recorded || parsed->precola.len != seg->end - seg->start 
+    || memcmp(&read[seg->start], parsed->precola.str, parsed->precola.len) != 0)
+    return false;
+  memcpy(&read[seg->start], parsed->registered.str, parsed->registered.len);
+  for(int i = 0; i < parsed->total_fmacs; ++i) {
+    struct parsed_fmac *fmac = &parsed->fmacs[i];
+    char *r = &read[seg->start + fmac->offset];
+    // as "count_args()" would've: add its "all_dflt_fcns" instance & reject variadic overloads
+    DC->all_dflt_fcns = reserve_table(DC->all_dflt_fcns, &DC->all_dflt_fcns_max, DC->all_dflt_fcns_size + 1, sizeof(struct function_with_default_value_instance));
+    #define current_dflt DC->all_dflt_fcns[DC->all_dflt_fcns_size]
+    int max_dflts = current_dflt.max_dflts;
+    current_dflt.dflt_idxs = reserve_table(current_dflt.dflt_idxs, &max_dflts, fmac->dflts.total_dflts, sizeof(int));
+    current_dflt.dflt_vals = reserve_table(current_dflt.dflt_vals, &current_dflt.max_dflts, fmac->dflts.total_dflts, sizeof(char *));
+    strcpy(current_dflt.fcn_name, fmac->dflts.fcn_name);
+    current_dflt.total_args = fmac->dflts.total_args, current_dflt.total_dflts = fmac->dflts.total_dflts;
+    for(int j = 0; j < fmac->dflts.total_dflts; ++j) {
+      current_dflt.dflt_idxs[j] = fmac->dflts.dflt_idxs[j];
+      current_dflt.dflt_vals[j] = intern_dflt_value(fmac->dflts.dflt_vals[j], strlen(fmac->dflts.dflt_vals[j]));
+    }
+    ++ DC->all_dflt_fcns_size;
+    #undef current_dflt
+    if(fmac->is_variadic && overloaded_name_already_in_fmacs(fmac->dflts.fcn_name)) {
+      FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
+      get_invalid_code_snippet(read, r, bad_code_buffer);
+      throw_fatal_error_variadic_overload(fmac->dflts.fcn_name, bad_code_buffer, __LINE__);
     }
-    if(*r != '\0') ++r;
+    register_global_function_macro(read, r, fmac->dflts.fcn_name, fmac->args, fmac->is_a_macro, fmac->is_a_prototype);
+  }
+  return true;
+}
+
+// given ptr at opening '(' of fcn/macro args list, return whether its args end in "..."
+static bool args_are_variadic(char *r) {
+  bool in_a_string = false, in_a_char = false, variadic = false;
+  int in_global_scope = 0, in_arg_scope = 1;
+  ++r; // move past initial opening '('
+  while(*r != '\0' && in_arg_scope > 0) {
+    handle_string_char_brace_scopes(&in_a_string, &in_a_char, &in_global_scope, r);
+    if(!in_a_string && !in_a_char && *r == '(')      ++in_arg_scope;
+    else if(!in_a_string && !in_a_char && *r == ')') --in_arg_scope;
+    if(!in_a_string && !in_a_char && is_at_substring(r, "...")) variadic = true;
+    ++r;
   }
+  return variadic;
 }
 
 /******************************************************************************
@@ -4042,22 +7214,27 @@ void register_all_global_function_macro_defs(char *read) {
 ******************************************************************************/
 
 // convert "fmacs" struct to "overload_fmacs" struct (disregarding non-overloaded fcns)
-void filter_overloads_from_FMACS_to_OVERLOAD_FMACS() {
+static void filter_overloads_from_FMACS_to_OVERLOAD_FMACS() {
   int i, overload_idx;
-  for(i = 0; i < fmacs_size; ++i) {
-    if(fmacs[i].overloaded && name_not_in_overload_fmacs(fmacs[i].name)) {
+  for(i = 0; i < DC->fmacs_size; ++i) {
+    if(DC->fmacs[i].overloaded && name_not_in_overload_fmacs(DC->fmacs[i].name)) {
       // new function/macro name overload instance
-      strcpy(overload_fmacs[overload_fmacs_size].name, fmacs[i].name);
-      overload_fmacs[overload_fmacs_size].arg_sizes[0] = fmacs[i].args;
-      overload_fmacs[overload_fmacs_size].is_a_macro[0] = fmacs[i].is_a_macro;
-      overload_fmacs[overload_fmacs_size].arg_sizes_length = 1;
-      ++ overload_fmacs_size;
-    } else if(fmacs[i].overloaded && (overload_idx = overload_fmacs_instance_idx(i)) != -1) {
-      // existing function/macro name overload has a new arg-length overload instance
-      overload_fmacs[overload_idx].arg_sizes[overload_fmacs[overload_idx].arg_sizes_length] = fmacs[i].args;
-      overload_fmacs[overload_idx].is_a_macro[overload_fmacs[overload_idx].arg_sizes_length] = fmacs[i].is_a_macro;
-      ++ overload_fmacs[overload_idx].arg_sizes_length;
-    }
+      DC->overload_fmacs = reserve_table(DC->overload_fmacs, &DC->overload_fmacs_max, DC->overload_fmacs_size + 1, sizeof(struct function_macro_overload_instance));
+      overload_idx = DC->overload_fmacs_size++;
+      DC->cola_names[intern_identifier(DC->fmacs[i].name, strlen(DC->fmacs[i].name))].overload_idx = overload_idx;
+      strcpy(DC->overload_fmacs[overload_idx].name, DC->fmacs[i].name);
+      DC->overload_fmacs[overload_idx].arg_sizes_length = 0;
+    } else if(!DC->fmacs[i].overloaded || (overload_idx = overload_fmacs_instance_idx(i)) == -1) 
+      continue;
+    // new or existing function/macro name overload has a new arg-length overload instance
+    #define current_fmac DC->overload_fmacs[overload_idx]
+    int arg_sizes_max = current_fmac.arg_sizes_max;
+    current_fmac.arg_sizes  = reserve_table(current_fmac.arg_sizes, &arg_sizes_max, current_fmac.arg_sizes_length + 1, sizeof(int));
+    current_fmac.is_a_macro = reserve_table(current_fmac.is_a_macro, &current_fmac.arg_sizes_max, current_fmac.arg_sizes_length + 1, sizeof(bool));
+    current_fmac.arg_sizes[current_fmac.arg_sizes_length] = DC->fmacs[i].args;
+    current_fmac.is_a_macro[current_fmac.arg_sizes_length] = DC->fmacs[i].is_a_macro;
+    ++ current_fmac.arg_sizes_length;
+    #undef current_fmac
   }
 }
 
@@ -4068,153 +7245,164 @@ void filter_overloads_from_FMACS_to_OVERLOAD_FMACS() {
 // prefix all invocation/declaration/definition instances of file's registered
 // overloaded fcn/macro names & arg lengths (stored in "overload_fmacs" struct)
 // & splice in default values
-void prefix_overloaded_and_splice_default_value_instances(char *read, char *write) {
-  char *r = read, *w = write, *scout, *next_arg, *arg_end;
+static void prefix_overloaded_and_splice_default_value_instances(char *read, struct string_builder *write) {
+  char *r = read, *w, *name, *scout, *next_arg, *arg_end;
   char bad_code_buffer[BAD_CODE_BUFFER_LENGTH];
-  bool in_a_string = false, in_a_char = false;
-  int i, j, k, arg_total, dflt_args_left, in_arg_scope;
+  bool in_a_string, in_a_char;
+  int i, j, k, t, arg_total, dflt_args_left, in_arg_scope, cola_name;
   int ignore_arg = 0; // "global scope" irrelevant here thus now denoted as "ignore_arg"
-
-  // prefix every overloaded instance w/ "COLA__<No_of_Args>_"
-  while(*r != '\0') {
-    // account for scopes
-    handle_string_char_brace_scopes(&in_a_string, &in_a_char, &ignore_arg, r);
-    if(!in_a_string && !in_a_char)
-      r = cola_skip_comments(r, w), w += strlen(w);
+  long dflts_length;
+  struct token_stream stream = {NULL, 0, 0};
+  lex_tokens(read, &stream, false); // lexed after registering, which whites-out dflt values
+  sb_reserve(write, strlen(read));
+  w = write->str;
+
+  // prefix every overloaded instance w/ "COLA__<No_of_Args>_", copying the spans btwn COLA names whole
+  for(t = 0; t < stream.total; ++t) {
+    name = &read[stream.tokens[t].offset];
+    cola_name = stream.tokens[t].id; // -1 if not an identifier
+    if(name < r || cola_name == -1) continue; // already copied or not a COLA name candidate
+    if(DC->cola_names[cola_name].dflt_idx == -1 && DC->cola_names[cola_name].overload_idx == -1) continue;
+    // copy the span up to the COLA name (& room for any overload prefix below, splices reserve more as they're found)
+    w = sb_reserve_at(write, w, (name - r) + MAX_TOKEN_NAME_LENGTH * 2);
+    memcpy(w, r, name - r), w += name - r, r = name;
+    in_a_string = in_a_char = false;
     // -:- PARSE FOR DEFAULTS -:- 
     // check for potential fcn invocation that has default args values
-    if(!in_a_string && !in_a_char && VARCHAR(*r) && !VARCHAR(*(r-1))) {
-      for(i = 0; i < unique_dflt_fcns_size; ++i) {
-        // potential dflt'd fcn arg val instance
-        if(is_at_substring(r, unique_dflt_fcns[i].name) && !VARCHAR(*(r+strlen(unique_dflt_fcns[i].name)))) { 
-          // get number of args
-          scout = r;
-          while(VARCHAR(*scout))       ++scout; // skip past name
-          while(IS_WHITESPACE(*scout)) ++scout; // skip past optional whitespace btwn name && '('
-          
-          // dflt'd name invocation w/o any args passed btwn "()" afterwards -- COLA names
-          // can NEVER to redefined/reassigned to ANY other variables in ANY other scope
-          if(*scout != '(') {
-            FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
-            get_invalid_code_snippet(read, scout, bad_code_buffer);
-            throw_fatal_error_non_functional_invocation_of_overload_or_dflt_name(unique_dflt_fcns[i].name, bad_code_buffer, __LINE__);
-          }
-          arg_total = count_args(scout, unique_dflt_fcns[i].name, false, i);
+    i = (DC->cola_names[cola_name].dflt_idx != -1) ? DC->cola_names[cola_name].dflt_idx : DC->unique_dflt_fcns_size;
+    if(i < DC->unique_dflt_fcns_size) {
+      do { // dflt'd fcn arg val instance ('break' once handled)
+        // get number of args
+        scout = r;
+        while(VARCHAR(*scout))       ++scout; // skip past name
+        while(IS_WHITESPACE(*scout)) ++scout; // skip past optional whitespace btwn name && '('
+        
+        // dflt'd name invocation w/o any args passed btwn "()" afterwards -- COLA names
+        // can NEVER to redefined/reassigned to ANY other variables in ANY other scope
+        if(*scout != '(') {
+          FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
+          get_invalid_code_snippet(read, scout, bad_code_buffer);
+          throw_fatal_error_non_functional_invocation_of_overload_or_dflt_name(DC->unique_dflt_fcns[i].name, bad_code_buffer, __LINE__);
+        }
+        arg_total = count_args(scout, DC->unique_dflt_fcns[i].name, false, i);
+        w = sb_reserve_at(write, w, (scout - r) + MAX_TOKEN_NAME_LENGTH); // room for prefixed name
 
-          // confirm at a dflt'd instance w/ less args than "dflt-total + nondflt-total" & as least the same args as non-dflt total
-          // if same args as nondflt + dflt, no need to splice in anything
-          for(j = 0; j < unique_dflt_fcns[i].arg_sizes_length; ++j)
-            if(arg_total < unique_dflt_fcns[i].arg_sizes[j] && arg_total >= unique_dflt_fcns[i].arg_sizes[j] - unique_dflt_fcns[i].total_dflts[j])
-              break;
-          if(j == unique_dflt_fcns[i].arg_sizes_length) { // not at a defaulted arg that needs splicing in -- continue onto overload splicing
-            i = unique_dflt_fcns_size;
+        // confirm at a dflt'd instance w/ less args than "dflt-total + nondflt-total" & as least the same args as non-dflt total
+        // if same args as nondflt + dflt, no need to splice in anything
+        for(j = 0; j < DC->unique_dflt_fcns[i].arg_sizes_length; ++j)
+          if(arg_total < DC->unique_dflt_fcns[i].arg_sizes[j] && arg_total >= DC->unique_dflt_fcns[i].arg_sizes[j] - DC->unique_dflt_fcns[i].total_dflts[j])
             break;
-          }
-
-          // prefix dflt'd fcn invocation if its also overloaded
-          for(k = 0; k < overload_fmacs_size; ++k)
-            if(strcmp(overload_fmacs[k].name, unique_dflt_fcns[i].name) == 0) { // dflt'd fcn is also overloaded
-              // prefix overloaded fcn/macro instance's name w/ reserved header & arg number
-              sprintf(w, "DC__%d_%s", unique_dflt_fcns[i].arg_sizes[j], unique_dflt_fcns[i].name);
-              w += strlen(w), r = scout;
-              break;
-            }
-          // copy name if it wasn't prefixed as an overload
-          if(k == overload_fmacs_size) while(*r != '\0' && r != scout) *w++ = *r++;
-          bool IS_DECLASS_GENERATED = is_at_substring(unique_dflt_fcns[i].name, "DC_");
-
-          // copy the args & splice in the appropriate dflt values at the end of the args list
-          in_arg_scope = 1;
-          arg_end = scout++; // move 1 past the opening '('
-          while(*scout != '\0' && in_arg_scope > 0) { // ends w/ 'scout' pointing at ')'
-            handle_string_char_brace_scopes(&in_a_string, &in_a_char, &ignore_arg, scout);
-            if(!in_a_string && !in_a_char && *scout == '(') ++in_arg_scope;
-            else if(!in_a_string && !in_a_char && *scout == ')') --in_arg_scope;
-            else if(!in_a_string && !in_a_char && *scout == ',') arg_end = scout; // end of an argument
-            if(*scout == '\0' || in_arg_scope <= 0) break;
-            ++scout;
-          }
-          // splice in default args
-          // if fcn generated by declass.c, splice in default args 1 position 
-          // prior to the last arg (ie whats being passed to the "*this" ptr for methods)
-          // => declass.c only generates fcns for user-def'd methods & macros for all else,
-          //    thus any instances prefixed w/ "DC_" can be safley assumed to contain a "this"
-          //    ptr at the end of the args list to splice default arg vals in front of
-          if(IS_DECLASS_GENERATED) {
-            while(r != arg_end + 1) *w++ = *r++; // copy args up to right before value being passed as '*this'
-            dflt_args_left = unique_dflt_fcns[i].total_dflts[j] - unique_dflt_fcns[i].arg_sizes[j] + arg_total;
-            for(k = dflt_args_left; k < unique_dflt_fcns[i].total_dflts[j]; ++k) {
-              if(k > dflt_args_left) *w++ = ',';
-              strcpy(w, unique_dflt_fcns[i].dflt_vals[j][k]);
-              w += strlen(w);
-            }
-            next_arg = r; // confirm not at the end of the arg list prior to splicing in another ','
-            while(IS_WHITESPACE(*next_arg)) ++next_arg;
-            if(*next_arg != ')') *w++ = ','; // insert ',' btwn dflt value & '*this'
-            while(r != scout) *w++ = *r++; // copy '*this' arg value
-          } else { // NOT a declass.c generated fcn
-            while(r != scout) *w++ = *r++; // copy args up to right before closing ')'
-            dflt_args_left = unique_dflt_fcns[i].total_dflts[j] - unique_dflt_fcns[i].arg_sizes[j] + arg_total;
-            for(k = dflt_args_left; k < unique_dflt_fcns[i].total_dflts[j]; ++k) {
-              if(arg_total > 0 || k > dflt_args_left) *w++ = ',';
-              strcpy(w, unique_dflt_fcns[i].dflt_vals[j][k]);
-              w += strlen(w);
-            }
-          }
-          *w++ = *r++; // copy closing ')' of args list
+        if(j == DC->unique_dflt_fcns[i].arg_sizes_length) { // not at a defaulted arg that needs splicing in -- continue onto overload splicing
+          i = DC->unique_dflt_fcns_size;
           break;
         }
-      }
-      // if DID find a valid matching dflt fcns (already prefixed it if overloaded above, thus force the next loop iteration)
-      if(i < unique_dflt_fcns_size && *r != '\0') {
-        *w++ = *r++;
-        continue;
-      }
-      
-
-      // -:- PARSE FOR OVERLOADS -:- 
-      // check for potential fcn/macro overload
-      for(i = 0; i < overload_fmacs_size; ++i) {
-        // potential overloaded instance
-        if(is_at_substring(r, overload_fmacs[i].name) && !VARCHAR(*(r+strlen(overload_fmacs[i].name)))) {
-          // get number of args
-          scout = r;
-          while(VARCHAR(*scout))       ++scout; // skip past name
-          while(IS_WHITESPACE(*scout)) ++scout; // skip past optional whitespace btwn name && '('
-          
-          // overload name invocation w/o any args passed btwn "()" afterwards -- COLA names
-          // can NEVER to redefined/reassigned to ANY other variables in ANY other scope
-          if(*scout != '(') {
-            FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
-            get_invalid_code_snippet(read, scout, bad_code_buffer);
-            throw_fatal_error_non_functional_invocation_of_overload_or_dflt_name(overload_fmacs[i].name, bad_code_buffer, __LINE__);
-          }
-          arg_total = count_args(scout, overload_fmacs[i].name, false, i);
-          
-          // confirm an overload instance with "arg_total" args was detected earlier
-          for(j = 0; j < overload_fmacs[i].arg_sizes_length; ++j)
-            if(arg_total == overload_fmacs[i].arg_sizes[j])
-              break;
-
-          // if overloaded instance invocation has an undefined # of args wrt "overload_fmacs",
-          // ie no matching global definition/declaration/prototype found to couple w/ invocation
-          if(j == overload_fmacs[i].arg_sizes_length) {
-            FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
-            get_invalid_code_snippet(read, scout, bad_code_buffer);
-            throw_fatal_error_undefined_arg_length_invocation(overload_fmacs[i].name, arg_total, bad_code_buffer, __LINE__);
-          }
 
+        // prefix dflt'd fcn invocation if its also overloaded
+        if(DC->cola_names[cola_name].overload_idx != -1) { // dflt'd fcn is also overloaded
           // prefix overloaded fcn/macro instance's name w/ reserved header & arg number
-          sprintf(w, "DC__%d_%s", arg_total, overload_fmacs[i].name);
+          sprintf(w, "DC__%d_%s", DC->unique_dflt_fcns[i].arg_sizes[j], DC->unique_dflt_fcns[i].name);
           w += strlen(w), r = scout;
-          break;
+        } else // copy name if it wasn't prefixed as an overload
+          while(*r != '\0' && r != scout) *w++ = *r++;
+        bool IS_DECLASS_GENERATED = is_at_substring(DC->unique_dflt_fcns[i].name, "DC_");
+
+        // copy the args & splice in the appropriate dflt values at the end of the args list
+        in_arg_scope = 1;
+        arg_end = scout++; // move 1 past the opening '('
+        while(*scout != '\0' && in_arg_scope > 0) { // ends w/ 'scout' pointing at ')'
+          handle_string_char_brace_scopes(&in_a_string, &in_a_char, &ignore_arg, scout);
+          if(!in_a_string && !in_a_char && *scout == '(') ++in_arg_scope;
+          else if(!in_a_string && !in_a_char && *scout == ')') --in_arg_scope;
+          else if(!in_a_string && !in_a_char && *scout == ',') arg_end = scout; // end of an argument
+          if(*scout == '\0' || in_arg_scope <= 0) break;
+          ++scout;
         }
-      }
-      if(i == overload_fmacs_size && *r != '\0') *w++ = *r++;
-    } else
+        // room for args & spliced dflt values (+ 1 ',' each)
+        for(dflts_length = 0, k = 0; k < DC->unique_dflt_fcns[i].total_dflts[j]; ++k)
+          dflts_length += strlen(DC->unique_dflt_fcns[i].dflt_vals[j][k]) + 1;
+        w = sb_reserve_at(write, w, (scout - r) + dflts_length + MAX_TOKEN_NAME_LENGTH);
+        // splice in default args
+        // if fcn generated by declass.c, splice in default args 1 position 
+        // prior to the last arg (ie whats being passed to the "*this" ptr for methods)
+        // => declass.c only generates fcns for user-def'd methods & macros for all else,
+        //    thus any instances prefixed w/ "DC_" can be safley assumed to contain a "this"
+        //    ptr at the end of the args list to splice default arg vals in front of
+        if(IS_DECLASS_GENERATED) {
+          while(r != arg_end + 1) *w++ = *r++; // copy args up to right before value being passed as '*this'
+          dflt_args_left = DC->unique_dflt_fcns[i].total_dflts[j] - DC->unique_dflt_fcns[i].arg_sizes[j] + arg_total;
+          for(k = dflt_args_left; k < DC->unique_dflt_fcns[i].total_dflts[j]; ++k) {
+            if(k > dflt_args_left) *w++ = ',';
+            strcpy(w, DC->unique_dflt_fcns[i].dflt_vals[j][k]);
+            w += strlen(w);
+          }
+          next_arg = r; // confirm not at the end of the arg list prior to splicing in another ','
+          while(IS_WHITESPACE(*next_arg)) ++next_arg;
+          if(*next_arg != ')') *w++ = ','; // insert ',' btwn dflt value & '*this'
+          while(r != scout) *w++ = *r++; // copy '*this' arg value
+        } else { // NOT a declass.c generated fcn
+          while(r != scout) *w++ = *r++; // copy args up to right before closing ')'
+          dflt_args_left = DC->unique_dflt_fcns[i].total_dflts[j] - DC->unique_dflt_fcns[i].arg_sizes[j] + arg_total;
+          for(k = dflt_args_left; k < DC->unique_dflt_fcns[i].total_dflts[j]; ++k) {
+            if(arg_total > 0 || k > dflt_args_left) *w++ = ',';
+            strcpy(w, DC->unique_dflt_fcns[i].dflt_vals[j][k]);
+            w += strlen(w);
+          }
+        }
+        *w++ = *r++; // copy closing ')' of args list
+        break;
+      } while(false);
+    }
+    // if DID find a valid matching dflt fcns (already prefixed it if overloaded above, thus force the next loop iteration)
+    if(i < DC->unique_dflt_fcns_size && *r != '\0') {
       *w++ = *r++;
+      continue;
+    }
+    
+
+    // -:- PARSE FOR OVERLOADS -:- 
+    // check for potential fcn/macro overload
+    i = (DC->cola_names[cola_name].overload_idx != -1) ? DC->cola_names[cola_name].overload_idx : DC->overload_fmacs_size;
+    if(i < DC->overload_fmacs_size) {
+      do { // overloaded instance ('break' once handled)
+        // get number of args
+        scout = r;
+        while(VARCHAR(*scout))       ++scout; // skip past name
+        while(IS_WHITESPACE(*scout)) ++scout; // skip past optional whitespace btwn name && '('
+        
+        // overload name invocation w/o any args passed btwn "()" afterwards -- COLA names
+        // can NEVER to redefined/reassigned to ANY other variables in ANY other scope
+        if(*scout != '(') {
+          FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
+          get_invalid_code_snippet(read, scout, bad_code_buffer);
+          throw_fatal_error_non_functional_invocation_of_overload_or_dflt_name(DC->overload_fmacs[i].name, bad_code_buffer, __LINE__);
+        }
+        arg_total = count_args(scout, DC->overload_fmacs[i].name, false, i);
+        
+        // confirm an overload instance with "arg_total" args was detected earlier
+        for(j = 0; j < DC->overload_fmacs[i].arg_sizes_length; ++j)
+          if(arg_total == DC->overload_fmacs[i].arg_sizes[j])
+            break;
+
+        // if overloaded instance invocation has an undefined # of args wrt "overload_fmacs",
+        // ie no matching global definition/declaration/prototype found to couple w/ invocation
+        if(j == DC->overload_fmacs[i].arg_sizes_length) {
+          FLOOD_ZEROS(bad_code_buffer, BAD_CODE_BUFFER_LENGTH);
+          get_invalid_code_snippet(read, scout, bad_code_buffer);
+          throw_fatal_error_undefined_arg_length_invocation(DC->overload_fmacs[i].name, arg_total, bad_code_buffer, __LINE__);
+        }
+
+        // prefix overloaded fcn/macro instance's name w/ reserved header & arg number
+        sprintf(w, "DC__%d_%s", arg_total, DC->overload_fmacs[i].name);
+        w += strlen(w), r = scout;
+        break;
+      } while(false);
+    }
   }
-  *w = '\0';
+  // copy the rest of the file after the last COLA name
+  w = sb_reserve_at(write, w, strlen(r) + 1);
+  strcpy(w, r);
+  write->len = (w - write->str) + strlen(w);
+  free_token_stream(&stream);
 }
 
 /******************************************************************************
@@ -4222,33 +7410,31 @@ void prefix_overloaded_and_splice_default_value_instances(char *read, char *writ
 ******************************************************************************/
 
 // checks whether same fcn name already in "unique_dflt_fcns"
-bool name_not_in_unique_dflt_fcns(char *name) {
-  for(int i = 0; i < unique_dflt_fcns_size; ++i) 
-    if(strcmp(unique_dflt_fcns[i].name, name) == 0) return false;
-  return true;
+static bool name_not_in_unique_dflt_fcns(char *name) {
+  int name_idx = identifier_id(name, strlen(name));
+  return (name_idx == -1 || DC->cola_names[name_idx].dflt_idx == -1);
 }
 
 // returns idx of fcn arg-defaulted fcn instance if instance doesn't already have 
 // "all_dflt_fcns[all_dflt_fcns_idx].total_args" in unique_dflt_fcns's "arg_sizes[]", & returns 
 // -1 if already found (ie if already stored its name & arg # instance from a prototype)
-int unique_dflt_fcns_instance_idx(int all_dflt_fcns_idx) {
-  for(int j = 0, k; j < unique_dflt_fcns_size; ++j) 
-    if(strcmp(unique_dflt_fcns[j].name, all_dflt_fcns[all_dflt_fcns_idx].fcn_name) == 0) {
-      // search instance's arg lengths for "all_dflt_fcns[all_dflt_fcns_idx].total_args"
-      for(k = 0; k < unique_dflt_fcns[j].arg_sizes_length; ++k)
-        if(all_dflt_fcns[all_dflt_fcns_idx].total_args == unique_dflt_fcns[j].arg_sizes[k]) break;
-      // if arg count not found, return instance idx to 
-      // add # of args as a new overload to "unique_dflt_fcns" instance's "arg_sizes[]"
-      return (k == unique_dflt_fcns[j].arg_sizes_length) ? j : -1;
-    }
-  return -1;
+static int unique_dflt_fcns_instance_idx(int all_dflt_fcns_idx) {
+  char *name = DC->all_dflt_fcns[all_dflt_fcns_idx].fcn_name;
+  int name_idx = identifier_id(name, strlen(name)), j, k;
+  if(name_idx == -1 || (j = DC->cola_names[name_idx].dflt_idx) == -1) return -1;
+  // search instance's arg lengths for "all_dflt_fcns[all_dflt_fcns_idx].total_args"
+  for(k = 0; k < DC->unique_dflt_fcns[j].arg_sizes_length; ++k)
+    if(DC->all_dflt_fcns[all_dflt_fcns_idx].total_args == DC->unique_dflt_fcns[j].arg_sizes[k]) break;
+  // if arg count not found, return instance idx to 
+  // add # of args as a new overload to "unique_dflt_fcns" instance's "arg_sizes[]"
+  return (k == DC->unique_dflt_fcns[j].arg_sizes_length) ? j : -1;
 }
 
 // returns the # of dflt'd args for the total # of args instance in "unique_dflt_fcns[unique_dflt_fcns_idx]"
-int total_dflts_for_ARG_SIZE_fcn_instance_in_UNIQUE_DFLT_FCNS(int arg_size, int unique_dflt_fcns_idx) {
-  for(int i = 0; i < unique_dflt_fcns[unique_dflt_fcns_idx].arg_sizes_length; ++i) // for each overloaded & dflt'd instance's arg length
-    if(unique_dflt_fcns[unique_dflt_fcns_idx].arg_sizes[i] == arg_size) // if same number of args, found the fcn instance
-      return unique_dflt_fcns[unique_dflt_fcns_idx].total_dflts[i]; // return how many dflt'd arg values the fcn instance has
+static int total_dflts_for_ARG_SIZE_fcn_instance_in_UNIQUE_DFLT_FCNS(int arg_size, int unique_dflt_fcns_idx) {
+  for(int i = 0; i < DC->unique_dflt_fcns[unique_dflt_fcns_idx].arg_sizes_length; ++i) // for each overloaded & dflt'd instance's arg length
+    if(DC->unique_dflt_fcns[unique_dflt_fcns_idx].arg_sizes[i] == arg_size) // if same number of args, found the fcn instance
+      return DC->unique_dflt_fcns[unique_dflt_fcns_idx].total_dflts[i]; // return how many dflt'd arg values the fcn instance has
   return 0;
 }
 
@@ -4257,31 +7443,34 @@ int total_dflts_for_ARG_SIZE_fcn_instance_in_UNIQUE_DFLT_FCNS(int arg_size, int
 ******************************************************************************/
 
 // convert "all_dflt_fcns" struct to "unique_dflt_fcns" struct (disregarding non-defaulted fcn instances)
-void filter_defaulted_fcns_from_ALL_DFLT_FCNS_to_UNIQUE_DFLT_FCNS() {
-  int i, j, dflts_idx, per_fcn_idx;
-  for(i = 0; i < all_dflt_fcns_size; ++i) {
-    if(all_dflt_fcns[i].total_dflts > 0 && name_not_in_unique_dflt_fcns(all_dflt_fcns[i].fcn_name)) {
+static void filter_defaulted_fcns_from_ALL_DFLT_FCNS_to_UNIQUE_DFLT_FCNS() {
+  int i, dflts_idx, per_fcn_idx, arg_sizes_max;
+  for(i = 0; i < DC->all_dflt_fcns_size; ++i) {
+    if(DC->all_dflt_fcns[i].total_dflts > 0 && name_not_in_unique_dflt_fcns(DC->all_dflt_fcns[i].fcn_name)) {
       // new function name w/ dflt args instance
-      strcpy(unique_dflt_fcns[unique_dflt_fcns_size].name, all_dflt_fcns[i].fcn_name);       // copy new fcn name
-      unique_dflt_fcns[unique_dflt_fcns_size].arg_sizes[0] = all_dflt_fcns[i].total_args;    // copy # of total args
-      unique_dflt_fcns[unique_dflt_fcns_size].arg_sizes_length = 1; // 1st instance of arg list size
-      unique_dflt_fcns[unique_dflt_fcns_size].total_dflts[0] = all_dflt_fcns[i].total_dflts; // copy # of defaulted args
-      for(j = 0; j < all_dflt_fcns[i].total_dflts; ++j) { // copy default arg values & idxs
-        strcpy(unique_dflt_fcns[unique_dflt_fcns_size].dflt_vals[0][j], all_dflt_fcns[i].dflt_vals[j]);
-        unique_dflt_fcns[unique_dflt_fcns_size].dflt_idxs[0][j] = all_dflt_fcns[i].dflt_idxs[j];
-      }
-      ++ unique_dflt_fcns_size;
-    } else if(all_dflt_fcns[i].total_dflts && (dflts_idx = unique_dflt_fcns_instance_idx(i)) != -1) {
-      // existing function name w/ dflt args has a new arg-length overload instance
-      per_fcn_idx = unique_dflt_fcns[dflts_idx].arg_sizes_length;
-      unique_dflt_fcns[dflts_idx].arg_sizes[per_fcn_idx] = all_dflt_fcns[i].total_args;    // copy # of total args
-      unique_dflt_fcns[dflts_idx].total_dflts[per_fcn_idx] = all_dflt_fcns[i].total_dflts; // copy # of defaulted args
-      for(j = 0; j < all_dflt_fcns[i].total_dflts; ++j) { // copy default arg values & idxs
-        strcpy(unique_dflt_fcns[dflts_idx].dflt_vals[per_fcn_idx][j], all_dflt_fcns[i].dflt_vals[j]);
-        unique_dflt_fcns[dflts_idx].dflt_idxs[per_fcn_idx][j] = all_dflt_fcns[i].dflt_idxs[j];
-      }
-      ++ unique_dflt_fcns[dflts_idx].arg_sizes_length;
-    }
+      DC->unique_dflt_fcns = reserve_table(DC->unique_dflt_fcns, &DC->unique_dflt_fcns_max, DC->unique_dflt_fcns_size + 1, sizeof(struct unique_function_default_values));
+      dflts_idx = DC->unique_dflt_fcns_size++;
+      DC->cola_names[intern_identifier(DC->all_dflt_fcns[i].fcn_name, strlen(DC->all_dflt_fcns[i].fcn_name))].dflt_idx = dflts_idx;
+      strcpy(DC->unique_dflt_fcns[dflts_idx].name, DC->all_dflt_fcns[i].fcn_name); // copy new fcn name
+      DC->unique_dflt_fcns[dflts_idx].arg_sizes_length = 0;
+    } else if(!DC->all_dflt_fcns[i].total_dflts || (dflts_idx = unique_dflt_fcns_instance_idx(i)) == -1)
+      continue;
+    // new or existing function name w/ dflt args has a new arg-length overload instance
+    #define current_dflt DC->unique_dflt_fcns[dflts_idx]
+    per_fcn_idx = current_dflt.arg_sizes_length;
+    arg_sizes_max = current_dflt.arg_sizes_max;
+    current_dflt.arg_sizes   = reserve_table(current_dflt.arg_sizes, &arg_sizes_max, per_fcn_idx + 1, sizeof(int));
+    arg_sizes_max = current_dflt.arg_sizes_max;
+    current_dflt.total_dflts = reserve_table(current_dflt.total_dflts, &arg_sizes_max, per_fcn_idx + 1, sizeof(int));
+    arg_sizes_max = current_dflt.arg_sizes_max;
+    current_dflt.dflt_idxs   = reserve_table(current_dflt.dflt_idxs, &arg_sizes_max, per_fcn_idx + 1, sizeof(int *));
+    current_dflt.dflt_vals   = reserve_table(current_dflt.dflt_vals, &current_dflt.arg_sizes_max, per_fcn_idx + 1, sizeof(char **));
+    current_dflt.arg_sizes[per_fcn_idx]   = DC->all_dflt_fcns[i].total_args;  // copy # of total args
+    current_dflt.total_dflts[per_fcn_idx] = DC->all_dflt_fcns[i].total_dflts; // copy # of defaulted args
+    current_dflt.dflt_idxs[per_fcn_idx]   = DC->all_dflt_fcns[i].dflt_idxs;   // share default arg idxs
+    current_dflt.dflt_vals[per_fcn_idx]   = DC->all_dflt_fcns[i].dflt_vals;   // share (interned) default arg values
+    ++ current_dflt.arg_sizes_length;
+    #undef current_dflt
   }
 }
 
@@ -4294,7 +7483,7 @@ void filter_defaulted_fcns_from_ALL_DFLT_FCNS_to_UNIQUE_DFLT_FCNS() {
 //       args (both dflt & not) of all other overloaded instances
 //   (2) an overload's # of cumulative args (both dflt & not) must be less
 //       than the # of non-default args of all other overloaded instances
-bool ambiguous_overload(int overload_fmacs_dflts, int overload_fmacs_arg_size, int unique_dflt_fcns_arg_size, int unique_dflt_fcns_dflts) {
+static bool ambiguous_overload(int overload_fmacs_dflts, int overload_fmacs_arg_size, int unique_dflt_fcns_arg_size, int unique_dflt_fcns_dflts) {
   int overload_fmacs_nondflts   = overload_fmacs_arg_size - overload_fmacs_dflts;
   int unique_dflt_fcns_nondflts = unique_dflt_fcns_arg_size - unique_dflt_fcns_dflts;
   bool more_nondflt_args_than_total_args = (overload_fmacs_nondflts > unique_dflt_fcns_arg_size);
@@ -4303,41 +7492,41 @@ bool ambiguous_overload(int overload_fmacs_dflts, int overload_fmacs_arg_size, i
 }
 
 // confirm no ambigious overloaded definitions wrt assigned default values causing indeterminate fcn invocations
-void confirm_no_ambiguous_overloaded_default_values() {
+static void confirm_no_ambiguous_overloaded_default_values() {
   int overload_fmacs_idx = 0, unique_dflt_fcns_idx, i, j;
   int overload_fmacs_total_dflts;   // # of dflt args for an overload instance
   int unique_dflt_fcns_total_dflts; // # of dflt args for a defaulted instance
   int overload_fmacs_arg_size;      // # of total args for an overload instance
   int unique_dflt_fcns_arg_size;    // # of total args for a defaulted instance
-  for(; overload_fmacs_idx < overload_fmacs_size; ++overload_fmacs_idx) // for each overload
-    for(unique_dflt_fcns_idx = 0; unique_dflt_fcns_idx < unique_dflt_fcns_size; ++unique_dflt_fcns_idx) { // for each defaulted fcn
-      #define current_fmac overload_fmacs[overload_fmacs_idx]
-      #define current_dflt unique_dflt_fcns[unique_dflt_fcns_idx]
-      // if at least 1 overload instance also has a dflt arg value
-      if(strcmp(current_fmac.name, current_dflt.name) == 0)  
-        /* at this point exact same arg-length fcn duplicates would have triggered a "duplicate args length" 
-         * fatal error, thus all arg lengths -- defaulted or not -- are unique */
-        for(i = 0; i < current_fmac.arg_sizes_length; ++i) // for each overload instance (via the differnt unique arg lengths registered)
-          for(j = 0; j < current_dflt.arg_sizes_length; ++j) { // for each dflt instance
-            // same fcn name & arg length == same fcn instance
-            if(current_fmac.arg_sizes[i] == current_dflt.arg_sizes[j]) continue; // don't compare a fcn to itself
-            overload_fmacs_total_dflts = total_dflts_for_ARG_SIZE_fcn_instance_in_UNIQUE_DFLT_FCNS(current_fmac.arg_sizes[i], unique_dflt_fcns_idx);
-            overload_fmacs_arg_size    = current_fmac.arg_sizes[i];
-            unique_dflt_fcns_arg_size     = current_dflt.arg_sizes[j];
-            unique_dflt_fcns_total_dflts  = current_dflt.total_dflts[j];
-            
-            if(ambiguous_overload(overload_fmacs_total_dflts, overload_fmacs_arg_size, unique_dflt_fcns_arg_size, unique_dflt_fcns_total_dflts))
-              throw_fatal_error_ambiguous_overload(current_fmac.name, overload_fmacs_total_dflts, 
-                overload_fmacs_arg_size, unique_dflt_fcns_arg_size, unique_dflt_fcns_total_dflts, __LINE__);
-          }
-    }
+  for(; overload_fmacs_idx < DC->overload_fmacs_size; ++overload_fmacs_idx) { // for each overload
+    #define current_fmac DC->overload_fmacs[overload_fmacs_idx]
+    #define current_dflt DC->unique_dflt_fcns[unique_dflt_fcns_idx]
+    // if at least 1 overload instance also has a dflt arg value
+    unique_dflt_fcns_idx = DC->cola_names[intern_identifier(current_fmac.name, strlen(current_fmac.name))].dflt_idx;
+    if(unique_dflt_fcns_idx != -1)
+      /* at this point exact same arg-length fcn duplicates would have triggered a "duplicate args length" 
+       * fatal error, thus all arg lengths -- defaulted or not -- are unique */
+      for(i = 0; i < current_fmac.arg_sizes_length; ++i) // for each overload instance (via the differnt unique arg lengths registered)
+        for(j = 0; j < current_dflt.arg_sizes_length; ++j) { // for each dflt instance
+          // same fcn name & arg length == same fcn instance
+          if(current_fmac.arg_sizes[i] == current_dflt.arg_sizes[j]) continue; // don't compare a fcn to itself
+          overload_fmacs_total_dflts = total_dflts_for_ARG_SIZE_fcn_instance_in_UNIQUE_DFLT_FCNS(current_fmac.arg_sizes[i], unique_dflt_fcns_idx);
+          overload_fmacs_arg_size    = current_fmac.arg_sizes[i];
+          unique_dflt_fcns_arg_size     = current_dflt.arg_sizes[j];
+          unique_dflt_fcns_total_dflts  = current_dflt.total_dflts[j];
+          
+          if(ambiguous_overload(overload_fmacs_total_dflts, overload_fmacs_arg_size, unique_dflt_fcns_arg_size, unique_dflt_fcns_total_dflts))
+            throw_fatal_error_ambiguous_overload(current_fmac.name, overload_fmacs_total_dflts, 
+              overload_fmacs_arg_size, unique_dflt_fcns_arg_size, unique_dflt_fcns_total_dflts, __LINE__);
+        }
+  }
   #undef current_fmac
   #undef current_dflt
 }
 
 // confirms any/all dflt values were defined at the end of the fcn's arg list & not in a macro
-void confirm_valid_default_values_position(int arg_total, char *function_name, bool is_a_macro) {
-  #define current_dflt all_dflt_fcns[all_dflt_fcns_size] 
+static void confirm_valid_default_values_position(int arg_total, char *function_name, bool is_a_macro) {
+  #define current_dflt DC->all_dflt_fcns[DC->all_dflt_fcns_size] 
   if(current_dflt.total_dflts == 0) return; // no defaulted values found
   // declass.c methods have '*this' spliced as their last arg (unbeknownst to the user), 
   // thus enable default values args 1 position prior to the end of the args list rather than 
@@ -4356,24 +7545,24 @@ void confirm_valid_default_values_position(int arg_total, char *function_name, b
 
 // given a ptr in an function's arg list, reads & stores default value in "all_dflt_fcns" struct,
 // returns length of the default value + 1 to whitespace the "= <dfltVal>" in the args list
-int store_dflt_value(int current_arg_idx, char *p) {
-  int idx = 0, dflt_val_length = 1; // "1" to account for the '='
-  char *scout = p + 1;
+static int store_dflt_value(int current_arg_idx, char *p) {
+  int dflt_val_length = 1; // "1" to account for the '='
+  char *scout = p + 1, *value, *value_end;
   // more readble to repn. current "fcn" dflt-tracking instance in "all_dflt_fcns"
-  #define current_dflt all_dflt_fcns[all_dflt_fcns_size] 
-  FLOOD_ZEROS(current_dflt.dflt_vals[current_arg_idx], MAX_ARGS_PER_FCN);
+  #define current_dflt DC->all_dflt_fcns[DC->all_dflt_fcns_size] 
+  int max_dflts = current_dflt.max_dflts;
+  current_dflt.dflt_idxs = reserve_table(current_dflt.dflt_idxs, &max_dflts, current_dflt.total_dflts + 1, sizeof(int));
+  current_dflt.dflt_vals = reserve_table(current_dflt.dflt_vals, &current_dflt.max_dflts, current_dflt.total_dflts + 1, sizeof(char *));
   // store defaulted arg's idx relative to ithe fcn's entire args list
   current_dflt.dflt_idxs[current_dflt.total_dflts] = current_arg_idx; 
   // skip optional whitespace btwn '=' && dflt value
   while(IS_WHITESPACE(*scout)) ++scout, ++dflt_val_length; 
-  // copy default value
-  while(*scout != '\0' && *scout != ',' && *scout != ')')
-    current_dflt.dflt_vals[current_dflt.total_dflts][idx++] = *scout++, ++dflt_val_length; 
-  current_dflt.dflt_vals[current_dflt.total_dflts][idx] = '\0';
-  if(idx > 0) { // trim possible whitespaces following the default value
-    scout = &current_dflt.dflt_vals[current_dflt.total_dflts][idx-1];
-    while(IS_WHITESPACE(*scout)) *scout-- = '\0'; 
-  }
+  // find end of default value
+  value = scout;
+  while(*scout != '\0' && *scout != ',' && *scout != ')') ++scout, ++dflt_val_length; 
+  // trim possible whitespaces following the default value & store its interned copy
+  for(value_end = scout; value_end > value && IS_WHITESPACE(*(value_end - 1)); --value_end);
+  current_dflt.dflt_vals[current_dflt.total_dflts] = intern_dflt_value(value, value_end - value);
   ++ current_dflt.total_dflts;
   #undef current_dflt
   return dflt_val_length;
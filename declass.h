@@ -0,0 +1,44 @@
+// AUTHOR: JORDAN RANDLEMAN - LIBDECLASS: DECLASS.C'S DECLASSIFIER AS A LINKABLE LIBRARY
+// Email jrandleman@scu.edu or see https://github.com/jrandleman for support
+/**
+ * compile: $ gcc -std=c99 -DDECLASS_LIBRARY -c declass.c // omits declass.c's "main()" & cmd line fcns,
+ *                                                        // exporting only the "declass_*" fcns below
+ *          $ gcc -std=c99 -o yourProgram yourProgram.c declass.o
+ *
+ * each context declassifies sources independently of every other, thus threads can
+ * each declassify their own sources in parallel (so long as they don't share a context):
+ *
+ *   declass_ctx *ctx = declass_new(NULL);
+ *   char *out; size_t outlen;
+ *   if(declass_transpile(ctx, src, srclen, &out, &outlen) == DECLASS_OK) { ... free(out); }
+ *   declass_free(ctx);
+ */
+#ifndef DECLASS_H_
+#define DECLASS_H_
+#include <stdbool.h>
+#include <stddef.h>
+
+// declass.c's version: bumped whenever declassified output changes (keys "--cache-dir" entries)
+#define DECLASS_VERSION "2.1"
+
+// "declass_transpile()" results
+#define DECLASS_OK     0
+#define DECLASS_ERROR -1 // fatal error (reported to stderr), or "#define DECLASS_IGNORE" found
+
+typedef struct declass_ctx declass_ctx;
+
+struct declass_options {
+  const char *filename; // name shown in the declassified banner (NULL = "declass_input.c")
+  bool no_cola;         // don't pass the declassified source to cola.c (like "#define DECLASS_NCOLA")
+  bool external_runtime; // "#include" "declass_rt.h" rather than inlining smrtptr.h (like "--runtime=external")
+};
+
+// returns a new context (w/ dflt options if "opts" is NULL), or NULL if out of memory
+declass_ctx *declass_new(const struct declass_options *opts);
+// declassifies the "len" chars at "src" (& any "DECLASS_H_" headers it includes, read relative
+// to the working directory), storing the malloc'd & '\0'-terminated result in "*out" & its length
+// in "*outlen". returns DECLASS_OK, or DECLASS_ERROR w/ "*out" NULL. errors never prompt the user.
+int declass_transpile(declass_ctx *ctx, const char *src, size_t len, char **out, size_t *outlen);
+// frees a context made by "declass_new()"
+void declass_free(declass_ctx *ctx);
+#endif
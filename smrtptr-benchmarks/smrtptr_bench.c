@@ -0,0 +1,58 @@
+// smrtptr_bench.c -- timing smrtptr.h's garbage collector via declass.c
+// $ ./declass -no-compile smrtptr_bench.c && gcc -O2 -o smrtptr_bench smrtptr_bench_DECLASS.c
+// $ ./smrtptr_bench [total smart pointers (dflt 1000000)]
+// compile w/ "-DBENCH_NO_RESERVE -DBENCH_NO_ARENA" to time smrtptr.h's from before "smrtptr_reserve()" & arenas
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+// prints the throughput of "total" smrtptr.h operations taking "start" to now
+void report(char *phase, long total, clock_t start) {
+  double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+  if(secs <= 0) secs = 1.0 / CLOCKS_PER_SEC;
+  printf("%-22s %10ld ops %9.3f s %12.0f ops/s\n", phase, total, secs, total / secs);
+}
+
+
+int main(int argc, char *argv[]) {
+  long total = (argc > 1) ? atol(argv[1]) : 1000000, i;
+  void **ptrs = malloc(sizeof(void *) * total);
+  clock_t start;
+  if(ptrs == NULL || total <= 0) return 1;
+
+  // register "total" ptrs, growing the garbage collector as they arrive
+  start = clock();
+  for(i = 0; i < total; ++i) ptrs[i] = smrtmalloc(16);
+  report("smrtmalloc", total, start);
+
+  // move every ptr, re-keying each in the garbage collector
+  start = clock();
+  for(i = 0; i < total; ++i) ptrs[i] = smrtrealloc(ptrs[i], 64);
+  report("smrtrealloc", total, start);
+
+  // free every ptr prior to exiting
+  start = clock();
+  for(i = total - 1; i >= 0; --i) smrtfree(ptrs[i]);
+  report("smrtfree", total, start);
+
+#ifndef BENCH_NO_RESERVE
+  // register "total" ptrs again, w/ the garbage collector sized up front
+  start = clock();
+  smrtptr_reserve(total);
+  for(i = 0; i < total; ++i) ptrs[i] = smrtmalloc(16);
+  report("reserve + smrtmalloc", total, start);
+#endif
+
+#ifndef BENCH_NO_ARENA
+  // bump-allocate "total" ptrs in an arena region, then free them all at once
+  start = clock();
+  smrtarena_begin();
+  for(i = 0; i < total; ++i) ptrs[i] = smrtmalloc(16);
+  smrtarena_end();
+  report("arena smrtmalloc + end", total, start);
+#endif
+
+  free(ptrs);
+  return 0; // remaining smart pointers are freed atexit
+}
@@ -0,0 +1,64 @@
+// smrtptr_thread_bench.c -- stressing thread-safe smrtptr.h via declass.c
+// $ ./declass smrtptr_thread_bench.c (auto-compiles w/ "-pthread") && ./smrtptr_thread_bench [ops per thread]
+// each of 1-64 threads churns its own smart pointers, & hands every 8th to another thread to smrtfree
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#define DECLASS_THREADSAFE
+#define TOTAL_SLOTS 1024
+#define HANDOFF_SLOTS 4096
+
+
+void *HANDOFF[HANDOFF_SLOTS]; // ptrs smrtfree'd by whichever thread next swaps their slot
+long OPS_PER_THREAD = 200000;
+
+
+// returns the current wall-clock time in seconds
+double now() {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+// smrtmalloc/smrtrealloc/smrtfree "OPS_PER_THREAD" times over random slots
+void *churn(void *arg) {
+  unsigned long seed = (unsigned long)arg * 2654435761UL + 1;
+  void *slots[TOTAL_SLOTS] = {NULL};
+  long i, k;
+  for(i = 0; i < OPS_PER_THREAD; ++i) {
+    seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+    k = (long)(seed >> 33) % TOTAL_SLOTS;
+    if(slots[k] == NULL) {
+      slots[k] = smrtmalloc(32);
+    } else if((seed >> 20) % 8 == 0) {
+      void *old = __sync_lock_test_and_set(&HANDOFF[(seed >> 40) % HANDOFF_SLOTS], slots[k]);
+      if(old != NULL) smrtfree(old);
+      slots[k] = NULL;
+    } else if((seed >> 20) % 8 < 3) {
+      slots[k] = smrtrealloc(slots[k], 32 + (seed >> 50) % 256);
+    } else {
+      smrtfree(slots[k]);
+      slots[k] = NULL;
+    }
+  }
+  for(k = 0; k < TOTAL_SLOTS; ++k) smrtfree(slots[k]);
+  return NULL;
+}
+
+
+int main(int argc, char *argv[]) {
+  pthread_t threads[64];
+  long total_threads, i;
+  if(argc > 1) OPS_PER_THREAD = atol(argv[1]);
+  printf("%8s %14s %10s %14s\n", "threads", "total ops", "secs", "ops/s");
+  for(total_threads = 1; total_threads <= 64; total_threads *= 2) {
+    double start = now(), secs;
+    for(i = 0; i < total_threads; ++i) pthread_create(&threads[i], NULL, churn, (void *)(i + 1));
+    for(i = 0; i < total_threads; ++i) pthread_join(threads[i], NULL);
+    secs = now() - start;
+    printf("%8ld %14ld %10.3f %14.0f\n", total_threads, total_threads * OPS_PER_THREAD, secs, total_threads * OPS_PER_THREAD / secs);
+  }
+  return 0; // handed-off ptrs never swapped out are freed atexit
+}
@@ -0,0 +1,18 @@
+// DECLASS_H_particle.h -- a "pooled" class shared by several files via --split-headers
+#include <stdio.h>
+
+
+class Particle pooled {
+  int id;
+  double x;
+  double y;
+
+  void step(double dx, double dy) {
+    x += dx;
+    y += dy;
+  }
+
+  void show() {
+    printf("Particle #%d: (%.1f, %.1f)\n", id, x, y);
+  }
+};
@@ -0,0 +1,26 @@
+/* DECLASSIFIED: DECLASS_H_particle.h
+ * Email jrandleman@scu.edu or see https://github.com/jrandleman for support */
+#include "DECLASS_H_particle_DECLASS.h"
+
+Particle DC__Particle_DFLT(){
+	Particle this={&DC__NDTR,0,0,0,};
+	return this;
+}
+
+
+/* DEFAULT PROVIDED "Particle" CLASS CONSTRUCTOR/DESTRUCTOR: */
+void DC__NOT_Particle_(Particle *this) {
+}
+
+Particle DC_Particle_(Particle*this){return*this;}
+
+
+/* "Particle" CLASS METHODS SPLICED OUT: */
+  void DC_Particle_step(double dx, double dy, Particle *this) {
+    this->x += dx;
+    this->y += dy;
+  }
+
+  void DC_Particle_show(Particle *this) {
+    printf("Particle #%d: (%.1f, %.1f)\n", this->id, this->x, this->y);
+  }
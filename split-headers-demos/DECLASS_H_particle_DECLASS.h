@@ -0,0 +1,85 @@
+/* DECLASSIFIED: DECLASS_H_particle.h
+ * Email jrandleman@scu.edu or see https://github.com/jrandleman for support */
+#ifndef DECLASS_H_PARTICLE_DECLASS_H_
+#define DECLASS_H_PARTICLE_DECLASS_H_
+#define immortal // immortal keyword active
+#include "declass_rt.h"
+
+#include <stdio.h>
+
+
+/******************************** CLASS START ********************************/
+/* "Particle" CLASS DEFAULT VALUE MACRO CONSTRUCTORS: */
+#define DC__Particle_CTOR(DC_THIS) ({DC_THIS = DC__Particle_DFLT();})
+#define DC__Particle_ARR(DC_ARR) ({\
+  for(int DC__Particle_IDX=0;DC__Particle_IDX<(sizeof(DC_ARR)/sizeof(DC_ARR[0]));++DC__Particle_IDX)\
+    DC__Particle_CTOR(DC_ARR[DC__Particle_IDX]);\
+})
+#define DC__Particle_UCTOR_ARR(DC_ARR) ({\
+  for(int DC__Particle_UCTOR_IDX=0;DC__Particle_UCTOR_IDX<(sizeof(DC_ARR)/sizeof(DC_ARR[0]));++DC__Particle_UCTOR_IDX)\
+DC_Particle_(&DC_ARR[DC__Particle_UCTOR_IDX]);\
+})
+/* "Particle" CLASS OBJECT ARRAY MACRO DESTRUCTOR: */
+#define DC__Particle_UDTOR_ARR(DC_ARR) ({\
+  for(int DC__Particle_UDTOR_IDX=0;DC__Particle_UDTOR_IDX<(sizeof(DC_ARR)/sizeof(DC_ARR[0]));++DC__Particle_UDTOR_IDX)\
+		if(DC_ARR[DC__Particle_UDTOR_IDX].DC_DTR){DC__NOT_Particle_(&DC_ARR[DC__Particle_UDTOR_IDX]);DC_ARR[DC__Particle_UDTOR_IDX].DC_DTR=NULL;}\
+})
+
+/* "Particle" CLASS CONVERTED TO STRUCT: */
+typedef struct DC_Particle {
+	int *DC_DTR;
+  int id;
+  double x;
+  double y;
+
+} Particle;
+Particle DC__Particle_DFLT();
+
+/* "Particle" CLASS OBJECT POOL DECLARATIONS: */
+static inline Particle *DC__Particle_POOL_NEW();
+static inline void DC__Particle_POOL_DEL(Particle *this);
+#define Particle_pool_new DC__Particle_POOL_NEW
+#define Particle_pool_del(DC_PTR) ({DC__Particle_POOL_DEL(DC_PTR);DC_PTR=NULL;})
+
+/* DEFAULT PROVIDED "Particle" CLASS CONSTRUCTOR/DESTRUCTOR: */
+void DC__NOT_Particle_(Particle *this);
+Particle DC_Particle_(Particle*this);
+#define DC__DUMMY_Particle()({\
+	Particle DC__Particle__temp;\
+	DC__Particle_CTOR(DC__Particle__temp);\
+	DC_Particle_(&DC__Particle__temp);\
+})
+
+/* "Particle" CLASS METHODS SPLICED OUT: */
+  void DC_Particle_step(double dx, double dy, Particle *this);
+  void DC_Particle_show(Particle *this);
+
+/* "Particle" CLASS OBJECT POOL (FREE LIST OF CACHE-LINE-ALIGNED SLABS): */
+typedef struct DC__Particle_POOL_CELL {Particle DC_OBJ; struct DC__Particle_POOL_CELL *DC_NEXT;} DC__Particle_POOL_CELL;
+static DC__Particle_POOL_CELL *DC__Particle_POOL_FREE = NULL;
+static inline Particle *DC__Particle_POOL_NEW() {
+	DC__Particle_POOL_CELL *DC_CELL = DC__Particle_POOL_FREE;
+	if(!DC_CELL) {
+		long DC_CELLS = 4096 / sizeof(DC__Particle_POOL_CELL), DC_IDX;
+		if(DC_CELLS < 1) DC_CELLS = 1;
+		char *DC_SLAB = malloc(DC_CELLS * sizeof(DC__Particle_POOL_CELL) + 63);
+		if(!DC_SLAB) return NULL;
+		smrtptr(DC_SLAB);
+		DC_CELL = (DC__Particle_POOL_CELL *)(DC_SLAB + (64 - (unsigned long)DC_SLAB % 64) % 64);
+		for(DC_IDX = 0; DC_IDX < DC_CELLS - 1; ++DC_IDX) DC_CELL[DC_IDX].DC_NEXT = &DC_CELL[DC_IDX + 1];
+		DC_CELL[DC_CELLS - 1].DC_NEXT = NULL;
+	}
+	DC__Particle_POOL_FREE = DC_CELL->DC_NEXT;
+	return &DC_CELL->DC_OBJ;
+}
+static inline void DC__Particle_POOL_DEL(Particle *this) {
+	if(!this) return;
+	if(this->DC_DTR) DC__NOT_Particle_(this);
+	this->DC_DTR = NULL;
+	((DC__Particle_POOL_CELL *)this)->DC_NEXT = DC__Particle_POOL_FREE;
+	DC__Particle_POOL_FREE = (DC__Particle_POOL_CELL *)this;
+}
+/********************************* CLASS END *********************************/
+
+
+#endif
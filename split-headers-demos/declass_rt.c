@@ -0,0 +1,285 @@
+/* DECLASS RUNTIME 2.1: declass_rt.c
+ * Email jrandleman@scu.edu or see https://github.com/jrandleman for support */
+/****************************** SMRTPTR.H START ******************************/
+// Source: https://github.com/jrandleman/C-Libraries/tree/master/Smart-Pointer
+#ifndef SMRTPTR_H_
+#define SMRTPTR_H_
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+// "#define DECLASS_THREADSAFE": the garbage collector is split into 64 independently locked shards
+// (by ptr hash, so any thread may free any smrt ptr) & each thread opens its own arena regions
+#ifdef DECLASS_THREADSAFE
+#include <pthread.h>
+#define SMRTPTR_SHARDS 64
+#define SMRTPTR_THREAD_LOCAL __thread
+#define SMRTPTR_SHARD_ALIGN _Alignas(64)
+#else
+#define SMRTPTR_SHARDS 1
+#define SMRTPTR_THREAD_LOCAL
+#define SMRTPTR_SHARD_ALIGN
+#endif
+// garbage collector & smart pointer storage struct: an open-addressing hash set (per shard)
+// shards are cache-line aligned, so their size rounds up to a multiple of 64 (no false sharing)
+static struct SMRTPTR_GARBAGE_COLLECTOR {
+  SMRTPTR_SHARD_ALIGN long len; // current # of ptrs
+  long max;      // # of slots (a power of 2, kept under 3/4 full)
+  void **ptrs;   // unique ptr set to free all smrt ptrs (NULL slots are empty)
+#ifdef DECLASS_THREADSAFE
+  pthread_mutex_t lock; // guards the shard
+#endif
+} SMRTPTR_GC[SMRTPTR_SHARDS];
+// arena regions: while 1 is open, smrtmalloc/smrtcalloc bump-allocate from its chunks (each
+// a smart ptr itself, so still freed atexit) which smrtarena_end frees all at once
+struct SMRTARENA_CHUNK {
+  struct SMRTARENA_CHUNK *prev; // region's previous (full) chunk
+  size_t len, max;              // bytes bumped thus far && bytes available
+};
+static SMRTPTR_THREAD_LOCAL struct SMRTARENA_REGION {
+  struct SMRTARENA_REGION *outer; // enclosing open region (NULL if outermost)
+  struct SMRTARENA_CHUNK *chunks; // newest chunk (NULL until 1st alloc)
+} *SMRTARENA = NULL;
+// invoked by atexit to free all ctor-alloc'd memory (join any threads using smrt ptrs 1st)
+static void smrtptr_free_all() {
+  long len = 0, s = 0, i;
+  for(; s < SMRTPTR_SHARDS; ++s) {
+    for(i = 0; i < SMRTPTR_GC[s].max; ++i) if(SMRTPTR_GC[s].ptrs[i]) free(SMRTPTR_GC[s].ptrs[i]);
+    free(SMRTPTR_GC[s].ptrs);
+    len += SMRTPTR_GC[s].len, SMRTPTR_GC[s].len = 0, SMRTPTR_GC[s].max = 0, SMRTPTR_GC[s].ptrs = NULL;
+  }
+  // if(len > 0) printf("FREED %ld SMART POINTERS!\n", len); // optional
+  SMRTARENA = NULL;
+}
+// throws invalid allocation errors
+static void smrtptr_throw_bad_alloc(char *alloc_type, char *smrtptr_h_fcn) {
+  fprintf(stderr, "\n-:- \033[1m\033[31mERROR\033[0m COULDN'T %s MEMORY FOR SMRTPTR.H'S %s -:-\n\n", alloc_type, smrtptr_h_fcn);
+  fprintf(stderr, "-:- FREEING ALLOCATED MEMORY THUS FAR AND TERMINATING PROGRAM -:-\n\n");
+  exit(EXIT_FAILURE); // still frees any ptrs allocated thus far
+}
+// registers the garbage collector to be freed atexit (once, rather than per ptr) & inits its locks
+static void smrtptr_init_gc() {
+#ifdef DECLASS_THREADSAFE
+  long s = 0;
+  for(; s < SMRTPTR_SHARDS; ++s) pthread_mutex_init(&SMRTPTR_GC[s].lock, NULL);
+#endif
+  atexit(smrtptr_free_all);
+}
+// lock & unlock gc's shard (no-ops w/o "DECLASS_THREADSAFE")
+static void smrtptr_lock(struct SMRTPTR_GARBAGE_COLLECTOR *gc) {
+#ifdef DECLASS_THREADSAFE
+  pthread_mutex_lock(&gc->lock);
+#endif
+  (void)gc;
+}
+static void smrtptr_unlock(struct SMRTPTR_GARBAGE_COLLECTOR *gc) {
+#ifdef DECLASS_THREADSAFE
+  pthread_mutex_unlock(&gc->lock);
+#endif
+  (void)gc;
+}
+// hashes ptr: its low bits pick the 1st slot it may be stored in, & its top 6 its shard
+static unsigned long long smrtptr_hash(void *ptr) {
+  unsigned long long hash = (unsigned long long)(size_t)ptr;
+  hash ^= hash >> 33, hash *= 0xff51afd7ed558ccdULL, hash ^= hash >> 33;
+  return hash;
+}
+// returns the garbage collector shard storing ptr (initializing the garbage collector if unused)
+static struct SMRTPTR_GARBAGE_COLLECTOR *smrtptr_shard(void *ptr) {
+#ifdef DECLASS_THREADSAFE
+  static pthread_once_t init = PTHREAD_ONCE_INIT;
+  pthread_once(&init, smrtptr_init_gc);
+  return &SMRTPTR_GC[smrtptr_hash(ptr) >> 58];
+#else
+  static int init = 0;
+  if(!init) init = 1, smrtptr_init_gc();
+  return (void)ptr, SMRTPTR_GC;
+#endif
+}
+// returns the slot of gc holding ptr, else the empty slot ptr would be stored in
+static long smrtptr_find(struct SMRTPTR_GARBAGE_COLLECTOR *gc, void *ptr) {
+  long i = (long)(smrtptr_hash(ptr) & (unsigned long long)(gc->max - 1));
+  while(gc->ptrs[i] && gc->ptrs[i] != ptr) i = (i + 1) & (gc->max - 1);
+  return i;
+}
+// empties slot i of gc, shifting back any later ptrs whose probe passed through it
+static void smrtptr_unslot(struct SMRTPTR_GARBAGE_COLLECTOR *gc, long i) {
+  long j = i, home;
+  gc->ptrs[i] = NULL;
+  while(gc->ptrs[j = (j + 1) & (gc->max - 1)]) {
+    home = (long)(smrtptr_hash(gc->ptrs[j]) & (unsigned long long)(gc->max - 1));
+    if((j > i && (home <= i || home > j)) || (j < i && home <= i && home > j))
+      gc->ptrs[i] = gc->ptrs[j], gc->ptrs[j] = NULL, i = j;
+  }
+  gc->len--;
+}
+// rehashes gc into "new_max" slots (a power of 2)
+static void smrtptr_rehash(struct SMRTPTR_GARBAGE_COLLECTOR *gc, long new_max) {
+  long old_max = gc->max, i = 0;
+  void **old_ptrs = gc->ptrs;
+  gc->ptrs = calloc(new_max, sizeof(void *));
+  if(!gc->ptrs) {
+    gc->ptrs = old_ptrs;
+    smrtptr_throw_bad_alloc(old_max ? "REALLOC" : "MALLOC", "GARBAGE COLLECTOR");
+  }
+  gc->max = new_max;
+  for(; i < old_max; ++i) if(old_ptrs[i]) gc->ptrs[smrtptr_find(gc, old_ptrs[i])] = old_ptrs[i];
+  free(old_ptrs);
+}
+// acts like assert, but exits rather than abort to free smart pointers
+#ifndef DECLASS_NDEBUG
+#define smrtassert(condition) ({\
+  if(!(condition)) {\
+    fprintf(stderr, "\n\033[1m\033[31mERROR\033[0m Smart Assertion failed: (%s), function %s, file %s, line %d.\n", #condition, __func__, __FILE__, __LINE__);\
+    fprintf(stderr, ">> Freeing Allocated Smart Pointers & Terminating Program.\n\n");\
+    exit(EXIT_FAILURE);\
+  }\
+})
+#else
+#define smrtassert(condition)
+#endif
+// smrtptr stores ptr passed as arg to be freed atexit
+void smrtptr(void *ptr) {
+  struct SMRTPTR_GARBAGE_COLLECTOR *gc;
+  long i;
+  if(!ptr) return;
+  gc = smrtptr_shard(ptr);
+  smrtptr_lock(gc);
+  // double the slots if adding ptr would fill over 3/4 of them
+  if(4 * (gc->len + 1) > 3 * gc->max) smrtptr_rehash(gc, gc->max ? gc->max * 2 : 16);
+  // add ptr to the garbage collector if not already present (ensures no double-freeing)
+  i = smrtptr_find(gc, ptr);
+  if(gc->ptrs[i] != ptr) {
+    gc->ptrs[i] = ptr, gc->len++;
+    // printf("SMART POINTER #%ld STORED!\n", gc->len); // optional
+  }
+  smrtptr_unlock(gc);
+}
+// hints "n" more ptrs will be stored, growing the garbage collector once up front
+void smrtptr_reserve(size_t n) {
+  struct SMRTPTR_GARBAGE_COLLECTOR *gc = SMRTPTR_GC;
+  long max, s = 0;
+  if(n > ((size_t)-1) >> 4) smrtptr_throw_bad_alloc("RESERVE", "GARBAGE COLLECTOR");
+  smrtptr_shard(NULL); // initialize garbage collector
+  n = (n + SMRTPTR_SHARDS - 1) / SMRTPTR_SHARDS; // ptrs spread evenly across shards
+  for(; s < SMRTPTR_SHARDS; ++s, ++gc) {
+    smrtptr_lock(gc);
+    for(max = gc->max ? gc->max : 16; 4 * (gc->len + (long)n) > 3 * max; max *= 2);
+    if(max > gc->max) smrtptr_rehash(gc, max);
+    smrtptr_unlock(gc);
+  }
+}
+// returns the 1st byte of chunk to bump-allocate from (16-byte aligned)
+static char *smrtarena_bytes(struct SMRTARENA_CHUNK *chunk) {
+  return (char *)chunk + ((sizeof(struct SMRTARENA_CHUNK) + 15) & ~(size_t)15);
+}
+// bump-allocates "size" bytes from region, prefixed by "size" (for smrtrealloc)
+static void *smrtarena_alloc(struct SMRTARENA_REGION *region, size_t size) {
+  struct SMRTARENA_CHUNK *chunk = region->chunks;
+  size_t need = ((size + 15) & ~(size_t)15) + 16, max;
+  if(size > ((size_t)-1) >> 2) smrtptr_throw_bad_alloc("BUMP-ALLOCATE", "ARENA");
+  if(!chunk || chunk->max - chunk->len < need) { // add a chunk twice the size of the last
+    for(max = chunk ? chunk->max * 2 : 4096; max < need; max *= 2);
+    chunk = malloc(((sizeof(struct SMRTARENA_CHUNK) + 15) & ~(size_t)15) + max);
+    if(!chunk) smrtptr_throw_bad_alloc("MALLOC", "ARENA");
+    smrtptr(chunk);
+    chunk->prev = region->chunks, chunk->len = 0, chunk->max = max;
+    region->chunks = chunk;
+  }
+  size_t *block = (size_t *)(smrtarena_bytes(chunk) + chunk->len);
+  chunk->len += need;
+  *block = size;
+  return (char *)block + 16;
+}
+// returns the open region ptr was bumped from (NULL if not an arena ptr)
+static struct SMRTARENA_REGION *smrtarena_owner(void *ptr) {
+  struct SMRTARENA_REGION *region = SMRTARENA;
+  struct SMRTARENA_CHUNK *chunk;
+  for(; region; region = region->outer)
+    for(chunk = region->chunks; chunk; chunk = chunk->prev)
+      if((char *)ptr >= smrtarena_bytes(chunk) && (char *)ptr < smrtarena_bytes(chunk) + chunk->len) return region;
+  return NULL;
+}
+// opens a region: smrtmalloc/smrtcalloc bump-allocate from it until the matching smrtarena_end
+void smrtarena_begin(void) {
+  struct SMRTARENA_REGION *region = malloc(sizeof(struct SMRTARENA_REGION));
+  if(!region) smrtptr_throw_bad_alloc("MALLOC", "SMRTARENA_BEGIN FUNCTION");
+  smrtptr(region);
+  region->outer = SMRTARENA, region->chunks = NULL;
+  SMRTARENA = region;
+}
+// malloc's a pointer, stores it in the garbage collector, then returns ptr
+void *smrtmalloc(size_t alloc_size) {
+  if(SMRTARENA) return smrtarena_alloc(SMRTARENA, alloc_size);
+  void *smtr_malloced_ptr = malloc(alloc_size);
+  if(smtr_malloced_ptr == NULL) smrtptr_throw_bad_alloc("MALLOC", "SMRTMALLOC FUNCTION");
+  smrtptr(smtr_malloced_ptr);
+  return smtr_malloced_ptr;
+}
+// calloc's a pointer, stores it in the garbage collector, then returns ptr
+void *smrtcalloc(size_t alloc_num, size_t alloc_size) {
+  if(SMRTARENA) {
+    if(alloc_size && alloc_num > ((size_t)-1) / alloc_size) smrtptr_throw_bad_alloc("CALLOC", "SMRTCALLOC FUNCTION");
+    return memset(smrtarena_alloc(SMRTARENA, alloc_num * alloc_size), 0, alloc_num * alloc_size);
+  }
+  void *smtr_calloced_ptr = calloc(alloc_num, alloc_size);
+  if(smtr_calloced_ptr == NULL) smrtptr_throw_bad_alloc("CALLOC", "SMRTCALLOC FUNCTION");
+  smrtptr(smtr_calloced_ptr);
+  return smtr_calloced_ptr;
+}
+// realloc's a pointer, stores it anew in the garbage collector, then returns ptr
+// compatible both "smart" & "dumb" ptrs!
+void *smrtrealloc(void *ptr, size_t realloc_size) {
+  struct SMRTPTR_GARBAGE_COLLECTOR *gc = smrtptr_shard(ptr);
+  void *smtr_realloced_ptr;
+  long i;
+  // realloc a "smart" ptr already in garbage collector
+  smrtptr_lock(gc);
+  if(ptr && gc->len > 0 && gc->ptrs[i = smrtptr_find(gc, ptr)] == ptr) {
+    smtr_realloced_ptr = realloc(ptr, realloc_size); // frees ptr in garbage collector
+    if(smtr_realloced_ptr == NULL) smrtptr_throw_bad_alloc("REALLOC", "SMRTREALLOC FUNCTION");
+    if(smtr_realloced_ptr != ptr) smrtptr_unslot(gc, i); // rekey freed ptr to realloced address
+    smrtptr_unlock(gc);
+    if(smtr_realloced_ptr != ptr) smrtptr(smtr_realloced_ptr);
+    // printf("SMART POINTER REALLOC'D!\n"); // optional
+    return smtr_realloced_ptr;
+  }
+  smrtptr_unlock(gc);
+  // bump-allocate a NULL or arena ptr anew in its region (its old block is freed by smrtarena_end)
+  struct SMRTARENA_REGION *region;
+  if(SMRTARENA && (!ptr || (region = smrtarena_owner(ptr)))) {
+    if(!ptr) return smrtarena_alloc(SMRTARENA, realloc_size);
+    if(realloc_size <= *(size_t *)((char *)ptr - 16)) return ptr;
+    return memcpy(smrtarena_alloc(region, realloc_size), ptr, *(size_t *)((char *)ptr - 16));
+  }
+  // realloc a "dumb" ptr then add it to garbage collector
+  smtr_realloced_ptr = realloc(ptr, realloc_size);
+  if(smtr_realloced_ptr == NULL) smrtptr_throw_bad_alloc("REALLOC", "SMRTREALLOC FUNCTION");
+  smrtptr(smtr_realloced_ptr);
+  return smtr_realloced_ptr;
+}
+// prematurely frees ptr arg prior to atexit (if exists)
+void smrtfree(void *ptr) {
+  struct SMRTPTR_GARBAGE_COLLECTOR *gc;
+  long i = -1;
+  if(!ptr) return;
+  gc = smrtptr_shard(ptr);
+  smrtptr_lock(gc);
+  if(gc->len > 0 && gc->ptrs[i = smrtptr_find(gc, ptr)] == ptr) smrtptr_unslot(gc, i); // find ptr in garbage collector
+  else i = -1;
+  smrtptr_unlock(gc);
+  if(i == -1) return;
+  free(ptr);
+  // printf("SMART POINTER FREED!\n"); // optional
+}
+// closes the innermost region, freeing all it allocated at once (its ptrs needn't be smrtfree'd)
+void smrtarena_end(void) {
+  struct SMRTARENA_REGION *region = SMRTARENA;
+  struct SMRTARENA_CHUNK *chunk, *prev;
+  if(!region) return;
+  for(chunk = region->chunks; chunk; chunk = prev) prev = chunk->prev, smrtfree(chunk);
+  SMRTARENA = region->outer;
+  smrtfree(region);
+}
+#endif
+/******************************* SMRTPTR.H END *******************************/
+int DC__NDTR = 1;
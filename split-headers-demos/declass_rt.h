@@ -0,0 +1,31 @@
+/* DECLASS RUNTIME 2.1: declass_rt.h
+ * Email jrandleman@scu.edu or see https://github.com/jrandleman for support */
+// build once: $ gcc -std=c11 -c declass_rt.c && ar rcs libdeclass_rt.a declass_rt.o
+// (for threads, also w/ "-DDECLASS_THREADSAFE -pthread")
+#ifndef DECLASS_RT_H_
+#define DECLASS_RT_H_
+extern int DC__NDTR;
+#ifndef SMRTPTR_H_ // smrtptr.h's declarations (defined wherever smrtptr.h itself is inlined)
+#include <stdio.h>
+#include <stdlib.h>
+void smrtptr(void *ptr);
+void smrtptr_reserve(size_t n);
+void *smrtmalloc(size_t alloc_size);
+void *smrtcalloc(size_t alloc_num, size_t alloc_size);
+void *smrtrealloc(void *ptr, size_t realloc_size);
+void smrtfree(void *ptr);
+void smrtarena_begin(void);
+void smrtarena_end(void);
+#ifndef DECLASS_NDEBUG
+#define smrtassert(condition) ({\
+  if(!(condition)) {\
+    fprintf(stderr, "\n\033[1m\033[31mERROR\033[0m Smart Assertion failed: (%s), function %s, file %s, line %d.\n", #condition, __func__, __FILE__, __LINE__);\
+    fprintf(stderr, ">> Freeing Allocated Smart Pointers & Terminating Program.\n\n");\
+    exit(EXIT_FAILURE);\
+  }\
+})
+#else
+#define smrtassert(condition)
+#endif
+#endif
+#endif
@@ -0,0 +1,31 @@
+// particle_main.c -- linking several files that share a "pooled" split-out header
+// $ ./declass --split-headers --runtime=external --emit-runtime -no-compile particle_main.c particle_spawn.c
+// $ gcc -std=c11 -o particle_main particle_main_DECLASS.c particle_spawn_DECLASS.c DECLASS_H_particle_DECLASS.c declass_rt.c
+#include <stdio.h>
+#include "DECLASS_H_particle.h"
+
+void spawn_particle(Particle **spawned, int id);
+
+
+int main() {
+  Particle *p1 = NULL;
+  Particle *p2 = NULL;
+  spawn_particle(&p1, 1);
+  spawn_particle(&p2, 2);
+  Particle *p3 = Particle_pool_new();
+  p3->id = 3;
+
+  p1->step(0.5, 0.5);
+  p2->step(-1, 2);
+  p3->step(3, 3);
+  p1->show();
+  p2->show();
+  p3->show();
+
+  // recycle objects spawned in particle_spawn.c into this file's pool
+  Particle_pool_del(p1);
+  Particle_pool_del(p2);
+  Particle_pool_del(p3);
+  printf("p1 & p2 & p3 recycled: %s\n", (!p1 && !p2 && !p3) ? "true" : "false");
+  return 0;
+}
@@ -0,0 +1,38 @@
+/* DECLASSIFIED: particle_main.c
+ * Email jrandleman@scu.edu or see https://github.com/jrandleman for support */
+#define immortal // immortal keyword active
+#include "declass_rt.h"
+
+
+
+#include <stdio.h>
+#include "DECLASS_H_particle_DECLASS.h"
+
+void spawn_particle(Particle **spawned, int id);
+
+
+int main() {
+  Particle *p1 = NULL;
+  Particle *p2 = NULL;
+  spawn_particle(&p1, 1);
+  spawn_particle(&p2, 2);
+  Particle *p3 = Particle_pool_new(); if(p3){ DC__Particle_CTOR((*p3));p3->DC_DTR=&DC__NDTR;}
+  p3->id = 3;
+
+  DC_Particle_step(0.5, 0.5, p1);
+  DC_Particle_step(-1, 2, p2);
+  DC_Particle_step(3, 3, p3);
+  DC_Particle_show(p1);
+  DC_Particle_show(p2);
+  DC_Particle_show(p3);
+
+
+  Particle_pool_del(p1);
+  Particle_pool_del(p2);
+  Particle_pool_del(p3);
+  printf("p1 & p2 & p3 recycled: %s\n", (!p1 && !p2 && !p3) ? "true" : "false");
+  if(p1&&p1->DC_DTR){DC__NOT_Particle_(p1);p1=NULL;}
+if(p2&&p2->DC_DTR){DC__NOT_Particle_(p2);p2=NULL;}
+if(p3&&p3->DC_DTR){DC__NOT_Particle_(p3);p3=NULL;}
+return 0;
+}
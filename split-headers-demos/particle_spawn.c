@@ -0,0 +1,14 @@
+// particle_spawn.c -- allocating from a "pooled" class in a 2nd translation unit
+#include <stdio.h>
+#include "DECLASS_H_particle.h"
+
+
+// each file including a split-out header has its own Particle pool, but
+// pooled objects may still be handed to (& deleted by) any other file
+void spawn_particle(Particle **spawned, int id) {
+  Particle *p = Particle_pool_new();
+  p->id = id;
+  p->x = id;
+  p->y = -id;
+  *spawned = p;
+}
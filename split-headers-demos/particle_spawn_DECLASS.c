@@ -0,0 +1,18 @@
+/* DECLASSIFIED: particle_spawn.c
+ * Email jrandleman@scu.edu or see https://github.com/jrandleman for support */
+#define immortal // immortal keyword active
+#include "declass_rt.h"
+
+
+#include <stdio.h>
+#include "DECLASS_H_particle_DECLASS.h"
+
+
+void spawn_particle(Particle **spawned, int id) {
+  Particle *p = Particle_pool_new(); if(p){ DC__Particle_CTOR((*p));p->DC_DTR=&DC__NDTR;}
+  p->id = id;
+  p->x = id;
+  p->y = -id;
+  *spawned = p;
+if(p&&p->DC_DTR){DC__NOT_Particle_(p);p=NULL;}
+}